@@ -0,0 +1,89 @@
+#include <laml/laml.hpp>
+#include <laml/Animation.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Blending skeleton poses: per-joint slerp() calls vs. anim::blend
+int main() {
+	const size_t num_joints = 4096;
+	const size_t repeats = 256;
+	const size_t items = num_joints * repeats;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+	std::vector<laml::anim::JointPose<float>> joints[4];
+	for (size_t p = 0; p < 4; p++) {
+		joints[p].resize(num_joints);
+		for (size_t n = 0; n < num_joints; n++) {
+			joints[p][n] = laml::anim::JointPose<float>(
+				laml::normalize(laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen))),
+				laml::Vec3(dis(gen), dis(gen), dis(gen)),
+				laml::Vec3(1.0f + 0.1f * dis(gen)));
+		}
+	}
+	std::vector<laml::anim::JointPose<float>> out(num_joints);
+	laml::anim::Pose<float> poses[4] = {
+		laml::anim::Pose<float>(joints[0].data(), num_joints), laml::anim::Pose<float>(joints[1].data(), num_joints),
+		laml::anim::Pose<float>(joints[2].data(), num_joints), laml::anim::Pose<float>(joints[3].data(), num_joints) };
+	laml::anim::Pose<float> soa_out(num_joints);
+
+	printf("two-pose blend, %zu joints x %zu\n", num_joints, repeats);
+	double slerp = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < num_joints; n++) {
+				out[n].rotation = laml::slerp(joints[0][n].rotation, joints[1][n].rotation, 0.3f);
+				out[n].translation = laml::lerp(joints[0][n].translation, joints[1][n].translation, 0.3f);
+				out[n].scale = laml::lerp(joints[0][n].scale, joints[1][n].scale, 0.3f);
+			}
+			bench::keep(out[num_joints - 1]);
+		}
+	});
+	bench::report("per-joint slerp", slerp, items);
+
+	double fast = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::anim::blend(joints[0].data(), joints[1].data(), 0.3f, out.data(), num_joints);
+			bench::keep(out[num_joints - 1]);
+		}
+	});
+	bench::report("per-joint slerp_fast (AoS)", fast, items, slerp);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::anim::blend(poses[0], poses[1], 0.3f, soa_out);
+			bench::keep(soa_out.rotations.x()[num_joints - 1]);
+		}
+	});
+	bench::report("anim::blend (SoA)", soa, items, slerp);
+
+	printf("four-pose weighted blend, %zu joints x %zu\n", num_joints, repeats);
+	const float weights[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+	double chained = bench::time_ns([&]() {
+		// the usual way without a blend tree: accumulate with slerp one pose at a time
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < num_joints; n++) {
+				laml::Quat q = joints[0][n].rotation;
+				float acc = weights[0];
+				for (size_t p = 1; p < 4; p++) {
+					acc += weights[p];
+					q = laml::slerp(q, joints[p][n].rotation, weights[p] / acc);
+				}
+				out[n].rotation = q;
+			}
+			bench::keep(out[num_joints - 1]);
+		}
+	});
+	bench::report("chained per-joint slerp (rotation only)", chained, items);
+
+	const laml::anim::Pose<float>* pose_ptrs[4] = { &poses[0], &poses[1], &poses[2], &poses[3] };
+	double weighted = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::anim::blend(pose_ptrs, weights, 4, soa_out);
+			bench::keep(soa_out.rotations.x()[num_joints - 1]);
+		}
+	});
+	bench::report("anim::blend, 4 poses (SoA, full TRS)", weighted, items, chained);
+	return 0;
+}
@@ -0,0 +1,95 @@
+#ifndef __LAML_BENCH_H
+#define __LAML_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+    // Keeps the optimizer from throwing away a result that is never read
+    template<typename T>
+    inline void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        volatile char probe = *reinterpret_cast<const volatile char*>(&value);
+        (void)probe;
+#endif
+    }
+
+    // Best-of-N wall time of fn(), in nanoseconds
+    template<typename F>
+    double time_ns(F&& fn, size_t repeats = 10) {
+        double best = 0.0;
+        for (size_t r = 0; r < repeats; r++) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto stop = std::chrono::steady_clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+            if (r == 0 || ns < best) {
+                best = ns;
+            }
+        }
+        return best;
+    }
+
+    inline void report(const char* name, double ns, size_t items, double baseline_ns = 0.0) {
+        if (baseline_ns > 0.0) {
+            printf("%-48s %10.3f ns/item  %8.1f Mitems/s  x%.2f\n", name, ns / items, items * 1e3 / ns, baseline_ns / ns);
+        }
+        else {
+            printf("%-48s %10.3f ns/item  %8.1f Mitems/s\n", name, ns / items, items * 1e3 / ns);
+        }
+    }
+
+    // One line of a results file
+    struct Result {
+        std::string name;
+        double ns_per_item;
+    };
+
+    // CSV with a header line: name,ns_per_item,mitems_per_s
+    inline bool write_csv(const char* path, const std::vector<Result>& results) {
+        FILE* file = fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+        fprintf(file, "name,ns_per_item,mitems_per_s\n");
+        for (const Result& res : results) {
+            fprintf(file, "%s,%.4f,%.3f\n", res.name.c_str(), res.ns_per_item, 1e3 / res.ns_per_item);
+        }
+        fclose(file);
+        return true;
+    }
+
+    // name -> ns_per_item from a file written by write_csv(). Returns an empty map if it can't be read.
+    inline std::map<std::string, double> read_csv(const char* path) {
+        std::map<std::string, double> results;
+        FILE* file = fopen(path, "r");
+        if (!file) {
+            return results;
+        }
+        char line[512];
+        bool header = true;
+        while (fgets(line, sizeof(line), file)) {
+            if (header) {
+                header = false;
+                continue;
+            }
+            std::string text(line);
+            const size_t first = text.find(',');
+            if (first == std::string::npos) {
+                continue;
+            }
+            results[text.substr(0, first)] = strtod(text.c_str() + first + 1, nullptr);
+        }
+        fclose(file);
+        return results;
+    }
+}
+
+#endif // __LAML_BENCH_H
@@ -0,0 +1,96 @@
+#include <laml/laml.hpp>
+#include <laml/Bounds.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Transforming boxes: 8 corners vs. Arvo's method and its batched versions, plus merges
+int main() {
+	const size_t count = 4096;
+	const size_t repeats = 256;
+	const size_t items = count * repeats;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> size(0.1f, 10.0f);
+	std::vector<laml::Aabb3> boxes(count), out(count);
+	laml::soa::Vec3Array mins(count), maxs(count), out_mins(count), out_maxs(count);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen)), e(size(gen), size(gen), size(gen));
+		boxes[n] = laml::Aabb3(c - e, c + e);
+		mins.set(n, boxes[n].min);
+		maxs.set(n, boxes[n].max);
+	}
+	laml::Mat4 mat;
+	laml::transform::create_transform(mat, 30.0f, 20.0f, 10.0f, laml::Vec3(1.0f, 2.0f, 3.0f), laml::Vec3(2.0f, 2.0f, 2.0f));
+
+	printf("transform AABB, %zu boxes x %zu\n", count, repeats);
+	double corners = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Aabb3 res;
+				for (size_t k = 0; k < 8; k++) {
+					const laml::Vec3 corner((k & 1) ? boxes[n].max.x : boxes[n].min.x, (k & 2) ? boxes[n].max.y : boxes[n].min.y, (k & 4) ? boxes[n].max.z : boxes[n].min.z);
+					res = laml::merge(res, laml::transform::transform_point(mat, corner, 1.0f));
+				}
+				out[n] = res;
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("8 corners + merge", corners, items);
+
+	double arvo = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				out[n] = laml::transform::transform_aabb(mat, boxes[n]);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("transform_aabb", arvo, items, corners);
+
+	double batched = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_aabbs(mat, boxes.data(), out.data(), count);
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("transform_aabbs (AoS)", batched, items, corners);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_aabbs(mat, mins, maxs, out_mins, out_maxs);
+			bench::keep(out_maxs.x()[count - 1]);
+		}
+	});
+	bench::report("transform_aabbs (SoA)", soa, items, corners);
+
+	printf("merge, %zu boxes x %zu\n", count, repeats);
+	double merge_loop = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::Aabb3 res;
+			for (size_t n = 0; n < count; n++) {
+				res = laml::merge(res, boxes[n]);
+			}
+			bench::keep(res);
+		}
+	});
+	bench::report("merge(a, b) loop", merge_loop, items);
+
+	double merge_all = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			bench::keep(laml::merge(boxes.data(), count));
+		}
+	});
+	bench::report("merge(boxes, count)", merge_all, items, merge_loop);
+
+	double bounds = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			bench::keep(laml::soa::bounds(mins));
+		}
+	});
+	bench::report("soa::bounds (points)", bounds, items, merge_loop);
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include <laml/laml.hpp>
+#include <laml/Bvh.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// BVH build and refit, and ray/overlap queries against the brute-force loops they replace
+int main() {
+	const size_t count = 1 << 18;
+	const size_t num_rays = 1024;
+	const size_t brute_rays = 16;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> size(0.1f, 2.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<laml::Aabb3> boxes(count);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen)), e(size(gen), size(gen), size(gen));
+		boxes[n] = laml::Aabb3(c - e, c + e);
+	}
+	std::vector<laml::Ray3> rays(num_rays);
+	std::vector<laml::Aabb3> queries(num_rays);
+	for (size_t n = 0; n < num_rays; n++) {
+		rays[n] = laml::Ray3(laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(unit(gen), unit(gen), unit(gen)));
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen));
+		queries[n] = laml::Aabb3(c - laml::Vec3(10.0f), c + laml::Vec3(10.0f));
+	}
+
+	laml::Bvh<float> bvh;
+	printf("BVH, %zu boxes\n", count);
+	double build = bench::time_ns([&]() { bvh.build(boxes.data(), count); }, 3);
+	bench::report("build", build, count);
+	double build_parallel = bench::time_ns([&]() { bvh.build_parallel(boxes.data(), count); }, 3);
+	bench::report("build_parallel", build_parallel, count, build);
+	double refit = bench::time_ns([&]() { bvh.refit(boxes.data()); });
+	bench::report("refit", refit, count, build);
+
+	printf("closest hit, %zu rays\n", num_rays);
+	double brute = bench::time_ns([&]() {
+		for (size_t r = 0; r < brute_rays; r++) {
+			float best = 2000.0f;
+			for (size_t n = 0; n < count; n++) {
+				float t;
+				if (laml::intersects(rays[r], boxes[n], best, t)) {
+					best = t;
+				}
+			}
+			bench::keep(best);
+		}
+	}, 3);
+	bench::report("brute-force loop", brute, brute_rays);
+
+	double closest = bench::time_ns([&]() {
+		for (size_t r = 0; r < num_rays; r++) {
+			float t = 2000.0f;
+			bench::keep(bvh.closest_hit(rays[r], t, [&](size_t prim, float t_max) {
+				float d;
+				return laml::intersects(rays[r], boxes[prim], t_max, d) ? d : t_max;
+			}));
+		}
+	});
+	bench::report("Bvh::closest_hit", closest, num_rays, brute * num_rays / brute_rays);
+
+	printf("box overlap, %zu queries\n", num_rays);
+	double brute_overlap = bench::time_ns([&]() {
+		for (size_t q = 0; q < brute_rays; q++) {
+			size_t found = 0;
+			for (size_t n = 0; n < count; n++) {
+				found += laml::intersects(boxes[n], queries[q]) ? 1 : 0;
+			}
+			bench::keep(found);
+		}
+	}, 3);
+	bench::report("brute-force loop", brute_overlap, brute_rays);
+
+	double overlap = bench::time_ns([&]() {
+		for (size_t q = 0; q < num_rays; q++) {
+			size_t found = 0;
+			bvh.overlap(queries[q], [&](size_t) { found++; });
+			bench::keep(found);
+		}
+	});
+	bench::report("Bvh::overlap", overlap, num_rays, brute_overlap * num_rays / brute_rays);
+	return 0;
+}
@@ -0,0 +1,88 @@
+#include <laml/laml.hpp>
+#include <laml/DualQuaternion.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Skinning 4 influences per vertex: the usual hand-written matrix-palette loop vs. dual quaternions
+static void run(size_t num_bones, size_t count, size_t repeats) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+
+	std::vector<laml::Mat4> mats(num_bones);
+	std::vector<laml::DualQuat> dqs(num_bones);
+	for (size_t n = 0; n < num_bones; n++) {
+		const laml::Quat q = laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+		const laml::Vec3 t(dis(gen), dis(gen), dis(gen));
+		laml::transform::create_transform(mats[n], q, t);
+		dqs[n] = laml::DualQuat(q, t);
+	}
+	std::vector<uint16> joints(4 * count);
+	std::vector<float> weights(4 * count);
+	std::vector<laml::Vec3> positions(count), out(count);
+	for (size_t n = 0; n < count; n++) {
+		float sum = 0.0f;
+		for (size_t k = 0; k < 4; k++) {
+			joints[4 * n + k] = static_cast<uint16>(gen() % num_bones);
+			weights[4 * n + k] = weight(gen);
+			sum += weights[4 * n + k];
+		}
+		for (size_t k = 0; k < 4; k++) {
+			weights[4 * n + k] /= sum;
+		}
+		positions[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	laml::soa::Vec3Array soa_in(positions.data(), count), soa_out(count);
+	const size_t items = count * repeats;
+
+	printf("%zu bones (%zu vs. %zu bytes each), %zu vertices x %zu\n", num_bones, sizeof(laml::Mat4), sizeof(laml::DualQuat), count, repeats);
+	double matrices = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Mat4 m = mats[joints[4 * n]] * weights[4 * n];
+				for (size_t k = 1; k < 4; k++) {
+					m = m + mats[joints[4 * n + k]] * weights[4 * n + k];
+				}
+				out[n] = laml::transform::transform_point(m, positions[n], 1.0f);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("blended Mat4 + transform_point", matrices, items);
+
+	double scalar = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				const laml::DualQuat influences[4] = { dqs[joints[4 * n]], dqs[joints[4 * n + 1]], dqs[joints[4 * n + 2]], dqs[joints[4 * n + 3]] };
+				out[n] = laml::transform::transform_point(laml::blend(influences, &weights[4 * n], 4), positions[n]);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("blend + transform_point (DualQuat)", scalar, items, matrices);
+
+	double aos = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::skin_dq(dqs.data(), joints.data(), weights.data(), laml::soa::view(positions.data(), count), laml::soa::view(out.data(), count));
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("skin_dq (AoS)", aos, items, matrices);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::skin_dq(dqs.data(), joints.data(), weights.data(), soa_in, soa_out);
+			bench::keep(soa_out.x()[count - 1]);
+		}
+	});
+	bench::report("skin_dq (SoA)", soa, items, matrices);
+}
+
+int main() {
+	run(64, 16384, 16);
+	run(256, 1 << 18, 2);
+	return 0;
+}
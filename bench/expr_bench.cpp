@@ -0,0 +1,127 @@
+#include <laml/laml.hpp>
+#include <laml/Expr.hpp>
+#include <laml/MatrixX.hpp>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// VectorX storage comes from the aligned operator new, so counting calls counts the temporaries
+static size_t allocations = 0;
+
+void* operator new(std::size_t size, std::align_val_t align) {
+	allocations++;
+	const size_t a = static_cast<size_t>(align);
+	void* p = std::aligned_alloc(a, (size + a - 1) / a * a);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+void operator delete(void* p, std::align_val_t) noexcept {
+	std::free(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+	std::free(p);
+}
+
+using laml::expr::lazy;
+
+// a * s + b * t - c and lerp over an array of Vector<float, size>, plain operators vs. expr
+template<size_t size>
+static void run_fixed(size_t count, size_t repeats) {
+	typedef laml::Vector<float, size> V;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+	std::vector<V> a(count), b(count), c(count), out(count);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < size; k++) {
+			a[n][k] = dis(gen);
+			b[n][k] = dis(gen);
+			c[n][k] = dis(gen);
+		}
+	}
+	const float s = 0.75f, t = -1.25f;
+	const size_t items = count * repeats;
+
+	printf("Vector<float, %zu>, %zu vectors x %zu\n", size, count, repeats);
+	double plain = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				out[n] = a[n] * s + b[n] * t - c[n];
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("a * s + b * t - c", plain, items);
+	double fused = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::expr::assign(out[n], lazy(a[n]) * s + lazy(b[n]) * t - c[n]);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("a * s + b * t - c, expr", fused, items, plain);
+
+	plain = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				out[n] = laml::lerp(a[n], b[n], 0.3f);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("lerp", plain, items);
+	fused = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::expr::assign(out[n], laml::expr::lerp(a[n], b[n], 0.3f));
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("lerp, expr", fused, items, plain);
+}
+
+// the same on runtime-sized vectors, where every temporary is also a heap allocation
+static void run_dynamic(size_t size, size_t repeats) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-1.0, 1.0);
+	laml::VectorX<double> a(size), b(size), c(size), out(size);
+	for (size_t n = 0; n < size; n++) {
+		a[n] = dis(gen);
+		b[n] = dis(gen);
+		c[n] = dis(gen);
+	}
+
+	printf("VectorX<double>(%zu) x %zu\n", size, repeats);
+	size_t before = allocations;
+	double plain = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			out = a * 0.75 + b * -1.25 - c;
+			bench::keep(out[size - 1]);
+		}
+	});
+	const double plain_allocs = static_cast<double>(allocations - before) / static_cast<double>(10 * repeats);
+	bench::report("a * s + b * t - c", plain, size * repeats);
+
+	before = allocations;
+	double fused = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::expr::assign(out, lazy(a) * 0.75 + lazy(b) * -1.25 - c);
+			bench::keep(out[size - 1]);
+		}
+	});
+	const double fused_allocs = static_cast<double>(allocations - before) / static_cast<double>(10 * repeats);
+	bench::report("a * s + b * t - c, expr", fused, size * repeats, plain);
+	printf("%-48s %10.1f plain, %.1f expr\n", "allocations per evaluation", plain_allocs, fused_allocs);
+}
+
+int main() {
+	run_fixed<3>(4096, 64);
+	run_fixed<16>(1024, 64);
+	run_fixed<256>(64, 64);
+	run_dynamic(1 << 16, 16);
+	return 0;
+}
@@ -0,0 +1,179 @@
+#include <laml/laml.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+static std::vector<float> random_values(size_t count, float lo, float hi, std::mt19937& gen) {
+	std::uniform_real_distribution<float> dis(lo, hi);
+	std::vector<float> res(count);
+	for (float& v : res) {
+		v = dis(gen);
+	}
+	return res;
+}
+
+// laml::fast against the <cmath> calls, per value over arrays, and the precise/fast policies of the hot builders
+int main() {
+	std::mt19937 gen(1234);
+	const size_t count = 4096;
+	std::vector<float> out(count), out2(count);
+
+	const std::vector<float> angles = random_values(count, -10.0f, 10.0f, gen);
+	const std::vector<float> units = random_values(count, -1.0f, 1.0f, gen);
+	const std::vector<float> exponents = random_values(count, -20.0f, 20.0f, gen);
+	const std::vector<float> positives = random_values(count, 1e-3f, 1e3f, gen);
+	const std::vector<float> ys = random_values(count, -1.0f, 1.0f, gen);
+
+	printf("functions, float, %zu values\n", count);
+	double ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = std::sin(angles[n]);
+		}
+		bench::keep(out[count - 1]);
+	});
+	bench::report("std::sin", ref, count);
+	double fast = bench::time_ns([&]() {
+		laml::fast::sin(angles.data(), out.data(), count);
+		bench::keep(out[count - 1]);
+	});
+	bench::report("fast::sin", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = std::sin(angles[n]);
+			out2[n] = std::cos(angles[n]);
+		}
+		bench::keep(out2[count - 1]);
+	});
+	bench::report("std::sin + std::cos", ref, count);
+	fast = bench::time_ns([&]() {
+		laml::fast::sincos(angles.data(), out.data(), out2.data(), count);
+		bench::keep(out2[count - 1]);
+	});
+	bench::report("fast::sincos", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = std::atan2(ys[n], units[n]);
+		}
+		bench::keep(out[count - 1]);
+	});
+	bench::report("std::atan2", ref, count);
+	fast = bench::time_ns([&]() {
+		laml::fast::atan2(ys.data(), units.data(), out.data(), count);
+		bench::keep(out[count - 1]);
+	});
+	bench::report("fast::atan2", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = std::acos(units[n]);
+		}
+		bench::keep(out[count - 1]);
+	});
+	bench::report("std::acos", ref, count);
+	fast = bench::time_ns([&]() {
+		laml::fast::acos(units.data(), out.data(), count);
+		bench::keep(out[count - 1]);
+	});
+	bench::report("fast::acos", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = std::exp(exponents[n]);
+		}
+		bench::keep(out[count - 1]);
+	});
+	bench::report("std::exp", ref, count);
+	fast = bench::time_ns([&]() {
+		laml::fast::exp(exponents.data(), out.data(), count);
+		bench::keep(out[count - 1]);
+	});
+	bench::report("fast::exp", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			out[n] = 1.0f / std::sqrt(positives[n]);
+		}
+		bench::keep(out[count - 1]);
+	});
+	bench::report("1 / std::sqrt", ref, count);
+	fast = bench::time_ns([&]() {
+		laml::fast::rsqrt(positives.data(), out.data(), count);
+		bench::keep(out[count - 1]);
+	});
+	bench::report("fast::rsqrt", fast, count, ref);
+
+	// one value at a time, the way the policies call them
+	std::vector<laml::Vec3> vecs(count), vec_out(count);
+	std::vector<laml::Quat> quats(count), quat_out(count);
+	std::vector<laml::Mat3> mats(count);
+	for (size_t n = 0; n < count; n++) {
+		vecs[n] = laml::Vec3(angles[n], units[n], exponents[n]);
+		quats[n] = laml::transform::quat_from_ypr(angles[n] * 18.0f, units[n] * 90.0f, exponents[n] * 9.0f);
+	}
+
+	printf("policies, precise vs fast, %zu calls\n", count);
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			vec_out[n] = laml::normalize(vecs[n], laml::math::precise());
+		}
+		bench::keep(vec_out[count - 1]);
+	});
+	bench::report("normalize", ref, count);
+	fast = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			vec_out[n] = laml::normalize(vecs[n], laml::math::fast());
+		}
+		bench::keep(vec_out[count - 1]);
+	});
+	bench::report("normalize, fast", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			laml::transform::create_transform_rotation(mats[n], angles[n] * 18.0f, units[n] * 90.0f, exponents[n] * 9.0f, laml::math::precise());
+		}
+		bench::keep(mats[count - 1]);
+	});
+	bench::report("create_transform_rotation", ref, count);
+	fast = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			laml::transform::create_transform_rotation(mats[n], angles[n] * 18.0f, units[n] * 90.0f, exponents[n] * 9.0f, laml::math::fast());
+		}
+		bench::keep(mats[count - 1]);
+	});
+	bench::report("create_transform_rotation, fast", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			quat_out[n] = laml::transform::quat_from_ypr(angles[n] * 18.0f, units[n] * 90.0f, exponents[n] * 9.0f, laml::math::precise());
+		}
+		bench::keep(quat_out[count - 1]);
+	});
+	bench::report("quat_from_ypr", ref, count);
+	fast = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			quat_out[n] = laml::transform::quat_from_ypr(angles[n] * 18.0f, units[n] * 90.0f, exponents[n] * 9.0f, laml::math::fast());
+		}
+		bench::keep(quat_out[count - 1]);
+	});
+	bench::report("quat_from_ypr, fast", fast, count, ref);
+
+	ref = bench::time_ns([&]() {
+		for (size_t n = 0; n + 1 < count; n++) {
+			quat_out[n] = laml::slerp(quats[n], quats[n + 1], units[n] * 0.5f + 0.5f, laml::math::precise());
+		}
+		bench::keep(quat_out[count - 2]);
+	});
+	bench::report("slerp", ref, count - 1);
+	fast = bench::time_ns([&]() {
+		for (size_t n = 0; n + 1 < count; n++) {
+			quat_out[n] = laml::slerp(quats[n], quats[n + 1], units[n] * 0.5f + 0.5f, laml::math::fast());
+		}
+		bench::keep(quat_out[count - 2]);
+	});
+	bench::report("slerp, fast", fast, count - 1, ref);
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include <laml/laml.hpp>
+#include <laml/Frustum.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Culling 1M objects: a per-object loop vs. the batched bitmask kernels
+int main() {
+	const size_t count = 1 << 20;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> size(0.5f, 5.0f);
+	std::vector<laml::Vec3> centers(count), extents(count);
+	std::vector<float> radii(count);
+	for (size_t n = 0; n < count; n++) {
+		centers[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		extents[n] = laml::Vec3(size(gen), size(gen), size(gen));
+		radii[n] = size(gen);
+	}
+	laml::soa::Vec3Array soa_centers(centers.data(), count), soa_extents(extents.data(), count);
+
+	laml::Mat4 proj, camera, view;
+	laml::transform::create_projection_perspective(proj, 60.0f, 16.0f / 9.0f, 0.1f, 300.0f);
+	laml::transform::create_transform(camera, 30.0f, 10.0f, 0.0f, laml::Vec3(0.0f, 5.0f, 0.0f));
+	laml::transform::create_view_matrix_from_transform(view, camera);
+	const laml::Frustum<float> frustum(laml::mul(proj, view));
+
+	std::vector<uint32> visible(laml::cull_mask_words(count));
+	printf("frustum culling, %zu objects\n", count);
+
+	double spheres = bench::time_ns([&]() {
+		for (size_t w = 0; w < visible.size(); w++) {
+			visible[w] = 0;
+		}
+		for (size_t n = 0; n < count; n++) {
+			visible[n / 32] |= uint32(laml::intersects_sphere(frustum, centers[n], radii[n])) << (n % 32);
+		}
+		bench::keep(visible[0]);
+	});
+	bench::report("intersects_sphere loop", spheres, count);
+
+	double batched_spheres = bench::time_ns([&]() {
+		laml::cull_spheres(frustum, soa_centers, radii.data(), visible.data());
+		bench::keep(visible[0]);
+	});
+	bench::report("cull_spheres (SoA)", batched_spheres, count, spheres);
+
+	double threaded_spheres = bench::time_ns([&]() {
+		laml::parallel::cull_spheres(frustum, soa_centers, radii.data(), visible.data());
+		bench::keep(visible[0]);
+	});
+	bench::report("parallel::cull_spheres (SoA)", threaded_spheres, count, spheres);
+
+	double boxes = bench::time_ns([&]() {
+		for (size_t w = 0; w < visible.size(); w++) {
+			visible[w] = 0;
+		}
+		for (size_t n = 0; n < count; n++) {
+			visible[n / 32] |= uint32(laml::intersects_aabb(frustum, centers[n], extents[n])) << (n % 32);
+		}
+		bench::keep(visible[0]);
+	});
+	bench::report("intersects_aabb loop", boxes, count);
+
+	double batched_boxes = bench::time_ns([&]() {
+		laml::cull_aabbs(frustum, soa_centers, soa_extents, visible.data());
+		bench::keep(visible[0]);
+	});
+	bench::report("cull_aabbs (SoA)", batched_boxes, count, boxes);
+
+	double threaded_boxes = bench::time_ns([&]() {
+		laml::parallel::cull_aabbs(frustum, soa_centers, soa_extents, visible.data());
+		bench::keep(visible[0]);
+	});
+	bench::report("parallel::cull_aabbs (SoA)", threaded_boxes, count, boxes);
+	return 0;
+}
@@ -0,0 +1,66 @@
+#include <laml/laml.hpp>
+#include <laml/Hierarchy.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// World matrix update of a 100k node scene: naive full recompute vs. TransformHierarchy
+int main() {
+	const size_t num_nodes = 100000;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+	laml::TransformHierarchy<float> h;
+	h.reserve(num_nodes);
+	// a scene of 64-node objects, each a small random tree under its own root
+	const size_t object_size = 64;
+	for (size_t n = 0; n < num_nodes; n++) {
+		const size_t root = n - n % object_size;
+		size_t parent = (n == root) ? h.npos : std::uniform_int_distribution<size_t>(root, n - 1)(gen);
+		h.add_node(parent, laml::normalize(laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen))),
+			laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(1.0f));
+	}
+	h.update();
+
+	printf("world update, %zu nodes\n", num_nodes);
+	std::vector<laml::Mat4> worlds(num_nodes);
+	double naive = bench::time_ns([&]() {
+		for (size_t n = 0; n < num_nodes; n++) {
+			laml::Mat4 local;
+			laml::transform::create_transform(local, h.rotation(n), h.translation(n), h.scale(n));
+			worlds[n] = (h.parent(n) == h.npos) ? local : laml::mul(worlds[h.parent(n)], local);
+		}
+		bench::keep(worlds[num_nodes - 1]);
+	});
+	bench::report("create_transform + mul, every node", naive, num_nodes);
+
+	double full = bench::time_ns([&]() {
+		for (size_t n = 0; n < num_nodes; n++) {
+			h.set_scale(n, laml::Vec3(1.0f));
+		}
+		h.update();
+		bench::keep(h.world(num_nodes - 1));
+	});
+	bench::report("TransformHierarchy::update, all dirty", full, num_nodes, naive);
+
+	double threaded = bench::time_ns([&]() {
+		for (size_t n = 0; n < num_nodes; n++) {
+			h.set_scale(n, laml::Vec3(1.0f));
+		}
+		h.update_parallel();
+		bench::keep(h.world(num_nodes - 1));
+	});
+	bench::report("TransformHierarchy::update_parallel, all dirty", threaded, num_nodes, naive);
+
+	double partial = bench::time_ns([&]() {
+		// animate 1% of the nodes, spread over the second half of the scene
+		for (size_t n = num_nodes / 2 + 7; n < num_nodes; n += 50) {
+			h.set_translation(n, laml::Vec3(0.5f));
+		}
+		h.update();
+		bench::keep(h.world(num_nodes - 1));
+	});
+	bench::report("TransformHierarchy::update, 1% dirty", partial, num_nodes, naive);
+	return 0;
+}
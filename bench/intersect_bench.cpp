@@ -0,0 +1,97 @@
+#include <laml/laml.hpp>
+#include <laml/Intersect.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Rays against a triangle soup and a box: scalar loops vs. the packet/stream kernels
+int main() {
+	const size_t count = 1 << 16;
+	const size_t num_triangles = 256;
+	const size_t tests = count * num_triangles;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<laml::Ray3> rays(count);
+	laml::soa::Vec3Array origins(count), directions(count), inv_directions(count);
+	for (size_t n = 0; n < count; n++) {
+		rays[n] = laml::Ray3(laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(unit(gen), unit(gen), unit(gen)));
+		origins.set(n, rays[n].origin);
+		directions.set(n, rays[n].direction);
+		inv_directions.set(n, rays[n].inv_direction);
+	}
+	std::vector<laml::Vec3> soup(3 * num_triangles);
+	for (size_t n = 0; n < soup.size(); n++) {
+		soup[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	const laml::RayStream<float> stream{ origins, directions, inv_directions };
+	std::vector<float> t(count), u(count), v(count);
+	std::vector<uint32> tri(count);
+
+	printf("closest triangle, %zu rays x %zu triangles\n", count, num_triangles);
+	double scalar = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			float best = 100.0f, bu = 0.0f, bv = 0.0f;
+			uint32 hit = ~0u;
+			for (size_t i = 0; i < num_triangles; i++) {
+				if (laml::intersects_triangle(rays[n], soup[3 * i], soup[3 * i + 1], soup[3 * i + 2], best, bu, bv)) {
+					hit = static_cast<uint32>(i);
+				}
+			}
+			tri[n] = hit;
+		}
+		bench::keep(tri[count - 1]);
+	}, 3);
+	bench::report("intersects_triangle loop", scalar, tests);
+
+	double aos = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			t[n] = 100.0f;
+		}
+		laml::intersect_triangles(laml::soa::view(rays.data(), count), soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data());
+		bench::keep(tri[count - 1]);
+	}, 3);
+	bench::report("intersect_triangles (Ray array)", aos, tests, scalar);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			t[n] = 100.0f;
+		}
+		laml::intersect_triangles(stream, soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data());
+		bench::keep(tri[count - 1]);
+	}, 3);
+	bench::report("intersect_triangles (SoA)", soa, tests, scalar);
+
+	double threaded = bench::time_ns([&]() {
+		for (size_t n = 0; n < count; n++) {
+			t[n] = 100.0f;
+		}
+		laml::parallel::intersect_triangles(stream, soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data());
+		bench::keep(tri[count - 1]);
+	}, 3);
+	bench::report("parallel::intersect_triangles (SoA)", threaded, tests, scalar);
+
+	const laml::Aabb3 box(laml::Vec3(-3.0f), laml::Vec3(4.0f));
+	std::vector<float> t_max(count, 20.0f);
+	std::vector<uint32> hits(laml::hit_mask_words(count));
+	printf("ray/box, %zu rays\n", count);
+	double slab = bench::time_ns([&]() {
+		for (size_t w = 0; w < hits.size(); w++) {
+			hits[w] = 0;
+		}
+		for (size_t n = 0; n < count; n++) {
+			hits[n / 32] |= uint32(laml::intersects(rays[n], box, t_max[n])) << (n % 32);
+		}
+		bench::keep(hits[0]);
+	});
+	bench::report("intersects(ray, box) loop", slab, count);
+
+	double slab_stream = bench::time_ns([&]() {
+		laml::intersects_aabb(stream, box, t_max.data(), hits.data());
+		bench::keep(hits[0]);
+	});
+	bench::report("intersects_aabb (SoA)", slab_stream, count, slab);
+	return 0;
+}
@@ -0,0 +1,177 @@
+#include <laml/laml.hpp>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+/* Per-function microbenchmarks for the hot paths, in float and double.
+* Each case runs its function over an array of random inputs and reports ns/op and Mops/s.
+*
+*   laml_bench [--filter <text>] [--passes <n>] [--csv <out.csv>] [--compare <baseline.csv>]
+*
+* --csv saves the results; --compare reads a file saved by another build and adds the speedup
+* against it to every line, so two laml versions can be compared case by case.
+* */
+
+namespace {
+	const size_t count = 1024; // inputs per case, small enough to stay in L1/L2
+
+	struct Suite {
+		const char* filter = nullptr;
+		size_t passes = 256;
+		std::map<std::string, double> baseline;
+		std::vector<bench::Result> results;
+
+		// out[n] = op(n) over all inputs, passes times
+		template<typename R, typename F>
+		void run(const std::string& name, F op) {
+			if (filter && name.find(filter) == std::string::npos) {
+				return;
+			}
+			std::vector<R> out(count);
+			const size_t items = count * passes;
+			const double ns = bench::time_ns([&]() {
+				for (size_t r = 0; r < passes; r++) {
+					for (size_t n = 0; n < count; n++) {
+						out[n] = op(n);
+					}
+					bench::keep(out[count - 1]);
+				}
+			});
+
+			auto base = baseline.find(name);
+			bench::report(name.c_str(), ns, items, base == baseline.end() ? 0.0 : base->second * items);
+			results.push_back({ name, ns / items });
+		}
+	};
+
+	template<typename T> const char* type_name();
+	template<> const char* type_name<float>() { return "float"; }
+	template<> const char* type_name<double>() { return "double"; }
+
+	template<typename T, size_t rows, size_t cols>
+	std::vector<laml::Matrix<T, rows, cols>> random_matrices(std::mt19937& gen) {
+		std::uniform_real_distribution<T> dis(static_cast<T>(-1.0), static_cast<T>(1.0));
+		std::vector<laml::Matrix<T, rows, cols>> mats(count);
+		for (size_t n = 0; n < count; n++) {
+			for (size_t col = 0; col < cols; col++) {
+				for (size_t row = 0; row < rows; row++) {
+					mats[n][col][row] = dis(gen);
+				}
+			}
+		}
+		return mats;
+	}
+
+	template<typename T>
+	void run_all(Suite& suite) {
+		typedef laml::Matrix<T, 2, 2> M2;
+		typedef laml::Matrix<T, 3, 3> M3;
+		typedef laml::Matrix<T, 4, 4> M4;
+		typedef laml::Vector<T, 3> V3;
+		typedef laml::Quaternion<T> Q;
+		const std::string suffix = std::string(" ") + type_name<T>();
+
+		std::mt19937 gen(1234);
+		std::uniform_real_distribution<T> dis(static_cast<T>(-1.0), static_cast<T>(1.0));
+
+		const auto a2 = random_matrices<T, 2, 2>(gen), b2 = random_matrices<T, 2, 2>(gen);
+		const auto a3 = random_matrices<T, 3, 3>(gen), b3 = random_matrices<T, 3, 3>(gen);
+		const auto a4 = random_matrices<T, 4, 4>(gen), b4 = random_matrices<T, 4, 4>(gen);
+		const auto a5 = random_matrices<T, 5, 5>(gen), b5 = random_matrices<T, 5, 5>(gen);
+
+		std::vector<V3> v1(count), v2(count), trans(count), scales(count);
+		std::vector<Q> q1(count), q2(count);
+		std::vector<M3> rots(count);
+		std::vector<M4> transforms(count);
+		for (size_t n = 0; n < count; n++) {
+			v1[n] = V3(dis(gen), dis(gen), dis(gen));
+			v2[n] = V3(dis(gen), dis(gen), dis(gen));
+			trans[n] = V3(dis(gen), dis(gen), dis(gen)) * static_cast<T>(100.0);
+			scales[n] = V3(dis(gen), dis(gen), dis(gen)) + V3(static_cast<T>(2.0));
+			q1[n] = laml::normalize(Q(dis(gen), dis(gen), dis(gen), dis(gen)));
+			q2[n] = laml::normalize(Q(dis(gen), dis(gen), dis(gen), dis(gen)));
+			laml::transform::create_transform_rotation(rots[n], q1[n]);
+			laml::transform::create_transform(transforms[n], q1[n], trans[n], scales[n]);
+		}
+
+		suite.template run<M2>("mul Mat2" + suffix, [&](size_t n) { return laml::mul(a2[n], b2[n]); });
+		suite.template run<M3>("mul Mat3" + suffix, [&](size_t n) { return laml::mul(a3[n], b3[n]); });
+		suite.template run<M4>("mul Mat4" + suffix, [&](size_t n) { return laml::mul(a4[n], b4[n]); });
+		suite.template run<laml::Matrix<T, 5, 5>>("mul generic 5x5" + suffix, [&](size_t n) { return laml::mul(a5[n], b5[n]); });
+
+		suite.template run<T>("det Mat2" + suffix, [&](size_t n) { return laml::det(a2[n]); });
+		suite.template run<T>("det Mat3" + suffix, [&](size_t n) { return laml::det(a3[n]); });
+		suite.template run<T>("det Mat4" + suffix, [&](size_t n) { return laml::det(a4[n]); });
+		suite.template run<T>("det generic 5x5" + suffix, [&](size_t n) { return laml::det(a5[n]); });
+
+		suite.template run<M2>("inverse Mat2" + suffix, [&](size_t n) { return laml::inverse(a2[n]); });
+		suite.template run<M3>("inverse Mat3" + suffix, [&](size_t n) { return laml::inverse(a3[n]); });
+		suite.template run<M4>("inverse Mat4" + suffix, [&](size_t n) { return laml::inverse(a4[n]); });
+		suite.template run<laml::Matrix<T, 5, 5>>("inverse generic 5x5" + suffix, [&](size_t n) { return laml::inverse(a5[n]); });
+		suite.template run<laml::Vector<T, 5>>("solve generic 5x5" + suffix, [&](size_t n) { return laml::solve(a5[n], b5[n][0]); });
+
+		suite.template run<V3>("transform_point Mat4" + suffix, [&](size_t n) {
+			return laml::transform::transform_point(transforms[n], v1[n], static_cast<T>(1.0));
+		});
+		suite.template run<Q>("quat_from_mat" + suffix, [&](size_t n) { return laml::transform::quat_from_mat(rots[n]); });
+		suite.template run<Q>("slerp" + suffix, [&](size_t n) { return laml::slerp(q1[n], q2[n], static_cast<T>(0.3)); });
+		suite.template run<M3>("decompose Mat4" + suffix, [&](size_t n) {
+			M3 rot;
+			V3 t, s;
+			laml::transform::decompose(transforms[n], rot, t, s);
+			return rot;
+		});
+
+		suite.template run<V3>("normalize Vec3" + suffix, [&](size_t n) { return laml::normalize(v1[n]); });
+		suite.template run<Q>("normalize Quat" + suffix, [&](size_t n) { return laml::normalize(q1[n]); });
+		suite.template run<V3>("cross" + suffix, [&](size_t n) { return laml::cross(v1[n], v2[n]); });
+	}
+}
+
+int main(int argc, char** argv) {
+	Suite suite;
+	const char* csv_path = nullptr;
+	const char* compare_path = nullptr;
+	for (int n = 1; n < argc; n++) {
+		const bool has_value = n + 1 < argc;
+		if (has_value && strcmp(argv[n], "--filter") == 0) {
+			suite.filter = argv[++n];
+		}
+		else if (has_value && strcmp(argv[n], "--passes") == 0) {
+			suite.passes = strtoul(argv[++n], nullptr, 10);
+		}
+		else if (has_value && strcmp(argv[n], "--csv") == 0) {
+			csv_path = argv[++n];
+		}
+		else if (has_value && strcmp(argv[n], "--compare") == 0) {
+			compare_path = argv[++n];
+		}
+		else {
+			printf("usage: %s [--filter <text>] [--passes <n>] [--csv <out.csv>] [--compare <baseline.csv>]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (suite.passes == 0) {
+		suite.passes = 1;
+	}
+	if (compare_path) {
+		suite.baseline = bench::read_csv(compare_path);
+		if (suite.baseline.empty()) {
+			printf("could not read %s\n", compare_path);
+			return 1;
+		}
+		printf("speedups are relative to %s\n", compare_path);
+	}
+
+	printf("%zu inputs x %zu passes per case\n", count, suite.passes);
+	run_all<float>(suite);
+	run_all<double>(suite);
+
+	if (csv_path && !bench::write_csv(csv_path, suite.results)) {
+		printf("could not write %s\n", csv_path);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,66 @@
+#include <laml/laml.hpp>
+#include <laml/MatrixX.hpp>
+#include <random>
+
+#include "bench.hpp"
+
+template<typename T>
+static laml::MatrixX<T> random_matrix(size_t rows, size_t cols, std::mt19937& gen) {
+	std::uniform_real_distribution<T> dis(static_cast<T>(-1.0), static_cast<T>(1.0));
+	laml::MatrixX<T> res(rows, cols);
+	for (size_t c = 0; c < cols; c++) {
+		for (size_t r = 0; r < rows; r++) {
+			res(r, c) = dis(gen);
+		}
+	}
+	return res;
+}
+
+// Runtime-sized products and solves: blocked gemm against the triple loop, and the three factorizations
+int main() {
+	std::mt19937 gen(1234);
+
+	for (size_t n : { 64, 256 }) {
+		const laml::MatX a = random_matrix<float>(n, n, gen);
+		const laml::MatX b = random_matrix<float>(n, n, gen);
+		laml::MatX c(n, n);
+		const size_t flops = 2 * n * n * n;
+		printf("gemm %zux%zu (items = flops)\n", n, n);
+
+		// the loop order of the fixed-size mul
+		double naive = bench::time_ns([&]() {
+			for (size_t col = 0; col < n; col++) {
+				for (size_t row = 0; row < n; row++) {
+					float sum = 0.0f;
+					for (size_t k = 0; k < n; k++) {
+						sum = sum + a(row, k) * b(k, col);
+					}
+					c(row, col) = sum;
+				}
+			}
+			bench::keep(c(n - 1, n - 1));
+		}, 3);
+		bench::report("triple loop", naive, flops);
+
+		double blocked = bench::time_ns([&]() {
+			laml::gemm(a, b, c);
+			bench::keep(c(n - 1, n - 1));
+		}, 3);
+		bench::report("gemm", blocked, flops, naive);
+	}
+
+	const size_t n = 200;
+	const laml::MatX_highp m = random_matrix<double>(n, n, gen);
+	laml::MatX_highp spd(n, n);
+	laml::identity(spd);
+	laml::gemm(m, laml::transpose(m), spd, 1.0, static_cast<double>(n));
+	const laml::VecX_highp rhs(random_matrix<double>(n, 1, gen));
+	printf("factor and solve, %zux%zu double\n", n, n);
+	double lu = bench::time_ns([&]() { bench::keep(laml::solve(laml::lu(spd), rhs)[0]); });
+	bench::report("lu + solve", lu, 1);
+	double chol = bench::time_ns([&]() { bench::keep(laml::solve(laml::cholesky(spd), rhs)[0]); });
+	bench::report("cholesky + solve", chol, 1, lu);
+	double householder = bench::time_ns([&]() { bench::keep(laml::solve(laml::qr(spd), rhs)[0]); });
+	bench::report("qr + solve", householder, 1, lu);
+	return 0;
+}
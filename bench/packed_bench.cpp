@@ -0,0 +1,60 @@
+#include <laml/laml.hpp>
+#include <laml/Packed.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Batch encode/decode throughput of the packed storage types, against copying the float data
+int main() {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+	const size_t count = 1 << 20;
+	std::vector<laml::Vec3> vecs(count), vecs_out(count);
+	std::vector<laml::Quat> quats(count), quats_out(count);
+	for (size_t n = 0; n < count; n++) {
+		vecs[n] = laml::normalize(laml::Vec3(dis(gen), dis(gen), dis(gen)));
+		quats[n] = laml::normalize(laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen)));
+	}
+	std::vector<laml::packed::Vec3_half> halves(count);
+	std::vector<laml::packed::Vec3_snorm16> snorms(count);
+	std::vector<laml::packed::Vec3_unorm8> unorms(count);
+	std::vector<laml::packed::Vec3_oct> octs(count);
+	std::vector<laml::packed::Quat_smallest3> s3(count);
+
+	printf("%zu vectors / quaternions\n", count);
+	double copy = bench::time_ns([&]() {
+		vecs_out = vecs;
+		bench::keep(vecs_out[count - 1]);
+	});
+	bench::report("copy Vec3", copy, count);
+
+	double ns = bench::time_ns([&]() { laml::packed::encode(vecs.data(), halves.data(), count); bench::keep(halves[count - 1]); });
+	bench::report("encode Vec3_half", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::decode(halves.data(), vecs_out.data(), count); bench::keep(vecs_out[count - 1]); });
+	bench::report("decode Vec3_half", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::encode(vecs.data(), snorms.data(), count); bench::keep(snorms[count - 1]); });
+	bench::report("encode Vec3_snorm16", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::decode(snorms.data(), vecs_out.data(), count); bench::keep(vecs_out[count - 1]); });
+	bench::report("decode Vec3_snorm16", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::encode(vecs.data(), unorms.data(), count); bench::keep(unorms[count - 1]); });
+	bench::report("encode Vec3_unorm8", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::decode(unorms.data(), vecs_out.data(), count); bench::keep(vecs_out[count - 1]); });
+	bench::report("decode Vec3_unorm8", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::encode(vecs.data(), octs.data(), count); bench::keep(octs[count - 1]); });
+	bench::report("encode Vec3_oct", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::decode(octs.data(), vecs_out.data(), count); bench::keep(vecs_out[count - 1]); });
+	bench::report("decode Vec3_oct", ns, count, copy);
+
+	copy = bench::time_ns([&]() {
+		quats_out = quats;
+		bench::keep(quats_out[count - 1]);
+	});
+	bench::report("copy Quat", copy, count);
+	ns = bench::time_ns([&]() { laml::packed::encode(quats.data(), s3.data(), count); bench::keep(s3[count - 1]); });
+	bench::report("encode Quat_smallest3", ns, count, copy);
+	ns = bench::time_ns([&]() { laml::packed::decode(s3.data(), quats_out.data(), count); bench::keep(quats_out[count - 1]); });
+	bench::report("decode Quat_smallest3", ns, count, copy);
+	return 0;
+}
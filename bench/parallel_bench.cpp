@@ -0,0 +1,72 @@
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+// Runs fn() on 1, 2, ... max_concurrency() threads of the global pool, each against the single-threaded time
+template<typename F>
+static void scale(const char* name, size_t items, F&& fn) {
+	laml::parallel::ThreadPool& pool = laml::parallel::ThreadPool::global();
+	double single = 0.0;
+	for (size_t threads = 1; threads <= pool.max_concurrency(); threads++) {
+		pool.set_concurrency(threads);
+		const double ns = bench::time_ns(fn);
+		if (threads == 1) {
+			single = ns;
+		}
+		const std::string label = std::string(name) + ", " + std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+		bench::report(label.c_str(), ns, items, single);
+	}
+	pool.set_concurrency(0);
+}
+
+// Scaling of the parallel:: kernels from one thread up to every hardware thread
+int main() {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> unit(0.5f, 4.0f);
+
+	const size_t count = 1 << 20;
+	std::vector<laml::Mat4> mats(count), mats_out(count);
+	std::vector<laml::Mat3> rots(count);
+	std::vector<laml::Vec3> points(count), points_out(count), trans(count), scales(count);
+	std::vector<laml::Quat> quats(count);
+	for (size_t n = 0; n < count; n++) {
+		laml::transform::create_transform(mats[n], dis(gen), dis(gen), dis(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)),
+										  laml::Vec3(unit(gen), unit(gen), unit(gen)));
+		laml::transform::create_transform_rotation(rots[n], dis(gen), dis(gen), dis(gen));
+		points[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	laml::soa::Vec3Array soa_in(points.data(), count), soa_out(count);
+	const laml::Mat4 parent = mats[0];
+
+	printf("%zu items, %zu hardware threads\n", count, laml::parallel::ThreadPool::global().max_concurrency());
+	scale("transform_points (SoA)", count, [&]() {
+		laml::parallel::transform_points(parent, soa_in, soa_out, 1.0f);
+		bench::keep(soa_out.x()[count - 1]);
+	});
+	scale("transform_points (AoS)", count, [&]() {
+		laml::parallel::transform_points(parent, points.data(), points_out.data(), count, 1.0f);
+		bench::keep(points_out[count - 1]);
+	});
+	scale("mul(Mat4, Mat4*)", count, [&]() {
+		laml::parallel::mul(parent, mats.data(), mats_out.data(), count);
+		bench::keep(mats_out[count - 1]);
+	});
+	scale("normalize (SoA)", count, [&]() {
+		laml::parallel::normalize(soa_in, soa_out);
+		bench::keep(soa_out.x()[count - 1]);
+	});
+	scale("quat_from_mat", count, [&]() {
+		laml::parallel::quat_from_mat(rots.data(), quats.data(), count);
+		bench::keep(quats[count - 1]);
+	});
+	scale("decompose", count, [&]() {
+		laml::parallel::decompose(mats.data(), rots.data(), trans.data(), scales.data(), count);
+		bench::keep(trans[count - 1]);
+	});
+	return 0;
+}
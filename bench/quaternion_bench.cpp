@@ -0,0 +1,84 @@
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Rotating vectors: quaternion -> matrix -> transform_point vs. rotate() and its batched versions
+int main() {
+	const size_t count = 4096;
+	const size_t repeats = 256;
+	const size_t items = count * repeats;
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+	std::vector<laml::Quat> quats(count), quats_out(count);
+	std::vector<laml::Vec3> vecs(count), out(count);
+	for (size_t n = 0; n < count; n++) {
+		quats[n] = laml::normalize(laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen)));
+		vecs[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	laml::soa::QuatArray soa_quats(count), soa_quats_out(count);
+	laml::soa::copy(laml::soa::view(quats.data(), count), soa_quats);
+	laml::soa::Vec3Array soa_vecs(vecs.data(), count), soa_out(count);
+
+	printf("rotate, %zu vectors x %zu\n", count, repeats);
+	double via_matrix = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Mat3 rot;
+				laml::transform::create_transform_rotation(rot, quats[n]);
+				out[n] = laml::transform::transform_point(rot, vecs[n]);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("quat -> Mat3 -> transform_point", via_matrix, items);
+
+	double scalar = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::rotate(quats.data(), vecs.data(), out.data(), count);
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("rotate (AoS)", scalar, items, via_matrix);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::soa::rotate(soa_quats, soa_vecs, soa_out);
+			bench::keep(soa_out.x()[count - 1]);
+		}
+	});
+	bench::report("soa::rotate", soa, items, via_matrix);
+
+	printf("mul, %zu quaternions x %zu\n", count, repeats);
+	double mul_scalar = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				quats_out[n] = laml::mul<float>(quats[n], quats[count - 1 - n]);
+			}
+			bench::keep(quats_out[count - 1]);
+		}
+	});
+	bench::report("mul (generic)", mul_scalar, items);
+
+	double mul_simd = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				quats_out[n] = laml::mul(quats[n], quats[count - 1 - n]);
+			}
+			bench::keep(quats_out[count - 1]);
+		}
+	});
+	bench::report("mul (specialized)", mul_simd, items, mul_scalar);
+
+	double mul_soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::soa::quat_mul(soa_quats, soa_quats, soa_quats_out);
+			bench::keep(soa_quats_out.x()[count - 1]);
+		}
+	});
+	bench::report("soa::quat_mul", mul_soa, items, mul_scalar);
+	return 0;
+}
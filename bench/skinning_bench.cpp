@@ -0,0 +1,98 @@
+#include <laml/laml.hpp>
+#include <laml/Skinning.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Linear-blend skinning, 4 influences per vertex: the usual hand-written loop vs. skin()
+int main() {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+
+	const size_t num_joints = 128;
+	const size_t count = 1 << 18;
+	const size_t repeats = 4;
+	std::vector<laml::Mat4> joint_mats(num_joints), inverse_bind(num_joints), skin_mats(num_joints);
+	for (size_t j = 0; j < num_joints; j++) {
+		laml::transform::create_transform(joint_mats[j], angle(gen), angle(gen), angle(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(1.0f));
+		laml::Mat4 bind;
+		laml::transform::create_transform(bind, angle(gen), angle(gen), angle(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(1.0f));
+		inverse_bind[j] = laml::inverse_rigid(bind);
+	}
+	laml::skinning_matrices(joint_mats.data(), inverse_bind.data(), skin_mats.data(), num_joints);
+
+	std::vector<uint16> joints(4 * count);
+	std::vector<float> weights(4 * count);
+	std::vector<uint8> weights_u8(4 * count);
+	std::vector<laml::Vec3> positions(count), normals(count), out_pos(count), out_nrm(count);
+	for (size_t n = 0; n < count; n++) {
+		float sum = 0.0f;
+		for (size_t k = 0; k < 4; k++) {
+			joints[4 * n + k] = static_cast<uint16>(gen() % num_joints);
+			weights[4 * n + k] = weight(gen);
+			sum += weights[4 * n + k];
+		}
+		for (size_t k = 0; k < 4; k++) {
+			weights[4 * n + k] /= sum;
+			weights_u8[4 * n + k] = static_cast<uint8>(weights[4 * n + k] * 255.0f + 0.5f);
+		}
+		positions[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		normals[n] = laml::normalize(laml::Vec3(dis(gen), dis(gen), dis(gen)));
+	}
+	laml::soa::Vec3Array soa_pos(positions.data(), count), soa_nrm(normals.data(), count), soa_out_pos(count), soa_out_nrm(count);
+	const size_t items = count * repeats;
+
+	printf("%zu joints, %zu vertices x %zu, positions and normals\n", num_joints, count, repeats);
+	double loop = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Mat4 m = skin_mats[joints[4 * n]] * weights[4 * n];
+				for (size_t k = 1; k < 4; k++) {
+					m = m + skin_mats[joints[4 * n + k]] * weights[4 * n + k];
+				}
+				out_pos[n] = laml::transform::transform_point(m, positions[n], 1.0f);
+				out_nrm[n] = laml::normalize(laml::transform::transform_point(m, normals[n], 0.0f));
+			}
+			bench::keep(out_pos[count - 1]);
+		}
+	});
+	bench::report("blended Mat4 + transform_point", loop, items);
+
+	double aos = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::skin<4>(skin_mats.data(), joints.data(), weights.data(), laml::soa::view(positions.data(), count), laml::soa::view(normals.data(), count),
+						  laml::soa::view(out_pos.data(), count), laml::soa::view(out_nrm.data(), count));
+			bench::keep(out_pos[count - 1]);
+		}
+	});
+	bench::report("skin (AoS)", aos, items, loop);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::skin<4>(skin_mats.data(), joints.data(), weights.data(), soa_pos, soa_nrm, soa_out_pos, soa_out_nrm);
+			bench::keep(soa_out_pos.x()[count - 1]);
+		}
+	});
+	bench::report("skin (SoA)", soa, items, loop);
+
+	double quantized = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::skin<4>(skin_mats.data(), joints.data(), weights_u8.data(), soa_pos, soa_nrm, soa_out_pos, soa_out_nrm);
+			bench::keep(soa_out_pos.x()[count - 1]);
+		}
+	});
+	bench::report("skin (SoA, uint8 weights)", quantized, items, loop);
+
+	double threaded = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::parallel::skin<4>(skin_mats.data(), joints.data(), weights.data(), soa_pos, soa_nrm, soa_out_pos, soa_out_nrm);
+			bench::keep(soa_out_pos.x()[count - 1]);
+		}
+	});
+	printf("%zu hardware threads\n", laml::parallel::ThreadPool::global().max_concurrency());
+	bench::report("parallel::skin (SoA)", threaded, items, loop);
+	return 0;
+}
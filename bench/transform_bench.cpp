@@ -0,0 +1,242 @@
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// transform_point() in a loop vs. the batched transform_points() kernels
+static void run(size_t count, size_t repeats) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+
+	laml::Mat4 mat;
+	laml::transform::create_transform(mat, 30.0f, 20.0f, 10.0f, laml::Vec3(1.0f, 2.0f, 3.0f), laml::Vec3(2.0f, 2.0f, 2.0f));
+	laml::Mat4 proj;
+	laml::transform::create_projection_perspective(proj, 60.0f, 1.5f, 0.1f, 1000.0f);
+
+	std::vector<laml::Vec3> points(count), out(count);
+	for (size_t n = 0; n < count; n++) {
+		points[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	std::vector<laml::Vec3A> points_al(points.begin(), points.end()), out_al(count);
+	laml::soa::Vec3Array soa_in(points.data(), count), soa_out(count);
+	const size_t items = count * repeats;
+
+	printf("transform_point, %zu points x %zu\n", count, repeats);
+	double scalar = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				out[n] = laml::transform::transform_point(mat, points[n], 1.0f);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("scalar loop", scalar, items);
+
+	double aos = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_points(mat, points.data(), out.data(), count, 1.0f);
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("transform_points (AoS)", aos, items, scalar);
+
+	double aos_al = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_points(mat, points_al.data(), out_al.data(), count, 1.0f);
+			bench::keep(out_al[count - 1]);
+		}
+	});
+	bench::report("transform_points (AoS, Vec3A)", aos_al, items, scalar);
+
+	double soa = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_points(mat, soa_in, soa_out, 1.0f);
+			bench::keep(soa_out.x()[count - 1]);
+		}
+	});
+	bench::report("transform_points (SoA)", soa, items, scalar);
+
+	double threaded = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::parallel::transform_points(mat, soa_in, soa_out, 1.0f);
+			bench::keep(soa_out.x()[count - 1]);
+		}
+	});
+	bench::report("parallel::transform_points (SoA)", threaded, items, scalar);
+
+	printf("projection + perspective divide, %zu points x %zu\n", count, repeats);
+	double scalar_proj = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Vec4 clip = laml::transform::transform_point(proj, laml::Vec4(points[n], 1.0f));
+				out[n] = laml::Vec3(clip.x / clip.w, clip.y / clip.w, clip.z / clip.w);
+			}
+			bench::keep(out[count - 1]);
+		}
+	});
+	bench::report("scalar loop", scalar_proj, items);
+
+	double soa_proj = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::transform_points(proj, soa_in, soa_out, 1.0f, true);
+			bench::keep(soa_out.x()[count - 1]);
+		}
+	});
+	bench::report("transform_points (SoA, divide)", soa_proj, items, scalar_proj);
+	printf("\n");
+}
+
+// TRS -> 4x4 composition: three matrices and two products vs. create_transform(s)
+static void run_trs(size_t count, size_t repeats) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+	std::vector<laml::Quat> rots(count);
+	std::vector<laml::Vec3> trans(count), scales(count);
+	for (size_t n = 0; n < count; n++) {
+		rots[n] = laml::normalize(laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen)));
+		trans[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		scales[n] = laml::Vec3(1.0f + 0.1f * dis(gen));
+	}
+	std::vector<laml::Mat4> mats(count);
+	const size_t items = count * repeats;
+
+	printf("TRS -> Mat4, %zu transforms x %zu\n", count, repeats);
+	double products = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Mat4 rot_mat, trans_mat, scale_mat;
+				laml::transform::create_transform_rotation(rot_mat, rots[n]);
+				laml::transform::create_transform_translate(trans_mat, trans[n]);
+				laml::transform::create_transform_scale(scale_mat, scales[n]);
+				laml::transform::create_transform(mats[n], rot_mat, trans_mat, scale_mat);
+			}
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("rotation/translate/scale matrices + 2 mul", products, items);
+
+	double direct = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::transform::create_transform(mats[n], rots[n], trans[n], scales[n]);
+			}
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transform (direct)", direct, items, products);
+
+	double batched = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::create_transforms(mats.data(), rots.data(), trans.data(), scales.data(), count);
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transforms (AoS)", batched, items, products);
+
+	printf("\n");
+}
+
+// Euler angles -> rotations: one builder call per entity vs. the batched builders
+static void run_ypr(size_t count, size_t repeats) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> deg(-180.0f, 180.0f);
+
+	std::vector<float> yaws(count), pitches(count), rolls(count);
+	for (size_t n = 0; n < count; n++) {
+		yaws[n] = deg(gen);
+		pitches[n] = deg(gen);
+		rolls[n] = deg(gen);
+	}
+	std::vector<laml::Mat4> mats(count);
+	std::vector<laml::Quat> quats(count);
+	const size_t items = count * repeats;
+
+	printf("yaw/pitch/roll -> Mat4, %zu rotations x %zu\n", count, repeats);
+	double single = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::transform::create_transform_rotation(mats[n], yaws[n], pitches[n], rolls[n], laml::math::precise());
+			}
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transform_rotation", single, items);
+
+	double single_fast = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::transform::create_transform_rotation(mats[n], yaws[n], pitches[n], rolls[n], laml::math::fast());
+			}
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transform_rotation, fast", single_fast, items, single);
+
+	double batched_precise = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::create_transform_rotations(mats.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::precise());
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transform_rotations", batched_precise, items, single);
+
+	double batched = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::create_transform_rotations(mats.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::fast());
+			bench::keep(mats[count - 1]);
+		}
+	});
+	bench::report("create_transform_rotations, fast", batched, items, single);
+
+	printf("yaw/pitch/roll -> Quat, %zu rotations x %zu\n", count, repeats);
+	double via_matrix = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				laml::Mat3 rot_mat;
+				laml::transform::create_transform_rotation(rot_mat, yaws[n], pitches[n], rolls[n], laml::math::precise());
+				quats[n] = laml::normalize(laml::transform::quat_from_mat(rot_mat));
+			}
+			bench::keep(quats[count - 1]);
+		}
+	});
+	bench::report("rotation matrix + quat_from_mat", via_matrix, items);
+
+	double half_angles = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			for (size_t n = 0; n < count; n++) {
+				quats[n] = laml::transform::quat_from_ypr(yaws[n], pitches[n], rolls[n], laml::math::precise());
+			}
+			bench::keep(quats[count - 1]);
+		}
+	});
+	bench::report("quat_from_ypr", half_angles, items, via_matrix);
+
+	double batched_quats_precise = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::quats_from_ypr(quats.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::precise());
+			bench::keep(quats[count - 1]);
+		}
+	});
+	bench::report("quats_from_ypr", batched_quats_precise, items, via_matrix);
+
+	double batched_quats = bench::time_ns([&]() {
+		for (size_t r = 0; r < repeats; r++) {
+			laml::transform::quats_from_ypr(quats.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::fast());
+			bench::keep(quats[count - 1]);
+		}
+	});
+	bench::report("quats_from_ypr, fast", batched_quats, items, via_matrix);
+
+	printf("\n");
+}
+
+int main() {
+	run(4096, 256);    // cache resident: compute bound
+	run(1 << 20, 1);   // streams from memory
+	run_trs(4096, 64);
+	run_ypr(4096, 64);
+	return 0;
+}
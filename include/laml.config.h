@@ -0,0 +1,29 @@
+#ifndef __LAML_CONFIG_H
+#define __LAML_CONFIG_H
+
+#define LAML_VERSION_MAJOR 0
+#define LAML_VERSION_MINOR 1
+#define LAML_VERSION_PATCH 0
+#define LAML_VERSION_STRING "v0.1.0"
+
+namespace rh {
+    namespace laml {
+        const char* GetVersionString();
+        int GetVersionMajor();
+        int GetVersionMinor();
+        int GetVersionPatch();
+    }
+}
+
+#ifdef LAML_IMPLEMENTATION
+namespace rh {
+    namespace laml {
+        const char* GetVersionString() {return LAML_VERSION_STRING;}
+        int GetVersionMajor() {return LAML_VERSION_MAJOR;}
+        int GetVersionMinor() {return LAML_VERSION_MINOR;}
+        int GetVersionPatch() {return LAML_VERSION_PATCH;}
+    }
+}
+#endif
+
+#endif // __LAML_CONFIG_H
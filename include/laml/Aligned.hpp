@@ -0,0 +1,54 @@
+#ifndef __LAML_ALIGNED_H
+#define __LAML_ALIGNED_H
+
+#include <laml/Data_types.hpp>
+#include <laml/Vector.hpp>
+#include <laml/Quaternion.hpp>
+#include <cstddef>
+
+namespace laml {
+
+    template<typename T, size_t rows, size_t cols>
+    struct Matrix;
+
+    /* Aligned, padded storage.
+    * Aligned<V, Align> is a V that starts on an Align-byte boundary, with its size rounded up to a multiple of Align:
+    * a Vec3A is 16 bytes, so it loads as one 128-bit lane, and every element of an array of them stays aligned.
+    *
+    * It derives from V, so every function taking a V (or a const V&) works on it unchanged, by reference, and
+    * results convert back implicitly:
+    *
+    *   laml::Vec3A a, b;
+    *   laml::Vec3A c = laml::cross(a, b);
+    *   laml::Vec3& plain = a;              // no copy
+    *
+    * The padding lane is not part of the value: it is not initialized and kernels may overwrite it.
+    * An array of Vec3A is NOT an array of Vec3 (the stride differs). Hand it to batched kernels through soa::view
+    * or the Aligned overloads, never as a Vec3 pointer.
+    * */
+    template<typename V, size_t Align>
+    struct alignas(Align) Aligned : public V {
+        static_assert(Align >= alignof(V) && (Align & (Align - 1)) == 0, "Align must be a power of two no smaller than alignof(V)");
+        static constexpr size_t alignment = Align;
+
+        using V::V;
+        constexpr Aligned() : V() {}
+        constexpr Aligned(const V& other) : V(other) {}
+    };
+
+    // Useful shorthands
+    // 3- and 4-vectors and quaternions fill a 128-bit lane, the double versions a 256-bit lane.
+    // A 4x4 matrix gets a whole cache line, so any packet width up to 512 bits loads its columns aligned.
+    // There is no Mat3A: padding the columns of a 3x3 changes its layout, which inheritance cannot do.
+    typedef Aligned<Vector<float, 3>, 16> Vec3A;
+    typedef Aligned<Vector<float, 4>, 16> Vec4A;
+    typedef Aligned<Quaternion<float>, 16> QuatA;
+    typedef Aligned<Matrix<float, 4, 4>, 64> Mat4A;
+
+    typedef Aligned<Vector<double, 3>, 32> Vec3A_highp;
+    typedef Aligned<Vector<double, 4>, 32> Vec4A_highp;
+    typedef Aligned<Quaternion<double>, 32> QuatA_highp;
+    typedef Aligned<Matrix<double, 4, 4>, 64> Mat4A_highp;
+}
+
+#endif // __LAML_ALIGNED_H
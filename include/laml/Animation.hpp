@@ -0,0 +1,231 @@
+#ifndef __LAML_ANIMATION_H
+#define __LAML_ANIMATION_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+
+#include <cassert>
+
+namespace laml {
+    /* Skeletal pose blending.
+    * A Pose stores every joint's rotation, translation and scale as SoA lanes, so blending
+    * evaluates simd::packet<T>::width joints at a time. Rotations are blended with slerp_fast's
+    * re-timed nlerp (two poses) or a sign-aligned weighted sum (N poses); no trig either way.
+    * */
+    namespace anim {
+
+        template<typename T>
+        struct JointPose {
+            Quaternion<T> rotation;
+            Vector<T, 3> translation;
+            Vector<T, 3> scale;
+
+            JointPose() : rotation(), translation(), scale(static_cast<T>(1.0)) {}
+            JointPose(const Quaternion<T>& r, const Vector<T, 3>& t, const Vector<T, 3>& s) : rotation(r), translation(t), scale(s) {}
+        };
+
+        template<typename T>
+        struct Pose {
+            soa::VectorArray<T, 4> rotations; // x, y, z, w lanes
+            soa::VectorArray<T, 3> translations;
+            soa::VectorArray<T, 3> scales;
+
+            Pose() {}
+            explicit Pose(size_t num_joints) {
+                resize(num_joints);
+            }
+            // de-interleave an array of joints
+            Pose(const JointPose<T>* joints, size_t num_joints) : Pose(num_joints) {
+                for (size_t n = 0; n < num_joints; n++) {
+                    set(n, joints[n]);
+                }
+            }
+
+            size_t size() const { return rotations.size(); }
+
+            // new joints are identity transforms
+            void resize(size_t num_joints) {
+                const size_t old_size = size();
+                rotations.resize(num_joints);
+                translations.resize(num_joints);
+                scales.resize(num_joints);
+                for (size_t n = old_size; n < num_joints; n++) {
+                    set(n, JointPose<T>());
+                }
+            }
+
+            JointPose<T> get(size_t idx) const {
+                const Vector<T, 4> r = rotations.get(idx);
+                return JointPose<T>(Quaternion<T>(r.x, r.y, r.z, r.w), translations.get(idx), scales.get(idx));
+            }
+            void set(size_t idx, const JointPose<T>& joint) {
+                rotations.set(idx, Vector<T, 4>(joint.rotation.x, joint.rotation.y, joint.rotation.z, joint.rotation.w));
+                translations.set(idx, joint.translation);
+                scales.set(idx, joint.scale);
+            }
+        };
+
+        namespace detail {
+            // Lane pointers of a pose: rotation x,y,z,w, translation x,y,z, scale x,y,z
+            constexpr size_t pose_lanes = 10;
+
+            template<typename PoseT, typename Ptr>
+            inline void pose_lane_ptrs(PoseT& pose, Ptr (&lanes)[pose_lanes]) {
+                for (size_t k = 0; k < 4; k++) lanes[k] = pose.rotations.lane(k);
+                for (size_t k = 0; k < 3; k++) lanes[4 + k] = pose.translations.lane(k);
+                for (size_t k = 0; k < 3; k++) lanes[7 + k] = pose.scales.lane(k);
+            }
+
+            // 1 / |q| for a packet of quaternions
+            template<typename P>
+            inline P inv_length(const P& x, const P& y, const P& z, const P& w, const P& one) {
+                return one / simd::sqrt(x * x + y * y + z * z + w * w);
+            }
+        }
+
+        /* Two-pose blend: out = blend of a and b at factor (0 -> a, 1 -> b).
+        * Rotations follow slerp_fast (shortest path, within ~1e-3 radians of slerp),
+        * translations and scales are lerped. out may be a or b.
+        * a and b must have the same number of joints; out is resized to match.
+        * */
+        template<typename T>
+        void blend(const Pose<T>& a, const Pose<T>& b, T factor, Pose<T>& out) {
+            typedef simd::packet<T> P;
+            assert(a.size() == b.size() && "blend: poses have different joint counts");
+            const size_t count = a.size();
+            out.resize(count);
+
+            const T* in[2 * detail::pose_lanes];
+            size_t in_stride[2 * detail::pose_lanes];
+            T* res[detail::pose_lanes];
+            size_t res_stride[detail::pose_lanes];
+            {
+                const T* a_lanes[detail::pose_lanes];
+                const T* b_lanes[detail::pose_lanes];
+                detail::pose_lane_ptrs(a, a_lanes);
+                detail::pose_lane_ptrs(b, b_lanes);
+                detail::pose_lane_ptrs(out, res);
+                for (size_t k = 0; k < detail::pose_lanes; k++) {
+                    in[k] = a_lanes[k];
+                    in[detail::pose_lanes + k] = b_lanes[k];
+                    in_stride[k] = in_stride[detail::pose_lanes + k] = res_stride[k] = 1;
+                }
+            }
+
+            // slerp_fast's polynomial depends on |cos omega| per joint, the rest only on factor
+            const T half = static_cast<T>(0.5);
+            const P t = simd::set1(factor);
+            const P t_shape = simd::set1(factor * (factor - half) * (factor - static_cast<T>(1.0)));
+            const P t_sq = simd::set1((factor - half) * (factor - half));
+            const P one_minus_t = simd::set1(static_cast<T>(1.0) - factor);
+            const P zero = simd::set1(static_cast<T>(0.0));
+            const P a0 = simd::set1(static_cast<T>(1.0904)), a1 = simd::set1(static_cast<T>(-3.2452)), a2 = simd::set1(static_cast<T>(3.55645)), a3 = simd::set1(static_cast<T>(1.43519));
+            const P b0 = simd::set1(static_cast<T>(0.848013)), b1 = simd::set1(static_cast<T>(-1.06021)), b2 = simd::set1(static_cast<T>(0.215638));
+            const P one = simd::set1(static_cast<T>(1.0));
+
+            soa::detail::for_each_packet(count, in, in_stride, res, res_stride,
+                [=](const P* v, P* r) {
+                    const P* qa = v;
+                    const P* qb = v + detail::pose_lanes;
+                    const P cos_omega = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+                    const P d = simd::abs(cos_omega);
+                    const P A = a0 + d * (a1 + d * (a2 - d * a3));
+                    const P B = b0 + d * (b1 + d * b2);
+                    const P ot = t + t_shape * (A * t_sq + B);
+
+                    // shortest path: flip b's weight when the quaternions are in opposite hemispheres
+                    const P wa = one - ot;
+                    const P wb = simd::select(cos_omega < zero, -ot, ot);
+                    P q[4];
+                    for (size_t k = 0; k < 4; k++) {
+                        q[k] = qa[k] * wa + qb[k] * wb;
+                    }
+                    const P inv_len = detail::inv_length(q[0], q[1], q[2], q[3], one);
+                    for (size_t k = 0; k < 4; k++) {
+                        r[k] = q[k] * inv_len;
+                    }
+
+                    for (size_t k = 4; k < detail::pose_lanes; k++) {
+                        r[k] = qb[k] * t + qa[k] * one_minus_t;
+                    }
+                });
+        }
+
+        /* Weighted blend of num_poses poses. Weights don't have to sum to one, they are normalized.
+        * Rotations are summed after flipping each into the hemisphere of the running sum, then normalized
+        * (a weighted nlerp); translations and scales are weighted averages.
+        * Every pose must have as many joints as poses[0]; out is resized to match.
+        * */
+        template<typename T>
+        void blend(const Pose<T>* const* poses, const T* weights, size_t num_poses, Pose<T>& out) {
+            typedef simd::packet<T> P;
+            if (num_poses == 0) {
+                return;
+            }
+            const size_t count = poses[0]->size();
+            for (size_t p = 1; p < num_poses; p++) {
+                assert(poses[p]->size() == count && "blend: poses have different joint counts");
+            }
+            out.resize(count);
+
+            T weight_sum = static_cast<T>(0.0);
+            for (size_t p = 0; p < num_poses; p++) {
+                weight_sum = weight_sum + weights[p];
+            }
+            const P inv_weight_sum = simd::set1(static_cast<T>(1.0) / weight_sum);
+            const P zero = simd::set1(static_cast<T>(0.0));
+            const P one = simd::set1(static_cast<T>(1.0));
+
+            T* res[detail::pose_lanes];
+            detail::pose_lane_ptrs(out, res);
+
+            for (size_t idx = 0; idx < count; idx += P::width) {
+                const size_t n = (count - idx < P::width) ? (count - idx) : P::width;
+                P acc[detail::pose_lanes];
+                for (size_t k = 0; k < detail::pose_lanes; k++) {
+                    acc[k] = zero;
+                }
+
+                for (size_t p = 0; p < num_poses; p++) {
+                    const T* lanes[detail::pose_lanes];
+                    detail::pose_lane_ptrs(*poses[p], lanes);
+                    P v[detail::pose_lanes];
+                    for (size_t k = 0; k < detail::pose_lanes; k++) {
+                        v[k] = soa::detail::gather(lanes[k], idx, 1, n);
+                    }
+
+                    const P w = simd::set1(weights[p]);
+                    const P hemisphere = acc[0] * v[0] + acc[1] * v[1] + acc[2] * v[2] + acc[3] * v[3];
+                    const P wq = simd::select(hemisphere < zero, -w, w);
+                    for (size_t k = 0; k < 4; k++) {
+                        acc[k] = acc[k] + v[k] * wq;
+                    }
+                    for (size_t k = 4; k < detail::pose_lanes; k++) {
+                        acc[k] = acc[k] + v[k] * w;
+                    }
+                }
+
+                const P inv_len = detail::inv_length(acc[0], acc[1], acc[2], acc[3], one);
+                for (size_t k = 0; k < 4; k++) {
+                    soa::detail::scatter(res[k], idx, 1, n, acc[k] * inv_len);
+                }
+                for (size_t k = 4; k < detail::pose_lanes; k++) {
+                    soa::detail::scatter(res[k], idx, 1, n, acc[k] * inv_weight_sum);
+                }
+            }
+        }
+
+        // Per-joint versions over plain arrays of JointPose, using the scalar slerp_fast
+        template<typename T>
+        void blend(const JointPose<T>* a, const JointPose<T>* b, T factor, JointPose<T>* out, size_t num_joints) {
+            for (size_t n = 0; n < num_joints; n++) {
+                out[n] = JointPose<T>(
+                    slerp_fast(a[n].rotation, b[n].rotation, factor),
+                    lerp(a[n].translation, b[n].translation, factor),
+                    lerp(a[n].scale, b[n].scale, factor));
+            }
+        }
+    }
+}
+
+#endif // __LAML_ANIMATION_H
@@ -0,0 +1,403 @@
+#ifndef __LAML_BOUNDS_H
+#define __LAML_BOUNDS_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <limits>
+
+namespace laml {
+    /* Bounding volumes: axis-aligned box, sphere and oriented box.
+    * Touching counts as intersecting and boundary points count as contained.
+    * */
+
+    template<typename T>
+    struct Aabb {
+        Vector<T, 3> min;
+        Vector<T, 3> max;
+
+        // Default box is empty: it merges as the identity, and contains/intersects nothing
+        Aabb() : min(std::numeric_limits<T>::max()), max(std::numeric_limits<T>::lowest()) {}
+        Aabb(const Vector<T, 3>& min_corner, const Vector<T, 3>& max_corner) : min(min_corner), max(max_corner) {}
+    };
+
+    template<typename T>
+    struct Sphere {
+        Vector<T, 3> center;
+        T radius;
+
+        Sphere() : center(), radius(static_cast<T>(0.0)) {}
+        Sphere(const Vector<T, 3>& c, T r) : center(c), radius(r) {}
+    };
+
+    // Box of half-size extents around center, rotated so its local x, y, z are the (unit, orthogonal) columns of axes
+    template<typename T>
+    struct Obb {
+        Vector<T, 3> center;
+        Matrix<T, 3, 3> axes;
+        Vector<T, 3> extents;
+
+        Obb() : center(), axes(static_cast<T>(1.0)), extents() {}
+        Obb(const Vector<T, 3>& c, const Matrix<T, 3, 3>& rot, const Vector<T, 3>& e) : center(c), axes(rot), extents(e) {}
+        explicit Obb(const Aabb<T>& box) : center((box.min + box.max) * static_cast<T>(0.5)), axes(static_cast<T>(1.0)),
+                                           extents((box.max - box.min) * static_cast<T>(0.5)) {}
+    };
+
+    namespace detail {
+        template<typename T>
+        inline Vector<T, 3> min3(const Vector<T, 3>& a, const Vector<T, 3>& b) {
+            return Vector<T, 3>(a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z);
+        }
+        template<typename T>
+        inline Vector<T, 3> max3(const Vector<T, 3>& a, const Vector<T, 3>& b) {
+            return Vector<T, 3>(a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z);
+        }
+    }
+
+    // Axis-aligned boxes
+    template<typename T>
+    bool is_empty(const Aabb<T>& box) {
+        return box.min.x > box.max.x || box.min.y > box.max.y || box.min.z > box.max.z;
+    }
+    template<typename T>
+    Vector<T, 3> center(const Aabb<T>& box) {
+        return (box.min + box.max) * static_cast<T>(0.5);
+    }
+    // half-size along each axis
+    template<typename T>
+    Vector<T, 3> extents(const Aabb<T>& box) {
+        return (box.max - box.min) * static_cast<T>(0.5);
+    }
+    template<typename T>
+    T surface_area(const Aabb<T>& box) {
+        const Vector<T, 3> d = box.max - box.min;
+        return static_cast<T>(2.0) * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+    template<typename T>
+    T volume(const Aabb<T>& box) {
+        const Vector<T, 3> d = box.max - box.min;
+        return d.x * d.y * d.z;
+    }
+
+    template<typename T>
+    Aabb<T> merge(const Aabb<T>& a, const Aabb<T>& b) {
+        return Aabb<T>(detail::min3(a.min, b.min), detail::max3(a.max, b.max));
+    }
+    template<typename T>
+    Aabb<T> merge(const Aabb<T>& box, const Vector<T, 3>& point) {
+        return Aabb<T>(detail::min3(box.min, point), detail::max3(box.max, point));
+    }
+    // overlap of two boxes; empty if they don't intersect
+    template<typename T>
+    Aabb<T> intersection(const Aabb<T>& a, const Aabb<T>& b) {
+        return Aabb<T>(detail::max3(a.min, b.min), detail::min3(a.max, b.max));
+    }
+    template<typename T>
+    bool intersects(const Aabb<T>& a, const Aabb<T>& b) {
+        return a.min.x <= b.max.x && b.min.x <= a.max.x &&
+               a.min.y <= b.max.y && b.min.y <= a.max.y &&
+               a.min.z <= b.max.z && b.min.z <= a.max.z;
+    }
+    template<typename T>
+    bool contains(const Aabb<T>& box, const Vector<T, 3>& point) {
+        return box.min.x <= point.x && point.x <= box.max.x &&
+               box.min.y <= point.y && point.y <= box.max.y &&
+               box.min.z <= point.z && point.z <= box.max.z;
+    }
+    template<typename T>
+    bool contains(const Aabb<T>& box, const Aabb<T>& other) {
+        return contains(box, other.min) && contains(box, other.max);
+    }
+
+    // Spheres
+    template<typename T>
+    Sphere<T> merge(const Sphere<T>& a, const Sphere<T>& b) {
+        const Vector<T, 3> d = b.center - a.center;
+        const T dist = length(d);
+        if (dist + b.radius <= a.radius) {
+            return a;
+        }
+        if (dist + a.radius <= b.radius) {
+            return b;
+        }
+        const T radius = (dist + a.radius + b.radius) * static_cast<T>(0.5);
+        return Sphere<T>(a.center + d * ((radius - a.radius) / dist), radius);
+    }
+    template<typename T>
+    bool intersects(const Sphere<T>& a, const Sphere<T>& b) {
+        const T r = a.radius + b.radius;
+        return length_sq(b.center - a.center) <= r * r;
+    }
+    template<typename T>
+    bool contains(const Sphere<T>& sphere, const Vector<T, 3>& point) {
+        return length_sq(point - sphere.center) <= sphere.radius * sphere.radius;
+    }
+    template<typename T>
+    bool contains(const Sphere<T>& sphere, const Sphere<T>& other) {
+        return length(other.center - sphere.center) + other.radius <= sphere.radius;
+    }
+
+    // closest point of the box to the sphere's center
+    template<typename T>
+    bool intersects(const Aabb<T>& box, const Sphere<T>& sphere) {
+        const Vector<T, 3> closest = detail::min3(detail::max3(sphere.center, box.min), box.max);
+        return length_sq(closest - sphere.center) <= sphere.radius * sphere.radius;
+    }
+    template<typename T>
+    bool intersects(const Sphere<T>& sphere, const Aabb<T>& box) {
+        return intersects(box, sphere);
+    }
+
+    // Oriented boxes
+    template<typename T>
+    bool contains(const Obb<T>& box, const Vector<T, 3>& point) {
+        const Vector<T, 3> d = point - box.center;
+        for (size_t k = 0; k < 3; k++) {
+            if (fabs(dot(d, box.axes._cols[k])) > box.extents[k]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Separating axis test over the 15 candidate axes (Gottschalk et al., "OBBTree")
+    template<typename T>
+    bool intersects(const Obb<T>& a, const Obb<T>& b) {
+        // parallel edges make the cross product axes degenerate, eps keeps them from separating
+        const T eps = static_cast<T>(1e-6);
+        T R[3][3], absR[3][3];
+        for (size_t i = 0; i < 3; i++) {
+            for (size_t j = 0; j < 3; j++) {
+                R[i][j] = dot(a.axes._cols[i], b.axes._cols[j]);
+                absR[i][j] = static_cast<T>(fabs(R[i][j])) + eps;
+            }
+        }
+        // translation in a's frame
+        const Vector<T, 3> d = b.center - a.center;
+        const T t[3] = { dot(d, a.axes._cols[0]), dot(d, a.axes._cols[1]), dot(d, a.axes._cols[2]) };
+        const Vector<T, 3>& ea = a.extents;
+        const Vector<T, 3>& eb = b.extents;
+
+        // a's axes
+        for (size_t i = 0; i < 3; i++) {
+            if (fabs(t[i]) > ea[i] + eb[0] * absR[i][0] + eb[1] * absR[i][1] + eb[2] * absR[i][2]) {
+                return false;
+            }
+        }
+        // b's axes
+        for (size_t j = 0; j < 3; j++) {
+            const T dist = t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j];
+            if (fabs(dist) > ea[0] * absR[0][j] + ea[1] * absR[1][j] + ea[2] * absR[2][j] + eb[j]) {
+                return false;
+            }
+        }
+        // a[i] x b[j]
+        for (size_t i = 0; i < 3; i++) {
+            const size_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+            for (size_t j = 0; j < 3; j++) {
+                const size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                const T ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+                const T rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+                if (fabs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Conversions to the smallest enclosing volume of another kind
+    template<typename T>
+    Aabb<T> bounding_box(const Sphere<T>& sphere) {
+        const Vector<T, 3> r(sphere.radius);
+        return Aabb<T>(sphere.center - r, sphere.center + r);
+    }
+    template<typename T>
+    Aabb<T> bounding_box(const Obb<T>& box) {
+        const Matrix<T, 3, 3>& m = box.axes;
+        const Vector<T, 3> e(
+            static_cast<T>(fabs(m.c_11)) * box.extents.x + static_cast<T>(fabs(m.c_12)) * box.extents.y + static_cast<T>(fabs(m.c_13)) * box.extents.z,
+            static_cast<T>(fabs(m.c_21)) * box.extents.x + static_cast<T>(fabs(m.c_22)) * box.extents.y + static_cast<T>(fabs(m.c_23)) * box.extents.z,
+            static_cast<T>(fabs(m.c_31)) * box.extents.x + static_cast<T>(fabs(m.c_32)) * box.extents.y + static_cast<T>(fabs(m.c_33)) * box.extents.z);
+        return Aabb<T>(box.center - e, box.center + e);
+    }
+    template<typename T>
+    Sphere<T> bounding_sphere(const Aabb<T>& box) {
+        return Sphere<T>(center(box), length(extents(box)));
+    }
+
+    namespace transform {
+        /* Box around the transformed box, without transforming its 8 corners (Arvo, Graphics Gems 1990):
+        * the new center is mat * center, and each new half-extent is the matching row of |mat| times the old extents.
+        * The box must not be empty.
+        * */
+        template<typename T>
+        Aabb<T> transform_aabb(const Matrix<T, 4, 4>& mat, const Aabb<T>& box) {
+            const Vector<T, 3> c = (box.min + box.max) * static_cast<T>(0.5);
+            const Vector<T, 3> e = (box.max - box.min) * static_cast<T>(0.5);
+            const Vector<T, 3> nc(
+                mat.c_11 * c.x + mat.c_12 * c.y + mat.c_13 * c.z + mat.c_14,
+                mat.c_21 * c.x + mat.c_22 * c.y + mat.c_23 * c.z + mat.c_24,
+                mat.c_31 * c.x + mat.c_32 * c.y + mat.c_33 * c.z + mat.c_34);
+            const Vector<T, 3> ne(
+                static_cast<T>(fabs(mat.c_11)) * e.x + static_cast<T>(fabs(mat.c_12)) * e.y + static_cast<T>(fabs(mat.c_13)) * e.z,
+                static_cast<T>(fabs(mat.c_21)) * e.x + static_cast<T>(fabs(mat.c_22)) * e.y + static_cast<T>(fabs(mat.c_23)) * e.z,
+                static_cast<T>(fabs(mat.c_31)) * e.x + static_cast<T>(fabs(mat.c_32)) * e.y + static_cast<T>(fabs(mat.c_33)) * e.z);
+            return Aabb<T>(nc - ne, nc + ne);
+        }
+
+        // radius grows by the largest axis scale of mat
+        template<typename T>
+        Sphere<T> transform_sphere(const Matrix<T, 4, 4>& mat, const Sphere<T>& sphere) {
+            T scale_sq = length_sq(Vector<T, 3>(mat.c_11, mat.c_21, mat.c_31));
+            const T sy = length_sq(Vector<T, 3>(mat.c_12, mat.c_22, mat.c_32));
+            const T sz = length_sq(Vector<T, 3>(mat.c_13, mat.c_23, mat.c_33));
+            scale_sq = sy > scale_sq ? sy : scale_sq;
+            scale_sq = sz > scale_sq ? sz : scale_sq;
+            return Sphere<T>(transform_point(mat, sphere.center, static_cast<T>(1.0)), sphere.radius * static_cast<T>(sqrt(scale_sq)));
+        }
+
+        // Exact for rotations, translations and scales; a shear leaves the axes non-orthogonal
+        template<typename T>
+        Obb<T> transform_obb(const Matrix<T, 4, 4>& mat, const Obb<T>& box) {
+            Obb<T> res;
+            res.center = transform_point(mat, box.center, static_cast<T>(1.0));
+            for (size_t k = 0; k < 3; k++) {
+                const Vector<T, 3> axis = transform_point(mat, box.axes._cols[k], static_cast<T>(0.0));
+                const T len = length(axis);
+                res.axes._cols[k] = axis / len;
+                res.extents[k] = box.extents[k] * len;
+            }
+            return res;
+        }
+
+        // Batched transform_aabb over plain arrays; out may be the same array as in.
+        // Coefficients and their absolute values are hoisted out of the loop.
+        template<typename T>
+        void transform_aabbs(const Matrix<T, 4, 4>& mat, const Aabb<T>* in, Aabb<T>* out, size_t count) {
+            const T half = static_cast<T>(0.5);
+            const T c11 = mat.c_11, c12 = mat.c_12, c13 = mat.c_13, c14 = mat.c_14;
+            const T c21 = mat.c_21, c22 = mat.c_22, c23 = mat.c_23, c24 = mat.c_24;
+            const T c31 = mat.c_31, c32 = mat.c_32, c33 = mat.c_33, c34 = mat.c_34;
+            const T a11 = static_cast<T>(fabs(c11)), a12 = static_cast<T>(fabs(c12)), a13 = static_cast<T>(fabs(c13));
+            const T a21 = static_cast<T>(fabs(c21)), a22 = static_cast<T>(fabs(c22)), a23 = static_cast<T>(fabs(c23));
+            const T a31 = static_cast<T>(fabs(c31)), a32 = static_cast<T>(fabs(c32)), a33 = static_cast<T>(fabs(c33));
+            for (size_t n = 0; n < count; n++) {
+                const T cx = (in[n].min.x + in[n].max.x) * half, ex = (in[n].max.x - in[n].min.x) * half;
+                const T cy = (in[n].min.y + in[n].max.y) * half, ey = (in[n].max.y - in[n].min.y) * half;
+                const T cz = (in[n].min.z + in[n].max.z) * half, ez = (in[n].max.z - in[n].min.z) * half;
+                const T nx = c11 * cx + c12 * cy + c13 * cz + c14, rx = a11 * ex + a12 * ey + a13 * ez;
+                const T ny = c21 * cx + c22 * cy + c23 * cz + c24, ry = a21 * ex + a22 * ey + a23 * ez;
+                const T nz = c31 * cx + c32 * cy + c33 * cz + c34, rz = a31 * ex + a32 * ey + a33 * ez;
+                out[n].min.x = nx - rx; out[n].min.y = ny - ry; out[n].min.z = nz - rz;
+                out[n].max.x = nx + rx; out[n].max.y = ny + ry; out[n].max.z = nz + rz;
+            }
+        }
+
+        // SoA version: boxes as separate min and max corner lanes
+        template<typename T>
+        void transform_aabbs(const Matrix<T, 4, 4>& mat,
+                             const soa::ConstVectorView<T, 3>& in_min, const soa::ConstVectorView<T, 3>& in_max,
+                             soa::VectorView<T, 3> out_min, soa::VectorView<T, 3> out_max) {
+            typedef simd::packet<T> P;
+            const P half = simd::set1(static_cast<T>(0.5));
+            P c[12], a[9];
+            for (size_t col = 0; col < 4; col++) {
+                for (size_t row = 0; row < 3; row++) {
+                    c[col * 3 + row] = simd::set1(mat[col][row]);
+                    if (col < 3) {
+                        a[col * 3 + row] = simd::abs(c[col * 3 + row]);
+                    }
+                }
+            }
+
+            const T* in[6] = { in_min.lane(0), in_min.lane(1), in_min.lane(2), in_max.lane(0), in_max.lane(1), in_max.lane(2) };
+            const size_t in_stride[6] = { in_min.stride(), in_min.stride(), in_min.stride(), in_max.stride(), in_max.stride(), in_max.stride() };
+            T* const res[6] = { out_min.lane(0), out_min.lane(1), out_min.lane(2), out_max.lane(0), out_max.lane(1), out_max.lane(2) };
+            const size_t res_stride[6] = { out_min.stride(), out_min.stride(), out_min.stride(), out_max.stride(), out_max.stride(), out_max.stride() };
+
+            soa::detail::for_each_packet(out_min.size(), in, in_stride, res, res_stride,
+                [=](const P* v, P* r) {
+                    const P cx = (v[0] + v[3]) * half, ex = (v[3] - v[0]) * half;
+                    const P cy = (v[1] + v[4]) * half, ey = (v[4] - v[1]) * half;
+                    const P cz = (v[2] + v[5]) * half, ez = (v[5] - v[2]) * half;
+                    for (size_t row = 0; row < 3; row++) {
+                        const P nc = c[row] * cx + c[3 + row] * cy + c[6 + row] * cz + c[9 + row];
+                        const P ne = a[row] * ex + a[3 + row] * ey + a[6 + row] * ez;
+                        r[row] = nc - ne;
+                        r[3 + row] = nc + ne;
+                    }
+                });
+        }
+    }
+
+    // Batched merges: the box around all of them, and pairwise out[n] = merge(a[n], b[n]) (e.g. a BVH refit level)
+    template<typename T>
+    Aabb<T> merge(const Aabb<T>* boxes, size_t count) {
+        Aabb<T> res;
+        for (size_t n = 0; n < count; n++) {
+            res = merge(res, boxes[n]);
+        }
+        return res;
+    }
+    template<typename T>
+    void merge(const Aabb<T>* a, const Aabb<T>* b, Aabb<T>* out, size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = merge(a[n], b[n]);
+        }
+    }
+
+    namespace soa {
+        // Box around all the points of a view, a packet at a time
+        template<typename T>
+        Aabb<T> bounds(const ConstVectorView<T, 3>& points) {
+            typedef simd::packet<T> P;
+            const size_t count = points.size();
+            if (count == 0) {
+                return Aabb<T>();
+            }
+            P lo[3], hi[3];
+            for (size_t k = 0; k < 3; k++) {
+                lo[k] = hi[k] = simd::set1(points.lane(k)[0]);
+            }
+            for (size_t idx = 0; idx < count; idx += P::width) {
+                const size_t n = (count - idx < P::width) ? (count - idx) : P::width;
+                for (size_t k = 0; k < 3; k++) {
+                    P v = detail::gather(points.lane(k), idx, points.stride(), n);
+                    if (n < P::width) {
+                        // pad the last packet with a real point so the zero fill doesn't count
+                        T tmp[P::width];
+                        simd::storeu(tmp, v);
+                        for (size_t i = n; i < P::width; i++) {
+                            tmp[i] = points.lane(k)[0];
+                        }
+                        v = simd::loadu(tmp);
+                    }
+                    lo[k] = simd::min(lo[k], v);
+                    hi[k] = simd::max(hi[k], v);
+                }
+            }
+
+            Aabb<T> res;
+            for (size_t k = 0; k < 3; k++) {
+                T l[P::width], h[P::width];
+                simd::storeu(l, lo[k]);
+                simd::storeu(h, hi[k]);
+                for (size_t i = 0; i < P::width; i++) {
+                    res.min[k] = l[i] < res.min[k] ? l[i] : res.min[k];
+                    res.max[k] = h[i] > res.max[k] ? h[i] : res.max[k];
+                }
+            }
+            return res;
+        }
+    }
+
+    // Useful shorthands
+    typedef Aabb<float> Aabb3;
+    typedef Aabb<double> Aabb3_highp;
+    typedef Sphere<float> Sphere3;
+    typedef Sphere<double> Sphere3_highp;
+    typedef Obb<float> Obb3;
+    typedef Obb<double> Obb3_highp;
+}
+
+#endif // __LAML_BOUNDS_H
@@ -0,0 +1,461 @@
+#ifndef __LAML_BVH_H
+#define __LAML_BVH_H
+
+#include <laml/laml.hpp>
+#include <laml/Bounds.hpp>
+#include <laml/Ray.hpp>
+#include <laml/Parallel.hpp>
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace laml {
+    /* Bounding volume hierarchy node, 32 bytes for float.
+    * Nodes are stored depth-first: an inner node's left child directly follows it and first is its right child.
+    * A leaf holds count primitive slots starting at first.
+    * */
+    template<typename T>
+    struct BvhNode {
+        Aabb<T> bounds;
+        uint32 first; // right child of an inner node, first primitive slot of a leaf
+        uint32 count; // number of primitives, 0 for an inner node
+
+        bool is_leaf() const { return count != 0; }
+    };
+
+    namespace detail {
+        inline size_t ceil_log2(size_t n) {
+            size_t res = 0;
+            while ((static_cast<size_t>(1) << res) < n) {
+                res++;
+            }
+            return res;
+        }
+    }
+
+    /* BVH over primitive bounding boxes, built top-down with binned SAH (Wald, "On fast Construction of
+    * SAH-based Bounding Volume Hierarchies", 2007). Queries report primitive indices as passed to build();
+    * the exact test against a primitive (triangle, sphere, collider...) is done by a callback.
+    * Leaf primitive boxes are kept in leaf order, so overlap queries reject primitives without the callback.
+    * */
+    template<typename T = float>
+    class Bvh {
+    public:
+        static constexpr size_t npos = static_cast<size_t>(-1); // "no hit"
+        static constexpr size_t max_depth = 64;                 // the build keeps every leaf above this depth
+        static constexpr size_t num_bins = 16;
+
+        size_t size() const { return _indices.size(); }
+        size_t num_nodes() const { return _nodes.size(); }
+        const std::vector<BvhNode<T>>& nodes() const { return _nodes; }
+        // primitive index stored in a leaf slot
+        size_t primitive(size_t slot) const { return _indices[slot]; }
+        Aabb<T> bounds() const { return _nodes.empty() ? Aabb<T>() : _nodes[0].bounds; }
+
+        // Single-threaded build over count primitive boxes
+        void build(const Aabb<T>* boxes, size_t count, size_t max_leaf_size = 4) {
+            if (init(boxes, count, max_leaf_size, npos)) {
+                build_node(_nodes, _root);
+            }
+            finish();
+        }
+
+        /* Multi-threaded build, same tree as build(). Ranges of at least min_prims_per_task primitives are
+        * split on the calling thread with binning and bounds spread across the parallel:: thread pool;
+        * the smaller subtrees below them are then built as independent pool tasks and spliced in place.
+        * */
+        void build_parallel(const Aabb<T>* boxes, size_t count, size_t max_leaf_size = 4, size_t min_prims_per_task = 16384) {
+            const size_t min_task = min_prims_per_task ? min_prims_per_task : 1;
+            if (init(boxes, count, max_leaf_size, min_task)) {
+                std::vector<TopNode> top;
+                std::vector<Range> tasks;
+                plan(top, tasks, _root, min_task);
+
+                std::vector<std::vector<BvhNode<T>>> subtrees(tasks.size());
+                parallel::ThreadPool::global().run(tasks.size(), [&](size_t i) {
+                    build_node(subtrees[i], tasks[i]);
+                });
+                splice(top, subtrees, 0);
+            }
+            finish();
+        }
+
+        // Recomputes all node bounds for moved primitives, keeping the tree topology (animated geometry).
+        // boxes must hold as many primitives, in the same order, as the last build.
+        void refit(const Aabb<T>* boxes) {
+            for (size_t slot = 0; slot < _indices.size(); slot++) {
+                _boxes[slot] = boxes[_indices[slot]];
+            }
+            // children always come after their parent, so a reverse sweep sees them first
+            for (size_t n = _nodes.size(); n-- > 0;) {
+                BvhNode<T>& node = _nodes[n];
+                node.bounds = node.is_leaf() ? merge(_boxes.data() + node.first, node.count)
+                                             : merge(_nodes[n + 1].bounds, _nodes[node.first].bounds);
+            }
+        }
+
+        /* Closest hit along the ray within [0, t). hit(primitive, t_max) returns the primitive's hit distance,
+        * or any value >= t_max for a miss. Children are visited near to far, and subtrees that start beyond
+        * the closest hit so far are skipped. Returns the primitive hit and shortens t, or npos.
+        * */
+        template<typename F>
+        size_t closest_hit(const Ray<T>& ray, T& t, F&& hit) const {
+            size_t res = npos;
+            T t_enter;
+            if (_nodes.empty() || !intersects(ray, _nodes[0].bounds, t, t_enter)) {
+                return res;
+            }
+            struct Entry {
+                uint32 node;
+                T t_enter;
+            } stack[max_depth];
+            size_t top = 0;
+            size_t n = 0;
+            for (;;) {
+                const BvhNode<T>& node = _nodes[n];
+                if (!node.is_leaf()) {
+                    T t_left, t_right;
+                    const bool left = intersects(ray, _nodes[n + 1].bounds, t, t_left);
+                    const bool right = intersects(ray, _nodes[node.first].bounds, t, t_right);
+                    if (left && right) {
+                        const bool left_first = t_left <= t_right;
+                        stack[top++] = { left_first ? node.first : static_cast<uint32>(n + 1), left_first ? t_right : t_left };
+                        n = left_first ? n + 1 : node.first;
+                        continue;
+                    }
+                    if (left || right) {
+                        n = left ? n + 1 : node.first;
+                        continue;
+                    }
+                }
+                else {
+                    for (size_t slot = node.first; slot < node.first + node.count; slot++) {
+                        const T d = hit(static_cast<size_t>(_indices[slot]), t);
+                        if (d < t) {
+                            t = d;
+                            res = _indices[slot];
+                        }
+                    }
+                }
+                // pop the next subtree that can still hold a closer hit
+                for (;;) {
+                    if (top == 0) {
+                        return res;
+                    }
+                    top--;
+                    if (stack[top].t_enter <= t) {
+                        n = stack[top].node;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Any hit within [0, t_max), e.g. for shadow or line-of-sight rays; stops at the first one
+        template<typename F>
+        bool any_hit(const Ray<T>& ray, T t_max, F&& hit) const {
+            if (_nodes.empty()) {
+                return false;
+            }
+            uint32 stack[max_depth];
+            size_t top = 0;
+            stack[top++] = 0;
+            while (top != 0) {
+                const size_t n = stack[--top];
+                const BvhNode<T>& node = _nodes[n];
+                if (!intersects(ray, node.bounds, t_max)) {
+                    continue;
+                }
+                if (!node.is_leaf()) {
+                    stack[top++] = node.first;
+                    stack[top++] = static_cast<uint32>(n + 1);
+                    continue;
+                }
+                for (size_t slot = node.first; slot < node.first + node.count; slot++) {
+                    if (hit(static_cast<size_t>(_indices[slot]), t_max) < t_max) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Calls fn(primitive) for every primitive whose box intersects box (e.g. a broadphase query)
+        template<typename F>
+        void overlap(const Aabb<T>& box, F&& fn) const {
+            if (_nodes.empty()) {
+                return;
+            }
+            uint32 stack[max_depth];
+            size_t top = 0;
+            stack[top++] = 0;
+            while (top != 0) {
+                const size_t n = stack[--top];
+                const BvhNode<T>& node = _nodes[n];
+                if (!intersects(node.bounds, box)) {
+                    continue;
+                }
+                if (!node.is_leaf()) {
+                    stack[top++] = node.first;
+                    stack[top++] = static_cast<uint32>(n + 1);
+                    continue;
+                }
+                for (size_t slot = node.first; slot < node.first + node.count; slot++) {
+                    if (intersects(_boxes[slot], box)) {
+                        fn(static_cast<size_t>(_indices[slot]));
+                    }
+                }
+            }
+        }
+
+    private:
+        // primitive data the build partitions in place, so every pass over a range reads memory in order
+        struct BuildPrim {
+            Aabb<T> box;
+            Vector<T, 3> centroid;
+            uint32 index;
+        };
+        // slots [begin, end) still to be built, with the bounds of their boxes and of their centroids
+        struct Range {
+            size_t begin, end, depth;
+            Aabb<T> box, centroids;
+        };
+        // node of the serially built top of the tree; task != npos makes it a subtree built by a pool task
+        struct TopNode {
+            Aabb<T> bounds;
+            size_t left, right;
+            size_t task;
+        };
+        struct Bins {
+            Aabb<T> box[num_bins];
+            Aabb<T> centroids[num_bins];
+            size_t count[num_bins] = {};
+        };
+
+        static void grow(Aabb<T>& box, const Vector<T, 3>& lo, const Vector<T, 3>& hi) {
+            for (size_t k = 0; k < 3; k++) {
+                box.min[k] = lo[k] < box.min[k] ? lo[k] : box.min[k];
+                box.max[k] = hi[k] > box.max[k] ? hi[k] : box.max[k];
+            }
+        }
+
+        // Copies the input and sets up the root range; false if there is nothing to build
+        bool init(const Aabb<T>* boxes, size_t count, size_t max_leaf_size, size_t min_chunk) {
+            _max_leaf_size = max_leaf_size ? max_leaf_size : 1;
+            _nodes.clear();
+            _nodes.reserve(count ? 2 * count - 1 : 0);
+            _prims.clear();
+            _prims.reserve(count);
+            for (size_t n = 0; n < count; n++) {
+                _prims.push_back({ boxes[n], center(boxes[n]), static_cast<uint32>(n) });
+            }
+            _root.begin = 0;
+            _root.end = count;
+            _root.depth = 0;
+            range_bounds(_root, min_chunk);
+            return count != 0;
+        }
+
+        void finish() {
+            _indices.resize(_prims.size());
+            _boxes.resize(_prims.size());
+            for (size_t slot = 0; slot < _prims.size(); slot++) {
+                _indices[slot] = _prims[slot].index;
+                _boxes[slot] = _prims[slot].box;
+            }
+            _prims.clear();
+            _prims.shrink_to_fit();
+        }
+
+        // Runs fn(begin, end) over [begin, end) in chunks on the thread pool, or in one call when min_chunk is npos
+        template<typename F>
+        static void for_chunks(size_t begin, size_t end, size_t min_chunk, F&& fn) {
+            if (min_chunk == npos) {
+                fn(begin, end);
+                return;
+            }
+            parallel::for_range(end - begin, min_chunk, [&](size_t b, size_t e) { fn(begin + b, begin + e); });
+        }
+
+        void range_bounds(Range& range, size_t min_chunk) const {
+            range.box = range.centroids = Aabb<T>();
+            std::mutex mutex;
+            for_chunks(range.begin, range.end, min_chunk, [&](size_t b, size_t e) {
+                Aabb<T> box, centroids;
+                for (size_t slot = b; slot < e; slot++) {
+                    grow(box, _prims[slot].box.min, _prims[slot].box.max);
+                    grow(centroids, _prims[slot].centroid, _prims[slot].centroid);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                grow(range.box, box.min, box.max);
+                grow(range.centroids, centroids.min, centroids.max);
+            });
+        }
+
+        /* Picks the split of a range and partitions its slots around it, filling in both halves.
+        * Returns false if the range should become a leaf.
+        * */
+        bool split(const Range& range, size_t min_chunk, Range& left, Range& right) {
+            const size_t count = range.end - range.begin;
+            if (count <= 1) {
+                return false;
+            }
+            left.begin = range.begin;
+            right.end = range.end;
+            left.depth = right.depth = range.depth + 1;
+
+            const Vector<T, 3> extent = range.centroids.max - range.centroids.min;
+            size_t axis = extent.y > extent.x ? 1 : 0;
+            axis = extent.z > extent[axis] ? 2 : axis;
+            BuildPrim* prims = _prims.data();
+            if (!(extent[axis] > static_cast<T>(0.0)) || range.depth + detail::ceil_log2(count) + 1 >= max_depth) {
+                // all centroids coincide, or the tree is getting deep: median splits halve the range every level,
+                // which keeps the leaves small and bounds the depth
+                if (count <= _max_leaf_size) {
+                    return false;
+                }
+                left.end = right.begin = range.begin + count / 2;
+                std::nth_element(prims + range.begin, prims + left.end, prims + range.end,
+                                 [=](const BuildPrim& a, const BuildPrim& b) { return a.centroid[axis] < b.centroid[axis]; });
+                range_bounds(left, min_chunk);
+                range_bounds(right, min_chunk);
+                return true;
+            }
+
+            const T lo = range.centroids.min[axis];
+            const T scale = static_cast<T>(num_bins) / extent[axis];
+            auto bin_of = [=](const BuildPrim& prim) {
+                const T b = (prim.centroid[axis] - lo) * scale;
+                return b < static_cast<T>(num_bins) ? static_cast<size_t>(static_cast<int>(b)) : num_bins - 1;
+            };
+
+            auto bin_range = [&](size_t b, size_t e, Bins& out) {
+                for (size_t slot = b; slot < e; slot++) {
+                    const size_t bin = bin_of(prims[slot]);
+                    grow(out.box[bin], prims[slot].box.min, prims[slot].box.max);
+                    grow(out.centroids[bin], prims[slot].centroid, prims[slot].centroid);
+                    out.count[bin]++;
+                }
+            };
+            Bins bins;
+            if (min_chunk == npos) {
+                bin_range(range.begin, range.end, bins);
+            }
+            else {
+                std::mutex mutex;
+                for_chunks(range.begin, range.end, min_chunk, [&](size_t b, size_t e) {
+                    Bins chunk;
+                    bin_range(b, e, chunk);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (size_t bin = 0; bin < num_bins; bin++) {
+                        grow(bins.box[bin], chunk.box[bin].min, chunk.box[bin].max);
+                        grow(bins.centroids[bin], chunk.centroids[bin].min, chunk.centroids[bin].max);
+                        bins.count[bin] += chunk.count[bin];
+                    }
+                });
+            }
+
+            // cost of splitting before bin i: area(left) * count(left) + area(right) * count(right)
+            T right_cost[num_bins];
+            Aabb<T> acc;
+            size_t acc_count = 0;
+            for (size_t bin = num_bins - 1; bin > 0; bin--) {
+                grow(acc, bins.box[bin].min, bins.box[bin].max);
+                acc_count += bins.count[bin];
+                right_cost[bin] = acc_count ? surface_area(acc) * static_cast<T>(acc_count) : static_cast<T>(0.0);
+            }
+            acc = Aabb<T>();
+            acc_count = 0;
+            size_t best_bin = 0;
+            T best_cost = std::numeric_limits<T>::max();
+            for (size_t bin = 1; bin < num_bins; bin++) {
+                grow(acc, bins.box[bin - 1].min, bins.box[bin - 1].max);
+                acc_count += bins.count[bin - 1];
+                if (acc_count == 0 || acc_count == count) {
+                    continue;
+                }
+                const T cost = surface_area(acc) * static_cast<T>(acc_count) + right_cost[bin];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_bin = bin;
+                }
+            }
+
+            // one traversal step is priced like one primitive test
+            const T area = surface_area(range.box);
+            if (best_bin == 0 || (count <= _max_leaf_size && area + best_cost >= area * static_cast<T>(count))) {
+                return false;
+            }
+            left.end = right.begin = static_cast<size_t>(std::partition(prims + range.begin, prims + range.end,
+                                                                        [&](const BuildPrim& prim) { return bin_of(prim) < best_bin; }) - prims);
+            // both halves' bounds come straight from the bins
+            left.box = left.centroids = right.box = right.centroids = Aabb<T>();
+            for (size_t bin = 0; bin < num_bins; bin++) {
+                Range& half = bin < best_bin ? left : right;
+                grow(half.box, bins.box[bin].min, bins.box[bin].max);
+                grow(half.centroids, bins.centroids[bin].min, bins.centroids[bin].max);
+            }
+            return true;
+        }
+
+        // Builds the subtree over a range depth-first into nodes; right children index into nodes
+        void build_node(std::vector<BvhNode<T>>& nodes, const Range& range) {
+            const size_t n = nodes.size();
+            nodes.push_back({ range.box, static_cast<uint32>(range.begin), static_cast<uint32>(range.end - range.begin) });
+            Range left, right;
+            if (!split(range, npos, left, right)) {
+                return;
+            }
+            build_node(nodes, left);
+            nodes[n].first = static_cast<uint32>(nodes.size());
+            nodes[n].count = 0;
+            build_node(nodes, right);
+        }
+
+        // Splits ranges on the calling thread until they are smaller than min_task, which become tasks
+        size_t plan(std::vector<TopNode>& top, std::vector<Range>& tasks, const Range& range, size_t min_task) {
+            const size_t n = top.size();
+            top.push_back({ range.box, npos, npos, npos });
+            Range left, right;
+            if (range.end - range.begin < min_task || !split(range, min_task, left, right)) {
+                top[n].task = tasks.size();
+                tasks.push_back(range);
+                return n;
+            }
+            const size_t l = plan(top, tasks, left, min_task);
+            const size_t r = plan(top, tasks, right, min_task);
+            top[n].left = l;
+            top[n].right = r;
+            return n;
+        }
+
+        // Emits the top tree depth-first into _nodes, copying task subtrees in with their indices offset
+        void splice(const std::vector<TopNode>& top, const std::vector<std::vector<BvhNode<T>>>& subtrees, size_t t) {
+            if (top[t].task != npos) {
+                const uint32 base = static_cast<uint32>(_nodes.size());
+                for (BvhNode<T> node : subtrees[top[t].task]) {
+                    node.first += node.is_leaf() ? 0 : base;
+                    _nodes.push_back(node);
+                }
+                return;
+            }
+            const size_t n = _nodes.size();
+            _nodes.push_back({ top[t].bounds, 0, 0 });
+            splice(top, subtrees, top[t].left);
+            _nodes[n].first = static_cast<uint32>(_nodes.size());
+            splice(top, subtrees, top[t].right);
+        }
+
+        std::vector<BvhNode<T>> _nodes;
+        std::vector<uint32> _indices;          // primitive index of each leaf slot
+        std::vector<Aabb<T>> _boxes;           // primitive box of each leaf slot
+        std::vector<BuildPrim> _prims;         // build only
+        Range _root;
+        size_t _max_leaf_size = 4;
+    };
+
+    typedef Bvh<double> Bvh_highp;
+}
+
+#endif // __LAML_BVH_H
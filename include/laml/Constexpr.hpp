@@ -0,0 +1,123 @@
+#ifndef __LAML_CONSTEXPR_H
+#define __LAML_CONSTEXPR_H
+
+#include <laml/Constants.hpp>
+#include <type_traits>
+#include <limits>
+#include <math.h>
+#include <cmath>
+
+/* Lets one function take a constexpr path at compile time and the usual library call at run time.
+* C++20 has std::is_constant_evaluated; GCC 9+, clang 9+ and MSVC 16.5+ expose the builtin in C++17 too.
+* Without either, the run time path is always taken and the functions below only work at run time.
+* */
+#if defined(__cpp_lib_is_constant_evaluated)
+    #define LAML_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__clang__)
+    #if __clang_major__ >= 9
+        #define LAML_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#elif defined(__GNUC__)
+    #if __GNUC__ >= 9
+        #define LAML_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#elif defined(_MSC_VER)
+    #if _MSC_VER >= 1925
+        #define LAML_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#endif
+#ifndef LAML_IS_CONSTANT_EVALUATED
+    #define LAML_IS_CONSTANT_EVALUATED() false
+#endif
+
+namespace laml {
+
+    /* constexpr math
+    * At run time these are exactly the <cmath> calls the rest of the library makes, so results do not change.
+    * At compile time sqrt is Newton's method and sin/cos are Taylor series after range reduction,
+    * both in double and good to about an ulp of double - well inside float precision.
+    * */
+    namespace cx {
+        namespace detail {
+            constexpr double sqrt(double x) {
+                if (!(x > 0.0) || x == std::numeric_limits<double>::infinity()) {
+                    return x == 0.0 || x > 0.0 ? x : std::numeric_limits<double>::quiet_NaN();
+                }
+
+                // scale by powers of 4 into [0.25, 4) so the iteration starts close, then undo it exactly
+                double scale = 1.0;
+                while (x >= 4.0) { x *= 0.25; scale *= 2.0; }
+                while (x < 0.25) { x *= 4.0; scale *= 0.5; }
+                double r = 1.0;
+                for (int n = 0; n < 8; n++) {
+                    r = 0.5 * (r + x / r);
+                }
+                return r * scale;
+            }
+
+            // reduce to [-pi/2, pi/2] for sin, using sin(pi - x) = sin(x)
+            constexpr double reduce_sin(double x) {
+                const double pi = constants::pi<double>;
+                const double k = static_cast<double>(static_cast<long long>(x / (2.0 * pi) + (x < 0.0 ? -0.5 : 0.5)));
+                x = x - k * (2.0 * pi);
+                if (x > 0.5 * pi) return pi - x;
+                if (x < -0.5 * pi) return -pi - x;
+                return x;
+            }
+
+            constexpr double sin(double x) {
+                x = reduce_sin(x);
+                const double x2 = x * x;
+                double term = x, sum = x;
+                for (int n = 1; n < 12; n++) {
+                    term = -term * x2 / static_cast<double>((2 * n) * (2 * n + 1));
+                    sum = sum + term;
+                }
+                return sum;
+            }
+
+            constexpr double cos(double x) {
+                return sin(x + 0.5 * constants::pi<double>);
+            }
+        }
+
+        template<typename T>
+        constexpr T abs(T x) {
+            return x < static_cast<T>(0) ? -x : x;
+        }
+
+        template<typename T>
+        constexpr T sqrt(T x) {
+            if (LAML_IS_CONSTANT_EVALUATED()) {
+                return static_cast<T>(detail::sqrt(static_cast<double>(x)));
+            }
+            return static_cast<T>(std::sqrt(x));
+        }
+
+        template<typename T>
+        constexpr T sin(T x) {
+            if (LAML_IS_CONSTANT_EVALUATED()) {
+                return static_cast<T>(detail::sin(static_cast<double>(x)));
+            }
+            return static_cast<T>(std::sin(x));
+        }
+
+        template<typename T>
+        constexpr T cos(T x) {
+            if (LAML_IS_CONSTANT_EVALUATED()) {
+                return static_cast<T>(detail::cos(static_cast<double>(x)));
+            }
+            return static_cast<T>(std::cos(x));
+        }
+
+        template<typename T>
+        constexpr T tan(T x) {
+            if (LAML_IS_CONSTANT_EVALUATED()) {
+                return static_cast<T>(detail::sin(static_cast<double>(x)) / detail::cos(static_cast<double>(x)));
+            }
+            return static_cast<T>(std::tan(x));
+        }
+    }
+}
+
+#endif // __LAML_CONSTEXPR_H
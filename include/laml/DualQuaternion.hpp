@@ -0,0 +1,309 @@
+#ifndef __LAML_DUAL_QUATERNION_H
+#define __LAML_DUAL_QUATERNION_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+
+namespace laml {
+
+    /* Rigid transforms as dual quaternions: real is the rotation, dual is half the translation times the rotation.
+    * 8 values instead of a 4x4 matrix's 16, and a weighted sum of them (normalized) is still a rigid transform,
+    * so blending bones with them does not shrink the mesh the way blending matrices does.
+    * There is no scale: use matrices (or scale separately) for bones that are not rigid.
+    * */
+    template<typename T>
+    struct DualQuaternion {
+
+        typedef T Type;
+
+        Quaternion<T> real;
+        Quaternion<T> dual;
+
+        constexpr inline size_t num_elements() const { return 8; }
+
+        // Default constructor, the identity transform
+        constexpr DualQuaternion() : real(), dual(0, 0, 0, 0) {}
+
+        constexpr DualQuaternion(const Quaternion<T>& real_part, const Quaternion<T>& dual_part) : real(real_part), dual(dual_part) {}
+
+        // Rotation by rot_quat (unit length), then translation by trans_vec
+        constexpr DualQuaternion(const Quaternion<T>& rot_quat, const Vector<T, 3>& trans_vec)
+            : real(rot_quat), dual(mul(Quaternion<T>(trans_vec[0], trans_vec[1], trans_vec[2], 0), rot_quat) * static_cast<T>(0.5)) {}
+
+        //// access like an array: real x, y, z, w, then dual x, y, z, w
+        constexpr T& operator[](size_t idx) {
+            return idx < 4 ? real[idx] : dual[idx - 4];
+        }
+        constexpr const T& operator[](size_t idx) const {
+            return idx < 4 ? real[idx] : dual[idx - 4];
+        }
+    };
+
+    // Component-wise, for weighted blends
+    template<typename T>
+    constexpr DualQuaternion<T> operator+(const DualQuaternion<T>& a, const DualQuaternion<T>& b) {
+        return DualQuaternion<T>(a.real + b.real, a.dual + b.dual);
+    }
+    template<typename T>
+    constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& dq, const T& factor) {
+        return DualQuaternion<T>(dq.real * factor, dq.dual * factor);
+    }
+    template<typename T>
+    constexpr DualQuaternion<T> operator*(const T& factor, const DualQuaternion<T>& dq) {
+        return DualQuaternion<T>(dq.real * factor, dq.dual * factor);
+    }
+
+    // a * b applies b first, then a (same order as mul() on quaternions and matrices)
+    template<typename T>
+    constexpr DualQuaternion<T> mul(const DualQuaternion<T>& a, const DualQuaternion<T>& b) {
+        return DualQuaternion<T>(mul(a.real, b.real), mul(a.real, b.dual) + mul(a.dual, b.real));
+    }
+
+    // The inverse, for unit dual quaternions
+    template<typename T>
+    constexpr DualQuaternion<T> conjugate(const DualQuaternion<T>& dq) {
+        return DualQuaternion<T>(conjugate(dq.real), conjugate(dq.dual));
+    }
+
+    // Divides both parts by |real|. The part of dual along real is not removed: it never reaches
+    // translation() or transform_point(), which only use the vector part of 2 * dual * conj(real).
+    template<typename T, typename Math = math::default_policy>
+    constexpr DualQuaternion<T> normalize(const DualQuaternion<T>& dq, Math = Math()) {
+        const T inv_mag = Math::rsqrt(length_sq(dq.real));
+        return dq * inv_mag;
+    }
+
+    // For unit dual quaternions: the translation is the vector part of 2 * dual * conj(real)
+    template<typename T>
+    constexpr Vector<T, 3> translation(const DualQuaternion<T>& dq) {
+        const Quaternion<T>& r = dq.real;
+        const Quaternion<T>& d = dq.dual;
+        const T two = constants::two<T>;
+        return Vector<T, 3>(
+            two * (r[3] * d[0] - d[3] * r[0] + (r[1] * d[2] - r[2] * d[1])),
+            two * (r[3] * d[1] - d[3] * r[1] + (r[2] * d[0] - r[0] * d[2])),
+            two * (r[3] * d[2] - d[3] * r[2] + (r[0] * d[1] - r[1] * d[0])));
+    }
+
+    namespace transform {
+        // Rotate, then translate
+        template<typename T>
+        constexpr Vector<T, 3> transform_point(const DualQuaternion<T>& dq, const Vector<T, 3>& vec) {
+            return rotate(dq.real, vec) + translation(dq);
+        }
+        // Directions (normals) are only rotated
+        template<typename T>
+        constexpr Vector<T, 3> transform_vector(const DualQuaternion<T>& dq, const Vector<T, 3>& vec) {
+            return rotate(dq.real, vec);
+        }
+
+        template<typename T>
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const DualQuaternion<T>& dq) {
+            create_transform(mat, dq.real, translation(dq));
+        }
+
+        // Rotation and translation of a rigid 4x4 transform; any scale is not representable and must not be present
+        template<typename T>
+        constexpr DualQuaternion<T> dual_quat_from_mat(const Matrix<T, 4, 4>& mat) {
+            return DualQuaternion<T>(quat_from_mat(Matrix<T, 3, 3>(
+                mat[0][0], mat[0][1], mat[0][2],
+                mat[1][0], mat[1][1], mat[1][2],
+                mat[2][0], mat[2][1], mat[2][2])), Vector<T, 3>(mat[3][0], mat[3][1], mat[3][2]));
+        }
+    }
+
+    /* Dual-quaternion linear blending: the weighted sum of dqs, each flipped into the same hemisphere as dqs[0]
+    * (q and -q are the same rotation, and summing across hemispheres would cancel them out), normalized.
+    * The weights need not add up to one. With no dqs, or no weight to normalize (all zero), the result is the identity.
+    * */
+    template<typename T>
+    constexpr DualQuaternion<T> blend(const DualQuaternion<T>* dqs, const T* weights, size_t count) {
+        DualQuaternion<T> res(Quaternion<T>(0, 0, 0, 0), Quaternion<T>(0, 0, 0, 0));
+        for (size_t n = 0; n < count; n++) {
+            const T w = dot(dqs[n].real, dqs[0].real) < constants::zero<T> ? -weights[n] : weights[n];
+            res = res + dqs[n] * w;
+        }
+        if (dot(res.real, res.real) == constants::zero<T>) {
+            return DualQuaternion<T>();
+        }
+        return normalize(res, math::precise());
+    }
+
+    namespace detail {
+        // Vertices per tile: blended into stack lanes, then normalized and applied one packet at a time
+        constexpr size_t skin_tile_size = 128;
+
+        // blend() of the tile's vertices without the normalization, into blended[component][vertex]:
+        // real x, y, z, w, then dual x, y, z, w. Lanes past the end of the tile get the identity, so the last packet stays finite.
+        template<typename T>
+        inline void blend_tile(const DualQuaternion<T>* bones, const uint16* joints, const T* weights, size_t tile, T (&blended)[8][skin_tile_size]) {
+            size_t i = 0;
+#if defined(LAML_SIMD_SSE)
+            // four vertices at a time: each vertex blends its bones as two 128-bit vectors, and a 4x4 transpose
+            // per half turns them into lanes
+            if constexpr (std::is_same<T, float>::value) {
+                const __m128 sign = _mm_set1_ps(-0.0f);
+                const __m128 identity = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+                for (; i < tile; i += 4) {
+                    __m128 real[4], dual[4];
+                    for (size_t v = 0; v < 4; v++) {
+                        if (i + v >= tile) {
+                            real[v] = identity;
+                            dual[v] = _mm_setzero_ps();
+                            continue;
+                        }
+                        const uint16* j = joints + 4 * (i + v);
+                        const float* w = weights + 4 * (i + v);
+                        const __m128 pivot = _mm_loadu_ps(bones[j[0]].real._data);
+                        const __m128 w0 = _mm_set1_ps(w[0]);
+                        real[v] = _mm_mul_ps(pivot, w0);
+                        dual[v] = _mm_mul_ps(_mm_loadu_ps(bones[j[0]].dual._data), w0);
+                        for (size_t k = 1; k < 4; k++) {
+                            const __m128 bone_real = _mm_loadu_ps(bones[j[k]].real._data);
+                            // dot(bone.real, pivot) in every lane; its sign bit flips the weight, without a branch
+                            __m128 d = _mm_mul_ps(bone_real, pivot);
+                            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, 0x4E));
+                            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, 0xB1));
+                            const __m128 wk = _mm_xor_ps(_mm_set1_ps(w[k]), _mm_and_ps(d, sign));
+                            real[v] = _mm_add_ps(real[v], _mm_mul_ps(bone_real, wk));
+                            dual[v] = _mm_add_ps(dual[v], _mm_mul_ps(_mm_loadu_ps(bones[j[k]].dual._data), wk));
+                        }
+                    }
+                    _MM_TRANSPOSE4_PS(real[0], real[1], real[2], real[3]);
+                    _MM_TRANSPOSE4_PS(dual[0], dual[1], dual[2], dual[3]);
+                    for (size_t c = 0; c < 4; c++) {
+                        _mm_store_ps(blended[c] + i, real[c]);
+                        _mm_store_ps(blended[4 + c] + i, dual[c]);
+                    }
+                }
+            }
+#endif
+            for (; i < tile; i++) {
+                const uint16* j = joints + 4 * i;
+                const T* w = weights + 4 * i;
+                const Quaternion<T>& pivot = bones[j[0]].real;
+                T acc[8];
+                for (size_t c = 0; c < 4; c++) {
+                    acc[c] = pivot[c] * w[0];
+                    acc[4 + c] = bones[j[0]].dual[c] * w[0];
+                }
+                for (size_t k = 1; k < 4; k++) {
+                    const DualQuaternion<T>& bone = bones[j[k]];
+                    // the sign of the dot product, without a branch: the hemispheres are random per vertex
+                    const T wk = std::copysign(w[k], dot(bone.real, pivot));
+                    for (size_t c = 0; c < 4; c++) {
+                        acc[c] += bone.real[c] * wk;
+                        acc[4 + c] += bone.dual[c] * wk;
+                    }
+                }
+                for (size_t c = 0; c < 8; c++) {
+                    blended[c][i] = acc[c];
+                }
+            }
+            for (; i < skin_tile_size; i++) {
+                for (size_t c = 0; c < 8; c++) {
+                    blended[c][i] = (c == 3) ? constants::one<T> : constants::zero<T>;
+                }
+            }
+        }
+
+        template<typename T>
+        void skin_dq(const DualQuaternion<T>* bones, const uint16* joints, const T* weights,
+                     const soa::ConstVectorView<T, 3>& positions, const soa::ConstVectorView<T, 3>* normals,
+                     soa::VectorView<T, 3>& out_positions, soa::VectorView<T, 3>* out_normals) {
+            typedef simd::packet<T> P;
+            const size_t count = out_positions.size();
+            const P one = simd::set1(constants::one<T>);
+
+            alignas(simd::alignment) T blended[8][skin_tile_size];
+            alignas(simd::alignment) T staged[4][3][skin_tile_size];
+            for (size_t base = 0; base < count; base += skin_tile_size) {
+                const size_t tile = (count - base < skin_tile_size) ? (count - base) : skin_tile_size;
+
+                blend_tile(bones, joints + 4 * base, weights + 4 * base, tile, blended);
+
+                // strided (AoS) views go through contiguous copies of the tile, as in laml::skin()
+                const T* pos[3];
+                const T* nrm[3] = {};
+                T* out_pos[3];
+                T* out_nrm[3] = {};
+                soa::detail::stage_in(positions, base, tile, staged[0], pos);
+                soa::detail::stage_out(out_positions, base, staged[1], out_pos);
+                if (out_normals) {
+                    soa::detail::stage_in(*normals, base, tile, staged[2], nrm);
+                    soa::detail::stage_out(*out_normals, base, staged[3], out_nrm);
+                }
+
+                for (size_t idx = 0; idx < tile; idx += P::width) {
+                    const size_t n = (tile - idx < P::width) ? (tile - idx) : P::width;
+                    P real[4], dual[4];
+                    for (size_t c = 0; c < 4; c++) {
+                        real[c] = simd::loadu(blended[c] + idx);
+                        dual[c] = simd::loadu(blended[4 + c] + idx);
+                    }
+                    const P inv_len = one / simd::sqrt(real[0] * real[0] + real[1] * real[1] + real[2] * real[2] + real[3] * real[3]);
+                    for (size_t c = 0; c < 4; c++) {
+                        real[c] = real[c] * inv_len;
+                        dual[c] = dual[c] * inv_len;
+                    }
+                    // translation(), per lane
+                    const P tx = real[3] * dual[0] - dual[3] * real[0] + (real[1] * dual[2] - real[2] * dual[1]);
+                    const P ty = real[3] * dual[1] - dual[3] * real[1] + (real[2] * dual[0] - real[0] * dual[2]);
+                    const P tz = real[3] * dual[2] - dual[3] * real[2] + (real[0] * dual[1] - real[1] * dual[0]);
+
+                    P v[3], r[3];
+                    for (size_t c = 0; c < 3; c++) {
+                        v[c] = soa::detail::gather(pos[c], idx, 1, n);
+                    }
+                    soa::detail::rotate(real[0], real[1], real[2], real[3], v, r);
+                    soa::detail::scatter(out_pos[0], idx, 1, n, r[0] + (tx + tx));
+                    soa::detail::scatter(out_pos[1], idx, 1, n, r[1] + (ty + ty));
+                    soa::detail::scatter(out_pos[2], idx, 1, n, r[2] + (tz + tz));
+
+                    if (out_normals) {
+                        for (size_t c = 0; c < 3; c++) {
+                            v[c] = soa::detail::gather(nrm[c], idx, 1, n);
+                        }
+                        soa::detail::rotate(real[0], real[1], real[2], real[3], v, r);
+                        for (size_t c = 0; c < 3; c++) {
+                            soa::detail::scatter(out_nrm[c], idx, 1, n, r[c]);
+                        }
+                    }
+                }
+
+                soa::detail::stage_flush(out_positions, base, tile, staged[1]);
+                if (out_normals) {
+                    soa::detail::stage_flush(*out_normals, base, tile, staged[3]);
+                }
+            }
+        }
+    }
+
+    /* Dual-quaternion skinning over a vertex stream, simd::packet<T>::width vertices at a time.
+    * Every vertex has 4 influences: joints[4 * i + k] indexes bones and weights[4 * i + k] is its weight
+    * (weights must not be negative, at least one must not be zero; unused influences get weight 0).
+    * Each vertex is moved by blend() of its bones.
+    * Views may be SoA arrays or soa::view() over plain Vector<T,3> arrays; outputs may be the inputs.
+    * Dual quaternions are picked for how they blend (no volume loss at twisted joints) and their size, not for speed:
+    * on SSE2 and AVX2, float SoA streams run about as fast as a blended Mat4 + transform_point loop, AoS views
+    * 10-30% slower, and blend() + transform_point per vertex at about a quarter of its speed.
+    * */
+    template<typename T>
+    void skin_dq(const DualQuaternion<T>* bones, const uint16* joints, const T* weights,
+                 const soa::ConstVectorView<T, 3>& positions, soa::VectorView<T, 3> out_positions) {
+        detail::skin_dq<T>(bones, joints, weights, positions, nullptr, out_positions, nullptr);
+    }
+    // Normals are rotated only
+    template<typename T>
+    void skin_dq(const DualQuaternion<T>* bones, const uint16* joints, const T* weights,
+                 const soa::ConstVectorView<T, 3>& positions, const soa::ConstVectorView<T, 3>& normals,
+                 soa::VectorView<T, 3> out_positions, soa::VectorView<T, 3> out_normals) {
+        detail::skin_dq<T>(bones, joints, weights, positions, &normals, out_positions, &out_normals);
+    }
+
+    // Useful shorthands
+    typedef DualQuaternion<float> DualQuat;
+    typedef DualQuaternion<double> DualQuat_highp;
+}
+
+#endif // __LAML_DUAL_QUATERNION_H
@@ -0,0 +1,194 @@
+#ifndef __LAML_EXPR_H
+#define __LAML_EXPR_H
+
+#include <laml/Vector.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace laml {
+
+    /* Opt-in expression templates for component-wise vector arithmetic.
+    * The operators in Vector.hpp return a new Vector per operation, so a*s + b*t - c makes three temporaries
+    * and walks the data four times. Wrapping an operand in expr::lazy() builds the whole expression as a type
+    * instead, and nothing is computed until it is assigned, in one loop with no temporaries:
+    *
+    *   laml::Vector<float, 256> r = laml::expr::lazy(a) * s + laml::expr::lazy(b) * t - c;
+    *   laml::expr::assign(r, laml::expr::lerp(r, b, t));   // in place: r may also be an operand
+    *
+    * Every sub-expression needs an expr operand to be lazy: in lazy(a) * s + b * t, b * t is a plain Vector.
+    * Each element is computed with the same operations, in the same order, as the plain operators; the results
+    * match bit for bit only without floating-point contraction (-ffp-contract=off), since the compiler is free to
+    * fuse a*s + b*t into FMAs differently in the two forms.
+    *
+    * Works on Vector<T, N> and on anything with operator[] and size(), e.g. VectorX from laml/MatrixX.hpp.
+    * Expressions refer to their operands: evaluate them within the statement that builds them
+    * (never keep an auto e = lazy(a) + b * t; around, b * t dies at the semicolon).
+    * */
+    namespace expr {
+
+        // all expression nodes derive from this, so the operators below only ever see expressions
+        struct node_base {};
+
+        template<typename E>
+        struct is_expr : std::is_base_of<node_base, E> {};
+
+        namespace detail {
+            template<typename T, size_t N>
+            constexpr size_t extent(const Vector<T, N>&) { return N; }
+            template<typename V>
+            constexpr auto extent(const V& v) -> decltype(v.size()) { return v.size(); }
+
+            // how to make the result of an expression
+            template<typename R>
+            struct result {
+                static R make(size_t size) { return R(size); }
+            };
+            template<typename T, size_t N>
+            struct result<Vector<T, N>> {
+                static constexpr Vector<T, N> make(size_t) { return Vector<T, N>(); }
+            };
+
+            struct add { template<typename T> static constexpr T apply(T a, T b) { return a + b; } };
+            struct sub { template<typename T> static constexpr T apply(T a, T b) { return a - b; } };
+            struct mul { template<typename T> static constexpr T apply(T a, T b) { return a * b; } };
+            struct div { template<typename T> static constexpr T apply(T a, T b) { return a / b; } };
+        }
+
+        // dst[i] = e[i] for every element, one pass
+        template<typename Dst, typename E>
+        constexpr void assign(Dst& dst, const E& e) {
+            const size_t size = e.size();
+            for (size_t n = 0; n < size; n++) {
+                dst[n] = e[n];
+            }
+        }
+
+        template<typename E>
+        constexpr typename E::result_type eval(const E& e) {
+            typename E::result_type res = detail::result<typename E::result_type>::make(e.size());
+            assign(res, e);
+            return res;
+        }
+
+        // CRTP base: converts to the result type, so an expression can be used wherever a vector is expected
+        template<typename E, typename R>
+        struct node : node_base {
+            typedef R result_type;
+            constexpr operator R() const { return eval(static_cast<const E&>(*this)); }
+        };
+
+        // leaf: a reference to a vector
+        template<typename V>
+        struct ref : node<ref<V>, V> {
+            typedef typename std::decay<decltype(std::declval<const V&>()[0])>::type value_type;
+            constexpr explicit ref(const V& v) : _v(v) {}
+            constexpr value_type operator[](size_t idx) const { return _v[idx]; }
+            constexpr size_t size() const { return detail::extent(_v); }
+            const V& _v;
+        };
+
+        // a (op) b, component-wise
+        template<typename L, typename R, typename Op>
+        struct binary : node<binary<L, R, Op>, typename L::result_type> {
+            typedef typename L::value_type value_type;
+            constexpr binary(const L& l, const R& r) : _l(l), _r(r) {}
+            constexpr value_type operator[](size_t idx) const { return Op::apply(_l[idx], _r[idx]); }
+            constexpr size_t size() const { return _l.size(); }
+            L _l;
+            R _r;
+        };
+
+        // e (op) s, or s (op) e when scalar_first
+        template<typename E, typename Op, bool scalar_first>
+        struct scalar : node<scalar<E, Op, scalar_first>, typename E::result_type> {
+            typedef typename E::value_type value_type;
+            constexpr scalar(const E& e, value_type s) : _e(e), _s(s) {}
+            constexpr value_type operator[](size_t idx) const { return scalar_first ? Op::apply(_s, _e[idx]) : Op::apply(_e[idx], _s); }
+            constexpr size_t size() const { return _e.size(); }
+            E _e;
+            value_type _s;
+        };
+
+        template<typename E>
+        struct negate : node<negate<E>, typename E::result_type> {
+            typedef typename E::value_type value_type;
+            constexpr explicit negate(const E& e) : _e(e) {}
+            constexpr value_type operator[](size_t idx) const { return -_e[idx]; }
+            constexpr size_t size() const { return _e.size(); }
+            E _e;
+        };
+
+        // Start an expression from a vector
+        template<typename V>
+        constexpr ref<V> lazy(const V& v) { return ref<V>(v); }
+
+        namespace detail {
+            // expressions are stored by value, vectors by reference
+            template<typename X, bool = is_expr<X>::value>
+            struct operand {
+                typedef X type;
+                static constexpr const X& wrap(const X& x) { return x; }
+            };
+            template<typename X>
+            struct operand<X, false> {
+                typedef ref<X> type;
+                static constexpr ref<X> wrap(const X& x) { return ref<X>(x); }
+            };
+            template<typename X>
+            using operand_t = typename operand<X>::type;
+
+            // at least one side is an expression, and neither is a scalar
+            template<typename L, typename R>
+            using if_vector_op = typename std::enable_if<(is_expr<L>::value || is_expr<R>::value) &&
+                                                         !std::is_arithmetic<L>::value && !std::is_arithmetic<R>::value>::type;
+            template<typename E, typename S>
+            using if_scalar_op = typename std::enable_if<is_expr<E>::value && std::is_arithmetic<S>::value>::type;
+        }
+
+        template<typename L, typename R, typename = detail::if_vector_op<L, R>>
+        constexpr binary<detail::operand_t<L>, detail::operand_t<R>, detail::add> operator+(const L& l, const R& r) {
+            return { detail::operand<L>::wrap(l), detail::operand<R>::wrap(r) };
+        }
+        template<typename L, typename R, typename = detail::if_vector_op<L, R>>
+        constexpr binary<detail::operand_t<L>, detail::operand_t<R>, detail::sub> operator-(const L& l, const R& r) {
+            return { detail::operand<L>::wrap(l), detail::operand<R>::wrap(r) };
+        }
+        template<typename L, typename R, typename = detail::if_vector_op<L, R>>
+        constexpr binary<detail::operand_t<L>, detail::operand_t<R>, detail::mul> operator*(const L& l, const R& r) {
+            return { detail::operand<L>::wrap(l), detail::operand<R>::wrap(r) };
+        }
+        template<typename L, typename R, typename = detail::if_vector_op<L, R>>
+        constexpr binary<detail::operand_t<L>, detail::operand_t<R>, detail::div> operator/(const L& l, const R& r) {
+            return { detail::operand<L>::wrap(l), detail::operand<R>::wrap(r) };
+        }
+
+        template<typename E, typename S, typename = detail::if_scalar_op<E, S>>
+        constexpr scalar<E, detail::mul, false> operator*(const E& e, S s) {
+            return { e, static_cast<typename E::value_type>(s) };
+        }
+        template<typename E, typename S, typename = detail::if_scalar_op<E, S>>
+        constexpr scalar<E, detail::mul, true> operator*(S s, const E& e) {
+            return { e, static_cast<typename E::value_type>(s) };
+        }
+        template<typename E, typename S, typename = detail::if_scalar_op<E, S>>
+        constexpr scalar<E, detail::div, false> operator/(const E& e, S s) {
+            return { e, static_cast<typename E::value_type>(s) };
+        }
+
+        template<typename E, typename = typename std::enable_if<is_expr<E>::value>::type>
+        constexpr negate<E> operator-(const E& e) {
+            return negate<E>(e);
+        }
+
+        // laml::lerp(v1, v2, factor), fused: v2 * factor + v1 * (1 - factor)
+        template<typename V1, typename V2, typename S>
+        constexpr auto lerp(const V1& v1, const V2& v2, S factor) {
+            typedef typename detail::operand_t<V1>::value_type T;
+            const T f = static_cast<T>(factor);
+            return detail::operand<V2>::wrap(v2) * f + detail::operand<V1>::wrap(v1) * (static_cast<T>(1.0) - f);
+        }
+    }
+}
+
+#endif // __LAML_EXPR_H
@@ -0,0 +1,323 @@
+#ifndef __LAML_FASTMATH_H
+#define __LAML_FASTMATH_H
+
+#include <laml/Simd.hpp>
+#include <laml/Constants.hpp>
+#include <laml/Constexpr.hpp>
+#include <type_traits>
+#include <cmath>
+
+namespace laml {
+
+    /* Approximate math for hot loops.
+    * Polynomial fits (the Cephes single precision ones) after a cheap range reduction, written once against
+    * the simd packet interface so the same code serves one value, a native packet, or an array.
+    * Errors against the exact result, float, measured over the ranges given:
+    *
+    *   sin, cos, sincos   |x| < 8192          abs error < 1e-7    (~1 ulp of values near 1)
+    *   atan2              finite y, x         abs error < 3e-7    (~1 ulp of pi)
+    *   acos               [-1, 1]             abs error < 4e-7    (~2 ulp of pi)
+    *   exp                [-87.3, 88.3]       rel error < 1.2e-7  (~1 ulp)
+    *   rsqrt              x > 0               rel error < 3e-7    (~2 ulp; ~1 ulp without an estimate instruction)
+    *
+    * Outside those ranges: sin/cos lose accuracy with the reduction, acos clamps its argument to [-1, 1],
+    * exp saturates at the range ends instead of going to 0 or inf, and atan2 does not tell -0 from 0.
+    * double goes through the same polynomials, so it gets float accuracy at double cost.
+    * */
+    namespace fast {
+        namespace detail {
+            // lane type of a packet: every native packet is float
+            template<typename V> struct lane { typedef float type; };
+            template<typename T> struct lane<simd::scalar_v<T>> { typedef T type; };
+            template<typename V>
+            using lane_t = typename lane<V>::type;
+
+            template<typename V>
+            inline V k(double value) {
+                return simd::splat<lane_t<V>, V>::from(static_cast<lane_t<V>>(value));
+            }
+
+            // round to nearest by pushing the fraction out of the mantissa; |x| < 2^22 for float
+            template<typename V>
+            inline V round(V x) {
+                const V magic = k<V>(std::is_same<lane_t<V>, float>::value ? 12582912.0 : 6755399441055744.0);
+                return (x + magic) - magic;
+            }
+
+            // x = n*pi/2 + r, and the polynomials for sin(r) and cos(r)
+            template<typename V>
+            inline void sincos_reduce(V x, V& n, V& ps, V& pc) {
+                // pi/2 in three parts so the first products are exact
+                n = round(x * k<V>(0.63661977236758134));
+                const V r = ((x - n * k<V>(1.5703125)) - n * k<V>(4.837512969970703125e-4)) - n * k<V>(7.54978995489188216e-8);
+                const V z = r * r;
+                ps = ((k<V>(-1.9515295891e-4) * z + k<V>(8.3321608736e-3)) * z + k<V>(-1.6666654611e-1)) * z * r + r;
+                pc = ((k<V>(2.443315711809948e-5) * z + k<V>(-1.388731625493765e-3)) * z + k<V>(4.166664568298827e-2)) * z * z
+                    - k<V>(0.5) * z + k<V>(1.0);
+            }
+
+            template<typename V>
+            inline void sincos(V x, V& s, V& c) {
+                V n, ps, pc;
+                sincos_reduce(x, n, ps, pc);
+
+                // quadrant as n mod 4 in [-2, 2] (the rounding ties go to even, so both ends occur):
+                // odd quadrants swap sin and cos, then the signs follow the quadrant
+                const V q = n - k<V>(4.0) * round(n * k<V>(0.25));
+                const V aq = simd::abs(q);
+                const auto odd = (aq > k<V>(0.5)) & (aq < k<V>(1.5));
+                const V sw = select(odd, pc, ps);
+                const V cw = select(odd, ps, pc);
+                s = select((q < k<V>(-0.5)) | (q > k<V>(1.5)), -sw, sw);
+                c = select((q > k<V>(0.5)) | (q < k<V>(-1.5)), -cw, cw);
+            }
+
+            // one lane: the quadrant as an integer picks and signs the results without branches,
+            // which a random quadrant would mispredict
+            template<typename T>
+            inline void sincos(simd::scalar_v<T> x, simd::scalar_v<T>& s, simd::scalar_v<T>& c) {
+                simd::scalar_v<T> n, ps, pc;
+                sincos_reduce(x, n, ps, pc);
+                const int q = static_cast<int>(static_cast<long long>(n.v) & 3);
+                const T odd = static_cast<T>(q & 1), even = static_cast<T>(1) - odd;
+                s.v = (ps.v * even + pc.v * odd) * static_cast<T>(1 - 2 * ((q >> 1) & 1));
+                c.v = (pc.v * even + ps.v * odd) * static_cast<T>(1 - 2 * (((q + 1) >> 1) & 1));
+            }
+
+            template<typename V>
+            inline V sin(V x) {
+                V s, c;
+                sincos(x, s, c);
+                return s;
+            }
+
+            template<typename V>
+            inline V cos(V x) {
+                V s, c;
+                sincos(x, s, c);
+                return c;
+            }
+
+            template<typename V>
+            inline V atan2(V y, V x) {
+                const V zero = k<V>(0.0), one = k<V>(1.0);
+                const V ax = simd::abs(x), ay = simd::abs(y);
+                const V hi = simd::max(ax, ay), lo = simd::min(ax, ay);
+
+                // atan of t in [0, 1], above tan(pi/8) through atan(t) = pi/4 + atan((t - 1) / (t + 1))
+                V t = lo / select(hi > zero, hi, one);
+                const auto big = t > k<V>(0.41421356237309503);
+                t = select(big, (t - one) / (t + one), t);
+                const V z = t * t;
+                V r = (((k<V>(8.05374449538e-2) * z + k<V>(-1.38776856032e-1)) * z + k<V>(1.99777106478e-1)) * z + k<V>(-3.33329491539e-1)) * z * t + t;
+                r = select(big, r + k<V>(constants::pi<double> / 4.0), r);
+
+                // back out to the octant and quadrant of (x, y)
+                r = select(ay > ax, k<V>(constants::pi<double> / 2.0) - r, r);
+                r = select(x < zero, k<V>(constants::pi<double>) - r, r);
+                return select(y < zero, -r, r);
+            }
+
+            template<typename V>
+            inline V acos(V x) {
+                const V one = k<V>(1.0), half = k<V>(0.5);
+                const V a = simd::min(simd::abs(x), one);
+
+                // asin(s) for s = |x| <= 0.5, or s = sqrt((1 - |x|) / 2) above, where acos(|x|) = 2 asin(s)
+                const auto big = a > half;
+                const V z = select(big, half * (one - a), a * a);
+                const V s = select(big, simd::sqrt(z), a);
+                const V p = (((k<V>(4.2163199048e-2) * z + k<V>(2.4181311049e-2)) * z + k<V>(4.5470025998e-2)) * z
+                    + k<V>(7.4953002686e-2)) * z + k<V>(1.6666752422e-1);
+                const V as = s + s * z * p;
+
+                const V pi = k<V>(constants::pi<double>), half_pi = k<V>(constants::pi<double> / 2.0);
+                const V r_big = as + as;
+                const auto negative = x < k<V>(0.0);
+                return select(big, select(negative, pi - r_big, r_big), select(negative, half_pi + as, half_pi - as));
+            }
+
+            template<typename V>
+            inline V exp(V x) {
+                x = simd::min(simd::max(x, k<V>(-87.3365478515625)), k<V>(88.37626266479492));
+
+                // x = n ln2 + r, with ln2 in two parts
+                const V n = round(x * k<V>(1.44269504088896341));
+                const V r = (x - n * k<V>(0.693359375)) - n * k<V>(-2.12194440e-4);
+                const V z = r * r;
+                const V p = (((((k<V>(1.9875691500e-4) * r + k<V>(1.3981999507e-3)) * r + k<V>(8.3334519073e-3)) * r
+                    + k<V>(4.1665795894e-2)) * r + k<V>(1.6666665459e-1)) * r + k<V>(5.0000001201e-1)) * z + r + k<V>(1.0);
+                return simd::ldexp(p, n);
+            }
+
+            // hardware estimate and one Newton step
+            template<typename V>
+            inline V rsqrt(V x) {
+                const V e = simd::rsqrt(x);
+                return e * (k<V>(1.5) - k<V>(0.5) * x * e * e);
+            }
+
+            // out[n] = kernel(in[n]) a packet at a time, the tail one value at a time
+            template<typename T, typename F>
+            inline void for_each(const T* in, T* out, size_t count, F kernel) {
+                typedef simd::packet<T> P;
+                const size_t full = count - count % P::width;
+                for (size_t n = 0; n < full; n += P::width) {
+                    simd::storeu(out + n, kernel(simd::load<T, P>::from(in + n)));
+                }
+                for (size_t n = full; n < count; n++) {
+                    out[n] = kernel(simd::scalar_v<T>{ in[n] }).v;
+                }
+            }
+        }
+
+        // the scalar overloads take float and double, the packet overloads any simd::packet<T>
+        template<typename T, typename R = T>
+        using if_scalar = typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+        template<typename V, typename R = V>
+        using if_packet = typename std::enable_if<!std::is_floating_point<V>::value, R>::type;
+
+        template<typename T> inline if_scalar<T> sin(T x) { return detail::sin(simd::scalar_v<T>{ x }).v; }
+        template<typename T> inline if_scalar<T> cos(T x) { return detail::cos(simd::scalar_v<T>{ x }).v; }
+        template<typename T> inline if_scalar<T> atan2(T y, T x) { return detail::atan2(simd::scalar_v<T>{ y }, simd::scalar_v<T>{ x }).v; }
+        template<typename T> inline if_scalar<T> acos(T x) { return detail::acos(simd::scalar_v<T>{ x }).v; }
+        template<typename T> inline if_scalar<T> exp(T x) { return detail::exp(simd::scalar_v<T>{ x }).v; }
+
+        template<typename T>
+        inline if_scalar<T, void> sincos(T x, T& s, T& c) {
+            simd::scalar_v<T> vs, vc;
+            detail::sincos(simd::scalar_v<T>{ x }, vs, vc);
+            s = vs.v;
+            c = vc.v;
+        }
+
+        // one value: the single-lane estimate where there is one, otherwise a plain divide
+        template<typename T>
+        inline if_scalar<T> rsqrt(T x) {
+            return static_cast<T>(1.0) / std::sqrt(x);
+        }
+#if defined(LAML_SIMD_SSE)
+        template<>
+        inline float rsqrt(float x) {
+            const float e = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+            return e * (1.5f - 0.5f * x * e * e);
+        }
+#elif defined(LAML_SIMD_NEON) && defined(__aarch64__)
+        template<>
+        inline float rsqrt(float x) {
+            float e = vrsqrtes_f32(x);
+            e = e * vrsqrtss_f32(x * e, e);
+            return e * (1.5f - 0.5f * x * e * e);
+        }
+#endif
+
+        template<typename V> inline if_packet<V> sin(V x) { return detail::sin(x); }
+        template<typename V> inline if_packet<V> cos(V x) { return detail::cos(x); }
+        template<typename V> inline if_packet<V, void> sincos(V x, V& s, V& c) { detail::sincos(x, s, c); }
+        template<typename V> inline if_packet<V> atan2(V y, V x) { return detail::atan2(y, x); }
+        template<typename V> inline if_packet<V> acos(V x) { return detail::acos(x); }
+        template<typename V> inline if_packet<V> exp(V x) { return detail::exp(x); }
+        template<typename V> inline if_packet<V> rsqrt(V x) { return detail::rsqrt(x); }
+
+        // Batch versions: count values from in to out, which may be the same array
+        template<typename T>
+        inline void sin(const T* in, T* out, size_t count) {
+            detail::for_each(in, out, count, [](auto v) { return detail::sin(v); });
+        }
+
+        template<typename T>
+        inline void cos(const T* in, T* out, size_t count) {
+            detail::for_each(in, out, count, [](auto v) { return detail::cos(v); });
+        }
+
+        template<typename T>
+        inline void acos(const T* in, T* out, size_t count) {
+            detail::for_each(in, out, count, [](auto v) { return detail::acos(v); });
+        }
+
+        template<typename T>
+        inline void exp(const T* in, T* out, size_t count) {
+            detail::for_each(in, out, count, [](auto v) { return detail::exp(v); });
+        }
+
+        template<typename T>
+        inline void rsqrt(const T* in, T* out, size_t count) {
+            detail::for_each(in, out, count, [](auto v) { return detail::rsqrt(v); });
+        }
+
+        template<typename T>
+        inline void sincos(const T* in, T* s, T* c, size_t count) {
+            typedef simd::packet<T> P;
+            const size_t full = count - count % P::width;
+            for (size_t n = 0; n < full; n += P::width) {
+                P ps, pc;
+                detail::sincos(simd::load<T, P>::from(in + n), ps, pc);
+                simd::storeu(s + n, ps);
+                simd::storeu(c + n, pc);
+            }
+            for (size_t n = full; n < count; n++) {
+                sincos(in[n], s[n], c[n]);
+            }
+        }
+
+        template<typename T>
+        inline void atan2(const T* y, const T* x, T* out, size_t count) {
+            typedef simd::packet<T> P;
+            const size_t full = count - count % P::width;
+            for (size_t n = 0; n < full; n += P::width) {
+                simd::storeu(out + n, detail::atan2(simd::load<T, P>::from(y + n), simd::load<T, P>::from(x + n)));
+            }
+            for (size_t n = full; n < count; n++) {
+                out[n] = atan2(y[n], x[n]);
+            }
+        }
+    }
+
+    /* Precision policies, for the functions that take one as a trailing argument
+    * (normalize, slerp, create_transform_rotation, quat_from_ypr):
+    *
+    *   laml::normalize(v, laml::math::fast());
+    *
+    * precise is the library call; fast is laml::fast. Where a builder needs both the sine and the cosine
+    * of an angle it asks for them together through sincos.
+    * Leaving the argument off uses math::default_policy, which is fast when LAML_FAST_MATH is defined.
+    * */
+    namespace math {
+        struct precise {
+            static constexpr bool approximate = false;
+            template<typename T> static constexpr T sin(T x) { return cx::sin(x); }
+            template<typename T> static constexpr T cos(T x) { return cx::cos(x); }
+            template<typename T> static constexpr void sincos(T x, T& s, T& c) { s = cx::sin(x); c = cx::cos(x); }
+            template<typename T> static constexpr T rsqrt(T x) { return static_cast<T>(1.0) / cx::sqrt(x); }
+            template<typename T> static T atan2(T y, T x) { return static_cast<T>(std::atan2(y, x)); }
+            template<typename T> static T acos(T x) { return static_cast<T>(std::acos(x)); }
+            template<typename T> static T exp(T x) { return static_cast<T>(std::exp(x)); }
+        };
+
+        // at compile time the constexpr builders get the precise values
+        struct fast {
+            static constexpr bool approximate = true;
+            template<typename T> static constexpr T sin(T x) { return LAML_IS_CONSTANT_EVALUATED() ? cx::sin(x) : laml::fast::sin(x); }
+            template<typename T> static constexpr T cos(T x) { return LAML_IS_CONSTANT_EVALUATED() ? cx::cos(x) : laml::fast::cos(x); }
+            template<typename T> static constexpr void sincos(T x, T& s, T& c) {
+                if (LAML_IS_CONSTANT_EVALUATED()) {
+                    precise::sincos(x, s, c);
+                } else {
+                    laml::fast::sincos(x, s, c);
+                }
+            }
+            template<typename T> static constexpr T rsqrt(T x) { return LAML_IS_CONSTANT_EVALUATED() ? precise::rsqrt(x) : laml::fast::rsqrt(x); }
+            template<typename T> static T atan2(T y, T x) { return laml::fast::atan2(y, x); }
+            template<typename T> static T acos(T x) { return laml::fast::acos(x); }
+            template<typename T> static T exp(T x) { return laml::fast::exp(x); }
+        };
+
+#if defined(LAML_FAST_MATH)
+        typedef fast default_policy;
+#else
+        typedef precise default_policy;
+#endif
+    }
+}
+
+#endif // __LAML_FASTMATH_H
@@ -0,0 +1,206 @@
+#ifndef __LAML_FRUSTUM_H
+#define __LAML_FRUSTUM_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <laml/Parallel.hpp>
+
+namespace laml {
+    /* View frustum as six planes (a, b, c, d), normalized so a*x + b*y + c*z + d is the signed
+    * distance of a point, positive on the inside.
+    * Built from any view-projection matrix (Gribb/Hartmann): each plane is the 4th row of the
+    * matrix plus or minus one of the others, which matches the -w <= x,y,z <= w clip volume
+    * of create_projection_perspective() and create_projection_orthographic().
+    * */
+    template<typename T>
+    struct Frustum {
+        enum : size_t { plane_left, plane_right, plane_bottom, plane_top, plane_near, plane_far, num_planes };
+
+        Vector<T, 4> planes[num_planes];
+
+        // Default frustum lets everything through
+        Frustum() {
+            for (size_t p = 0; p < num_planes; p++) {
+                planes[p] = Vector<T, 4>(constants::zero<T>, constants::zero<T>, constants::zero<T>, constants::one<T>);
+            }
+        }
+        explicit Frustum(const Matrix<T, 4, 4>& view_proj) {
+            const Vector<T, 4> row1(view_proj.c_11, view_proj.c_12, view_proj.c_13, view_proj.c_14);
+            const Vector<T, 4> row2(view_proj.c_21, view_proj.c_22, view_proj.c_23, view_proj.c_24);
+            const Vector<T, 4> row3(view_proj.c_31, view_proj.c_32, view_proj.c_33, view_proj.c_34);
+            const Vector<T, 4> row4(view_proj.c_41, view_proj.c_42, view_proj.c_43, view_proj.c_44);
+            planes[plane_left] = row4 + row1;
+            planes[plane_right] = row4 - row1;
+            planes[plane_bottom] = row4 + row2;
+            planes[plane_top] = row4 - row2;
+            planes[plane_near] = row4 + row3;
+            planes[plane_far] = row4 - row3;
+
+            for (size_t p = 0; p < num_planes; p++) {
+                const Vector<T, 4>& pl = planes[p];
+                const T len = static_cast<T>(sqrt(pl.x * pl.x + pl.y * pl.y + pl.z * pl.z));
+                if (len > static_cast<T>(0.0)) {
+                    planes[p] = pl * (static_cast<T>(1.0) / len);
+                }
+            }
+        }
+    };
+
+    // Single-object tests. Bounds touching a plane count as visible.
+    template<typename T>
+    bool contains(const Frustum<T>& frustum, const Vector<T, 3>& point) {
+        for (size_t p = 0; p < Frustum<T>::num_planes; p++) {
+            const Vector<T, 4>& pl = frustum.planes[p];
+            if (pl.x * point.x + pl.y * point.y + pl.z * point.z + pl.w < static_cast<T>(0.0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool intersects_sphere(const Frustum<T>& frustum, const Vector<T, 3>& center, T radius) {
+        for (size_t p = 0; p < Frustum<T>::num_planes; p++) {
+            const Vector<T, 4>& pl = frustum.planes[p];
+            if (pl.x * center.x + pl.y * center.y + pl.z * center.z + pl.w < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Box given as center and half-extents: it is outside a plane when its
+    // center is further out than its projected radius |n.x|*e.x + |n.y|*e.y + |n.z|*e.z
+    template<typename T>
+    bool intersects_aabb(const Frustum<T>& frustum, const Vector<T, 3>& center, const Vector<T, 3>& extents) {
+        for (size_t p = 0; p < Frustum<T>::num_planes; p++) {
+            const Vector<T, 4>& pl = frustum.planes[p];
+            const T dist = pl.x * center.x + pl.y * center.y + pl.z * center.z + pl.w;
+            const T radius = static_cast<T>(fabs(pl.x)) * extents.x + static_cast<T>(fabs(pl.y)) * extents.y + static_cast<T>(fabs(pl.z)) * extents.z;
+            if (dist < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Batched culling over SoA bounds.
+    * Results are written as a visibility bitmask: object n is visible when bit (n % 32) of
+    * visible[n / 32] is set. visible must hold cull_mask_words(count) words; all of them are overwritten.
+    * Each packet of objects stops testing planes as soon as every lane is outside one, and the
+    * next packet starts with that plane, since neighbouring objects tend to fail the same one.
+    * */
+    inline size_t cull_mask_words(size_t count) {
+        return (count + 31) / 32;
+    }
+
+    namespace detail {
+        template<typename T>
+        struct FrustumPackets {
+            typedef simd::packet<T> P;
+            P nx[Frustum<T>::num_planes], ny[Frustum<T>::num_planes], nz[Frustum<T>::num_planes], nd[Frustum<T>::num_planes];
+            P ax[Frustum<T>::num_planes], ay[Frustum<T>::num_planes], az[Frustum<T>::num_planes]; // |normal|, for boxes
+
+            explicit FrustumPackets(const Frustum<T>& frustum) {
+                for (size_t p = 0; p < Frustum<T>::num_planes; p++) {
+                    const Vector<T, 4>& pl = frustum.planes[p];
+                    nx[p] = simd::set1(pl.x);
+                    ny[p] = simd::set1(pl.y);
+                    nz[p] = simd::set1(pl.z);
+                    nd[p] = simd::set1(pl.w);
+                    ax[p] = simd::abs(nx[p]);
+                    ay[p] = simd::abs(ny[p]);
+                    az[p] = simd::abs(nz[p]);
+                }
+            }
+        };
+
+        // Loads each packet of the L input lanes once, runs inside(plane, lanes) -> lane bits over the planes,
+        // plane-coherent with early out, and packs the results into the bitmask. Packet widths always divide 32.
+        template<typename T, size_t L, typename F>
+        inline void cull_packets(size_t count, const T* const (&lanes)[L], const size_t (&strides)[L], uint32* visible, F inside) {
+            typedef simd::packet<T> P;
+            for (size_t w = 0; w < cull_mask_words(count); w++) {
+                visible[w] = 0;
+            }
+
+            size_t first = 0; // plane that rejected the previous packet
+            for (size_t idx = 0; idx < count; idx += P::width) {
+                const size_t n = (count - idx < P::width) ? (count - idx) : P::width;
+                P v[L];
+                for (size_t k = 0; k < L; k++) {
+                    v[k] = soa::detail::gather(lanes[k], idx, strides[k], n);
+                }
+
+                uint32 mask = inside(first, v);
+                for (size_t k = 1; k < Frustum<T>::num_planes && mask != 0; k++) {
+                    size_t p = first + k;
+                    p = (p >= Frustum<T>::num_planes) ? p - Frustum<T>::num_planes : p;
+                    mask &= inside(p, v);
+                    if (mask == 0) {
+                        first = p;
+                    }
+                }
+                if (n < P::width) {
+                    mask &= (1u << n) - 1u;
+                }
+                visible[idx / 32] |= mask << (idx % 32);
+            }
+        }
+    }
+
+    template<typename T>
+    void cull_spheres(const Frustum<T>& frustum, const soa::ConstVectorView<T, 3>& centers, const T* radii, uint32* visible) {
+        typedef simd::packet<T> P;
+        const detail::FrustumPackets<T> fp(frustum);
+        const T* lanes[4] = { centers.lane(0), centers.lane(1), centers.lane(2), radii };
+        const size_t strides[4] = { centers.stride(), centers.stride(), centers.stride(), 1 };
+
+        detail::cull_packets(centers.size(), lanes, strides, visible, [&](size_t p, const P* v) {
+            const P dist = v[0] * fp.nx[p] + v[1] * fp.ny[p] + v[2] * fp.nz[p] + fp.nd[p];
+            return simd::bits(dist >= -v[3]);
+        });
+    }
+
+    template<typename T>
+    void cull_aabbs(const Frustum<T>& frustum, const soa::ConstVectorView<T, 3>& centers, const soa::ConstVectorView<T, 3>& extents, uint32* visible) {
+        typedef simd::packet<T> P;
+        const detail::FrustumPackets<T> fp(frustum);
+        const T* lanes[6] = { centers.lane(0), centers.lane(1), centers.lane(2), extents.lane(0), extents.lane(1), extents.lane(2) };
+        const size_t strides[6] = { centers.stride(), centers.stride(), centers.stride(), extents.stride(), extents.stride(), extents.stride() };
+
+        detail::cull_packets(centers.size(), lanes, strides, visible, [&](size_t p, const P* v) {
+            const P dist = v[0] * fp.nx[p] + v[1] * fp.ny[p] + v[2] * fp.nz[p] + fp.nd[p];
+            const P radius = v[3] * fp.ax[p] + v[4] * fp.ay[p] + v[5] * fp.az[p];
+            return simd::bits(dist >= -radius);
+        });
+    }
+
+    namespace parallel {
+        constexpr size_t cull_chunk = 65536;
+
+        // Chunks are whole mask words, so no two threads write the same word
+        template<typename T>
+        void cull_spheres(const Frustum<T>& frustum, const soa::ConstVectorView<T, 3>& centers, const T* radii, uint32* visible,
+                          size_t min_chunk = cull_chunk) {
+            const size_t count = centers.size();
+            for_range(cull_mask_words(count), min_chunk / 32, [&](size_t begin, size_t end) {
+                const size_t first = begin * 32;
+                const size_t last = (end * 32 < count) ? end * 32 : count;
+                laml::cull_spheres(frustum, centers.slice(first, last - first), radii + first, visible + begin);
+            });
+        }
+        template<typename T>
+        void cull_aabbs(const Frustum<T>& frustum, const soa::ConstVectorView<T, 3>& centers, const soa::ConstVectorView<T, 3>& extents, uint32* visible,
+                        size_t min_chunk = cull_chunk) {
+            const size_t count = centers.size();
+            for_range(cull_mask_words(count), min_chunk / 32, [&](size_t begin, size_t end) {
+                const size_t first = begin * 32;
+                const size_t last = (end * 32 < count) ? end * 32 : count;
+                laml::cull_aabbs(frustum, centers.slice(first, last - first), extents.slice(first, last - first), visible + begin);
+            });
+        }
+    }
+}
+
+#endif // __LAML_FRUSTUM_H
@@ -9,12 +9,13 @@
 
 #include <laml/Data_types.hpp>
 #include <laml/Constants.hpp>
+#include <laml/Constexpr.hpp>
 #include <math.h>
 
 namespace laml {
 
     template<typename T>
-    T abs(T value) {
+    constexpr T abs(T value) {
         if (value > 0)
             return value;
         else
@@ -22,43 +23,43 @@ namespace laml {
     }
 
     template <typename T> 
-    int sign(T val) {
+    constexpr int sign(T val) {
         return (T(0) < val) - (val < T(0));
     }
 
     template<typename T>
-    T clamp(T v, T min_val, T max_val) {
+    constexpr T clamp(T v, T min_val, T max_val) {
         return v > max_val ? max_val : (v < min_val ? min_val : v);
     }
 
     template<typename T>
-    bool epsilon_equal(T value, T target, T eps) {
+    constexpr bool epsilon_equal(T value, T target, T eps) {
         return  (abs<T>(value - target) < eps);
     }
 
     template<typename T>
-    T sin(T x) {
-        return  ::sin(x);
+    constexpr T sin(T x) {
+        return  cx::sin(x);
     }
     template<typename T>
-    T sind(T x) {
-        return  ::sin(x * laml::constants::deg2rad<T>);
+    constexpr T sind(T x) {
+        return  cx::sin(x * laml::constants::deg2rad<T>);
     }
     template<typename T>
-    T cos(T x) {
-        return  ::cos(x);
+    constexpr T cos(T x) {
+        return  cx::cos(x);
     }
     template<typename T>
-    T cosd(T x) {
-        return  ::cos(x * laml::constants::deg2rad<T>);
+    constexpr T cosd(T x) {
+        return  cx::cos(x * laml::constants::deg2rad<T>);
     }
     template<typename T>
-    T tan(T x) {
-        return  ::tan(x);
+    constexpr T tan(T x) {
+        return  cx::tan(x);
     }
     template<typename T>
-    T tand(T x) {
-        return  ::tan(x * laml::constants::deg2rad<T>);
+    constexpr T tand(T x) {
+        return  cx::tan(x * laml::constants::deg2rad<T>);
     }
 
 
@@ -0,0 +1,180 @@
+#ifndef __LAML_HIERARCHY_H
+#define __LAML_HIERARCHY_H
+
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace laml {
+    /* Flat transform hierarchy (scene graph).
+    * Nodes live in parent-before-child order, each with a local rotation/translation/scale.
+    * update() recomputes world = world[parent] * local only for nodes whose local transform changed
+    * and their descendants, starting from the first dirty node; everything before it is untouched.
+    * All transforms are affine, so worlds are composed with mul_affine.
+    * */
+    template<typename T = float>
+    class TransformHierarchy {
+    public:
+        static constexpr size_t npos = static_cast<size_t>(-1); // "no parent"
+
+        TransformHierarchy() : _first_dirty(npos) {}
+
+        size_t size() const { return _parent.size(); }
+        void reserve(size_t num_nodes) {
+            _parent.reserve(num_nodes);
+            _depth.reserve(num_nodes);
+            _rotation.reserve(num_nodes);
+            _translation.reserve(num_nodes);
+            _scale.reserve(num_nodes);
+            _local.reserve(num_nodes);
+            _world.reserve(num_nodes);
+            _flags.reserve(num_nodes);
+        }
+
+        // Appends a node and returns its index. parent must be npos (a root) or an existing node,
+        // which keeps the array in parent-before-child order. Returns npos for a bad parent.
+        size_t add_node(size_t parent = npos,
+                        const Quaternion<T>& rotation = Quaternion<T>(),
+                        const Vector<T, 3>& translation = Vector<T, 3>(),
+                        const Vector<T, 3>& scale = Vector<T, 3>(static_cast<T>(1.0))) {
+            if (parent != npos && parent >= size()) {
+                return npos;
+            }
+            const size_t node = size();
+            const size_t depth = (parent == npos) ? 0 : _depth[parent] + 1;
+            _parent.push_back(parent);
+            _depth.push_back(depth);
+            _rotation.push_back(rotation);
+            _translation.push_back(translation);
+            _scale.push_back(scale);
+            _local.push_back(Matrix<T, 4, 4>(static_cast<T>(1.0)));
+            _world.push_back(Matrix<T, 4, 4>(static_cast<T>(1.0)));
+            _flags.push_back(0);
+
+            if (depth >= _levels.size()) {
+                _levels.resize(depth + 1);
+            }
+            _levels[depth].push_back(node);
+            mark_dirty(node);
+            return node;
+        }
+
+        size_t parent(size_t node) const { return _parent[node]; }
+        size_t depth(size_t node) const { return _depth[node]; }
+
+        const Quaternion<T>& rotation(size_t node) const { return _rotation[node]; }
+        const Vector<T, 3>& translation(size_t node) const { return _translation[node]; }
+        const Vector<T, 3>& scale(size_t node) const { return _scale[node]; }
+
+        void set_local(size_t node, const Quaternion<T>& rotation, const Vector<T, 3>& translation, const Vector<T, 3>& scale) {
+            _rotation[node] = rotation;
+            _translation[node] = translation;
+            _scale[node] = scale;
+            mark_dirty(node);
+        }
+        void set_rotation(size_t node, const Quaternion<T>& rotation) {
+            _rotation[node] = rotation;
+            mark_dirty(node);
+        }
+        void set_translation(size_t node, const Vector<T, 3>& translation) {
+            _translation[node] = translation;
+            mark_dirty(node);
+        }
+        void set_scale(size_t node, const Vector<T, 3>& scale) {
+            _scale[node] = scale;
+            mark_dirty(node);
+        }
+
+        // Local and world matrices as of the last update()
+        const Matrix<T, 4, 4>& local(size_t node) const { return _local[node]; }
+        const Matrix<T, 4, 4>& world(size_t node) const { return _world[node]; }
+        const Matrix<T, 4, 4>* worlds() const { return _world.data(); }
+
+        bool dirty() const { return _first_dirty != npos; }
+
+        // Single-threaded update: one pass from the first dirty node to the end
+        void update() {
+            if (!dirty()) {
+                return;
+            }
+            const size_t count = size();
+            for (size_t node = _first_dirty; node < count; node++) {
+                update_node(node);
+            }
+            for (size_t node = _first_dirty; node < count; node++) {
+                _flags[node] = 0;
+            }
+            _first_dirty = npos;
+        }
+
+        /* Multi-threaded update. Nodes on one depth level only read worlds from the level above,
+        * so each level is split across the parallel:: thread pool, with a join between levels.
+        * Levels with fewer than min_nodes_per_task nodes run on the calling thread.
+        * */
+        void update_parallel(size_t min_nodes_per_task = 2048) {
+            if (!dirty()) {
+                return;
+            }
+            for (size_t level = 0; level < _levels.size(); level++) {
+                // levels are ascending, so nodes before the first dirty one are skipped outright
+                const std::vector<size_t>& nodes = _levels[level];
+                const size_t skip = static_cast<size_t>(std::lower_bound(nodes.begin(), nodes.end(), _first_dirty) - nodes.begin());
+                const size_t* first = nodes.data() + skip;
+                parallel::for_range(nodes.size() - skip, min_nodes_per_task, [&](size_t begin, size_t end) {
+                    for (size_t n = begin; n < end; n++) {
+                        update_node(first[n]);
+                    }
+                });
+            }
+            const size_t count = size();
+            for (size_t node = _first_dirty; node < count; node++) {
+                _flags[node] = 0;
+            }
+            _first_dirty = npos;
+        }
+
+    private:
+        enum : uint8 {
+            local_dirty = 1 << 0,   // local TRS changed since the last update
+            world_changed = 1 << 1  // world was recomputed in the current update
+        };
+
+        void mark_dirty(size_t node) {
+            _flags[node] |= local_dirty;
+            if (_first_dirty == npos || node < _first_dirty) {
+                _first_dirty = node;
+            }
+        }
+
+        void update_node(size_t node) {
+            const size_t p = _parent[node];
+            const bool parent_changed = (p != npos) && (_flags[p] & world_changed);
+            if (_flags[node] & local_dirty) {
+                transform::create_transform(_local[node], _rotation[node], _translation[node], _scale[node]);
+            }
+            else if (!parent_changed) {
+                return;
+            }
+            _world[node] = (p == npos) ? _local[node] : mul_affine(_world[p], _local[node]);
+            _flags[node] |= world_changed;
+        }
+
+        std::vector<size_t> _parent;
+        std::vector<size_t> _depth;
+        std::vector<std::vector<size_t>> _levels; // node indices per depth, ascending
+
+        std::vector<Quaternion<T>> _rotation;
+        std::vector<Vector<T, 3>> _translation;
+        std::vector<Vector<T, 3>> _scale;
+
+        std::vector<Matrix<T, 4, 4>> _local;
+        std::vector<Matrix<T, 4, 4>> _world;
+        std::vector<uint8> _flags;
+        size_t _first_dirty;
+    };
+
+    typedef TransformHierarchy<double> TransformHierarchy_highp;
+}
+
+#endif // __LAML_HIERARCHY_H
@@ -0,0 +1,268 @@
+#ifndef __LAML_INTERSECT_H
+#define __LAML_INTERSECT_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <laml/Bounds.hpp>
+#include <laml/Ray.hpp>
+#include <laml/Parallel.hpp>
+
+namespace laml {
+    /* Ray/triangle (Moller-Trumbore) and ray/box (slab) tests in three forms:
+    * scalar on a Ray, on one RayPacket of simd::packet<T>::width rays (4 with SSE/NEON, 8 with AVX),
+    * and on a RayStream of any number of rays in SoA form.
+    * All of them start from the Ray precomputation (inverse direction, sign bits) and run the scalar
+    * arithmetic lane by lane in the same order, so packets and streams agree with the scalar tests bit for bit
+    * (as long as the compiler doesn't contract the scalar code into FMAs, see -ffp-contract=off).
+    * Distances t are in units of the ray direction's length.
+    * */
+
+    namespace detail {
+        /* Moller-Trumbore, two-sided, written once for the scalar and the packet forms.
+        * Ray origin o and direction d, triangle vertex v0 and edges e1 = v1 - v0, e2 = v2 - v0.
+        * t holds the closest distance so far on input; lanes that hit closer get their new t and barycentrics u, v.
+        * A ray parallel to the triangle has det = 0, so u is inf or NaN and the range checks reject it.
+        * */
+        template<typename T, typename V>
+        inline auto triangle_kernel(const V (&o)[3], const V (&d)[3], const V (&v0)[3], const V (&e1)[3], const V (&e2)[3],
+                                    V& t, V& u, V& v) -> decltype(t < t) {
+            const V zero = simd::splat<T, V>::from(static_cast<T>(0.0));
+            const V one = simd::splat<T, V>::from(static_cast<T>(1.0));
+            const V px = d[1] * e2[2] - d[2] * e2[1];
+            const V py = d[2] * e2[0] - d[0] * e2[2];
+            const V pz = d[0] * e2[1] - d[1] * e2[0];
+            const V inv_det = one / (e1[0] * px + e1[1] * py + e1[2] * pz);
+
+            const V sx = o[0] - v0[0], sy = o[1] - v0[1], sz = o[2] - v0[2];
+            const V hit_u = (sx * px + sy * py + sz * pz) * inv_det;
+            const V qx = sy * e1[2] - sz * e1[1];
+            const V qy = sz * e1[0] - sx * e1[2];
+            const V qz = sx * e1[1] - sy * e1[0];
+            const V hit_v = (d[0] * qx + d[1] * qy + d[2] * qz) * inv_det;
+            const V hit_t = (e2[0] * qx + e2[1] * qy + e2[2] * qz) * inv_det;
+
+            const decltype(t < t) hit = (hit_u >= zero) & (hit_u <= one) & (hit_v >= zero) & (hit_u + hit_v <= one) &
+                                        (hit_t >= zero) & (hit_t < t);
+            t = simd::select(hit, hit_t, t);
+            u = simd::select(hit, hit_u, u);
+            v = simd::select(hit, hit_v, v);
+            return hit;
+        }
+    }
+
+    /* Closest hit of a ray with triangle (v0, v1, v2) within [0, t).
+    * On a hit, t becomes the hit distance and u, v the barycentrics of the hit point (v0 + u * e1 + v * e2);
+    * on a miss nothing is written.
+    * */
+    template<typename T>
+    bool intersects_triangle(const Ray<T>& ray, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2,
+                             T& t, T& u, T& v) {
+        typedef simd::scalar_v<T> S;
+        const Vector<T, 3> e1 = v1 - v0, e2 = v2 - v0;
+        const S o[3] = { { ray.origin.x }, { ray.origin.y }, { ray.origin.z } };
+        const S d[3] = { { ray.direction.x }, { ray.direction.y }, { ray.direction.z } };
+        const S p[3] = { { v0.x }, { v0.y }, { v0.z } };
+        const S a[3] = { { e1.x }, { e1.y }, { e1.z } };
+        const S b[3] = { { e2.x }, { e2.y }, { e2.z } };
+        S st = { t }, su = { u }, sv = { v };
+        if (!detail::triangle_kernel<T>(o, d, p, a, b, st, su, sv)) {
+            return false;
+        }
+        t = st.v;
+        u = su.v;
+        v = sv.v;
+        return true;
+    }
+    template<typename T>
+    bool intersects_triangle(const Ray<T>& ray, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2, T& t) {
+        T u = static_cast<T>(0.0), v = static_cast<T>(0.0);
+        return intersects_triangle(ray, v0, v1, v2, t, u, v);
+    }
+
+    // Rays as separate, read-only component lanes; an array of Ray can be viewed in place with soa::view
+    template<typename T>
+    struct RayStream {
+        soa::ConstVectorView<T, 3> origin;
+        soa::ConstVectorView<T, 3> direction;
+        soa::ConstVectorView<T, 3> inv_direction;
+
+        size_t size() const { return origin.size(); }
+        RayStream slice(size_t begin, size_t count) const {
+            return { origin.slice(begin, count), direction.slice(begin, count), inv_direction.slice(begin, count) };
+        }
+    };
+
+    namespace soa {
+        // Zero-copy stream over an array of Ray
+        template<typename T>
+        RayStream<T> view(const Ray<T>* rays, size_t count) {
+            static_assert(sizeof(Ray<T>) % sizeof(T) == 0, "Ray<T> must be a whole number of T's to be viewed as lanes");
+            const size_t stride = sizeof(Ray<T>) / sizeof(T);
+            const T* origin[3];
+            const T* direction[3];
+            const T* inv_direction[3];
+            for (size_t k = 0; k < 3; k++) {
+                origin[k] = rays ? &rays[0].origin[k] : nullptr;
+                direction[k] = rays ? &rays[0].direction[k] : nullptr;
+                inv_direction[k] = rays ? &rays[0].inv_direction[k] : nullptr;
+            }
+            return { { origin, count, stride }, { direction, count, stride }, { inv_direction, count, stride } };
+        }
+    }
+
+    // simd::packet<T>::width rays, one per lane
+    template<typename T>
+    struct RayPacket {
+        typedef simd::packet<T> P;
+        static constexpr size_t width = P::width;
+
+        P origin[3];
+        P direction[3];
+        P inv_direction[3];
+        simd::mask<T> sign[3]; // lanes travelling towards -inf, as in Ray::sign
+
+        // Rays [idx, idx + count) of a stream, count <= width; the lanes past count hold zeros
+        RayPacket(const RayStream<T>& rays, size_t idx, size_t count) {
+            const P zero = simd::set1(static_cast<T>(0.0));
+            for (size_t k = 0; k < 3; k++) {
+                origin[k] = soa::detail::gather(rays.origin.lane(k), idx, rays.origin.stride(), count);
+                direction[k] = soa::detail::gather(rays.direction.lane(k), idx, rays.direction.stride(), count);
+                inv_direction[k] = soa::detail::gather(rays.inv_direction.lane(k), idx, rays.inv_direction.stride(), count);
+                sign[k] = inv_direction[k] < zero;
+            }
+        }
+        RayPacket(const Ray<T>* rays, size_t count) : RayPacket(soa::view(rays, count), 0, count) {}
+    };
+
+    /* Slab test of every ray of a packet against one box within [0, t_max], as intersects(ray, box, t_max, t_enter).
+    * Returns the hit lanes as bits (lane k is bit k) and the entry distances in t_enter.
+    * */
+    template<typename T>
+    uint32 intersects_aabb(const RayPacket<T>& rays, const Aabb<T>& box, const simd::packet<T>& t_max, simd::packet<T>& t_enter) {
+        typedef simd::packet<T> P;
+        P t0 = simd::set1(static_cast<T>(0.0)), t1 = t_max;
+        for (size_t k = 0; k < 3; k++) {
+            const P lo = (simd::set1(box.min[k]) - rays.origin[k]) * rays.inv_direction[k];
+            const P hi = (simd::set1(box.max[k]) - rays.origin[k]) * rays.inv_direction[k];
+            const P tn = simd::select(rays.sign[k], hi, lo);
+            const P tf = simd::select(rays.sign[k], lo, hi);
+            t0 = simd::select(tn > t0, tn, t0);
+            t1 = simd::select(tf < t1, tf, t1);
+        }
+        t_enter = t0;
+        return simd::bits(t0 <= t1);
+    }
+
+    /* Every ray of a packet against one triangle, as intersects_triangle(ray, v0, v1, v2, t, u, v).
+    * t holds each lane's closest distance so far; hit lanes are updated and returned as bits.
+    * */
+    template<typename T>
+    uint32 intersects_triangle(const RayPacket<T>& rays, const Vector<T, 3>& v0, const Vector<T, 3>& v1, const Vector<T, 3>& v2,
+                               simd::packet<T>& t, simd::packet<T>& u, simd::packet<T>& v) {
+        typedef simd::packet<T> P;
+        const Vector<T, 3> e1 = v1 - v0, e2 = v2 - v0;
+        const P p[3] = { simd::set1(v0.x), simd::set1(v0.y), simd::set1(v0.z) };
+        const P a[3] = { simd::set1(e1.x), simd::set1(e1.y), simd::set1(e1.z) };
+        const P b[3] = { simd::set1(e2.x), simd::set1(e2.y), simd::set1(e2.z) };
+        return simd::bits(detail::triangle_kernel<T>(rays.origin, rays.direction, p, a, b, t, u, v));
+    }
+
+    // Number of uint32 words in a hit mask for count rays
+    inline size_t hit_mask_words(size_t count) {
+        return (count + 31) / 32;
+    }
+
+    /* Slab test of a stream of rays against one box, each ray within [0, t_max[n]].
+    * Ray n hits if bit (n % 32) of hits[n / 32] is set; all hit_mask_words(count) words are overwritten.
+    * */
+    template<typename T>
+    void intersects_aabb(const RayStream<T>& rays, const Aabb<T>& box, const T* t_max, uint32* hits) {
+        typedef simd::packet<T> P;
+        const size_t count = rays.size();
+        for (size_t w = 0; w < hit_mask_words(count); w++) {
+            hits[w] = 0;
+        }
+        for (size_t idx = 0; idx < count; idx += P::width) {
+            const size_t n = (count - idx < P::width) ? (count - idx) : P::width;
+            const RayPacket<T> packet(rays, idx, n);
+            P t_enter;
+            uint32 mask = intersects_aabb(packet, box, soa::detail::gather(t_max, idx, 1, n), t_enter);
+            if (n < P::width) {
+                mask &= (1u << n) - 1u;
+            }
+            hits[idx / 32] |= mask << (idx % 32);
+        }
+    }
+
+    /* Closest hit of every ray of a stream with a triangle soup (vertices holds 3 per triangle).
+    * t[n] is ray n's maximum distance on input; rays that hit get their distance in t[n], the barycentrics
+    * in u[n], v[n] and the triangle index in triangle[n], which is left as it was for rays that miss.
+    * Triangles are set up a tile at a time and every ray packet stays in registers across the tile.
+    * */
+    template<typename T>
+    void intersect_triangles(const RayStream<T>& rays, const Vector<T, 3>* vertices, size_t num_triangles,
+                             T* t, T* u, T* v, uint32* triangle) {
+        typedef simd::packet<T> P;
+        constexpr size_t tile_size = 64;
+        const size_t count = rays.size();
+        T setup[tile_size][9];
+        for (size_t base = 0; base < num_triangles; base += tile_size) {
+            const size_t num = (num_triangles - base < tile_size) ? (num_triangles - base) : tile_size;
+            for (size_t i = 0; i < num; i++) {
+                const Vector<T, 3>* tri = vertices + 3 * (base + i);
+                const Vector<T, 3> e1 = tri[1] - tri[0], e2 = tri[2] - tri[0];
+                for (size_t k = 0; k < 3; k++) {
+                    setup[i][k] = tri[0][k];
+                    setup[i][3 + k] = e1[k];
+                    setup[i][6 + k] = e2[k];
+                }
+            }
+
+            for (size_t idx = 0; idx < count; idx += P::width) {
+                const size_t n = (count - idx < P::width) ? (count - idx) : P::width;
+                const RayPacket<T> packet(rays, idx, n);
+                P pt = soa::detail::gather(t, idx, 1, n);
+                P pu = soa::detail::gather(u, idx, 1, n);
+                P pv = soa::detail::gather(v, idx, 1, n);
+                const uint32 lanes = (n < P::width) ? (1u << n) - 1u : ~0u;
+                uint32 any = 0;
+                for (size_t i = 0; i < num; i++) {
+                    const P p[3] = { simd::set1(setup[i][0]), simd::set1(setup[i][1]), simd::set1(setup[i][2]) };
+                    const P a[3] = { simd::set1(setup[i][3]), simd::set1(setup[i][4]), simd::set1(setup[i][5]) };
+                    const P b[3] = { simd::set1(setup[i][6]), simd::set1(setup[i][7]), simd::set1(setup[i][8]) };
+                    uint32 mask = simd::bits(detail::triangle_kernel<T>(packet.origin, packet.direction, p, a, b, pt, pu, pv)) & lanes;
+                    any |= mask;
+                    while (mask) {
+                        size_t lane = 0;
+                        while (!(mask & (1u << lane))) {
+                            lane++;
+                        }
+                        triangle[idx + lane] = static_cast<uint32>(base + i);
+                        mask &= mask - 1u;
+                    }
+                }
+                if (any) {
+                    soa::detail::scatter(t, idx, 1, n, pt);
+                    soa::detail::scatter(u, idx, 1, n, pu);
+                    soa::detail::scatter(v, idx, 1, n, pv);
+                }
+            }
+        }
+    }
+
+    namespace parallel {
+        constexpr size_t intersect_chunk = 1024;
+
+        // Rays are split across threads; every thread walks the whole triangle soup
+        template<typename T>
+        void intersect_triangles(const RayStream<T>& rays, const Vector<T, 3>* vertices, size_t num_triangles,
+                                 T* t, T* u, T* v, uint32* triangle, size_t min_chunk = intersect_chunk) {
+            for_range(rays.size(), min_chunk, [&](size_t begin, size_t end) {
+                laml::intersect_triangles(rays.slice(begin, end - begin), vertices, num_triangles,
+                                          t + begin, u + begin, v + begin, triangle + begin);
+            });
+        }
+    }
+}
+
+#endif // __LAML_INTERSECT_H
@@ -12,10 +12,12 @@ namespace laml {
         constexpr inline size_t num_rows() const { return 2; }
         constexpr inline size_t num_cols() const { return 2; }
 
-        constexpr Matrix() : _data{0,0,0,0} {}
-        constexpr Matrix(T _11, T _21, T _12, T _22) : _data{ _11, _21, _12, _22 } {}
-        constexpr Matrix(T _diag) : _data{ _diag, 0, 0,_diag } {}
-        Matrix(const float* in_data) : _data{ in_data[0], in_data[1], in_data[2], in_data[3] } {}
+        // the union members are initialized through _cols: a constant expression may only read the active member,
+        // so everything meant to work at compile time indexes with [] rather than c_ij or _data
+        constexpr Matrix() : _cols{} {}
+        constexpr Matrix(T _11, T _21, T _12, T _22) : _cols{ Vector<T, 2>(_11, _21), Vector<T, 2>(_12, _22) } {}
+        constexpr Matrix(T _diag) : _cols{ Vector<T, 2>(_diag, 0), Vector<T, 2>(0, _diag) } {}
+        constexpr Matrix(const float* in_data) : _cols{ Vector<T, 2>(in_data), Vector<T, 2>(in_data + 2) } {}
 
         union {
             T _data[4];
@@ -24,50 +26,50 @@ namespace laml {
         };
 
         // access like an array
-        Vector<T, 2>& operator[](size_t idx) {
+        constexpr Vector<T, 2>& operator[](size_t idx) {
             return _cols[idx];
         }
-        const Vector<T, 2>& operator[](size_t idx) const {
+        constexpr const Vector<T, 2>& operator[](size_t idx) const {
             return _cols[idx];
         }
     };
 
     template<typename T>
-    void fill(Matrix<T, 2, 2>& mat, T value) {
-        mat.c_11 = value;
-        mat.c_12 = value;
-        mat.c_21 = value;
-        mat.c_22 = value;
+    constexpr void fill(Matrix<T, 2, 2>& mat, T value) {
+        mat[0][0] = value;
+        mat[1][0] = value;
+        mat[0][1] = value;
+        mat[1][1] = value;
     }
 
     // 2x2 * 2x2 multiply specialization
     template<typename T>
-    Matrix<T, 2, 2> mul(const Matrix<T, 2, 2>& m1, const Matrix<T, 2, 2>& m2) {
+    constexpr Matrix<T, 2, 2> mul(const Matrix<T, 2, 2>& m1, const Matrix<T, 2, 2>& m2) {
         //std::cout << "FAST MUL [" << 2 << "," << 2 << "]x[" << 2 << "," << 2 << "]" << std::endl;
         return Matrix<T, 2, 2>(
-            m1.c_11 * m2.c_11 + m1.c_12 * m2.c_21,
-            m1.c_21 * m2.c_11 + m1.c_22 * m2.c_21,
-            m1.c_11 * m2.c_12 + m1.c_12 * m2.c_22, 
-            m1.c_21 * m2.c_12 + m1.c_22 * m2.c_22);
+            m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1],
+            m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1],
+            m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1], 
+            m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1]);
     }
 
     // determinant - 2x2 case
     template<typename T>
-    T det(const Matrix<T, 2, 2>& mat) {
+    constexpr T det(const Matrix<T, 2, 2>& mat) {
         return mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1];
     }
 
     template<typename T>
-    Matrix<T, 2, 2> inverse(const Matrix<T, 2, 2>& mat) {
+    constexpr Matrix<T, 2, 2> inverse(const Matrix<T, 2, 2>& mat) {
         T determinant = det(mat);
         const double tol = 1e-8;
-        if (fabs(determinant) < tol) {
+        if (cx::abs(determinant) < tol) {
             #if 0
                 std::cout << "Cannot inverse matrix: determinant = " << determinant << std::endl;
             #endif
             return mat;
         }
-        Matrix<T, 2, 2> res(mat.c_22, -mat.c_21, -mat.c_12, mat.c_11);
+        Matrix<T, 2, 2> res(mat[1][1], -mat[0][1], -mat[1][0], mat[0][0]);
         return res / determinant;
     }
 
@@ -12,12 +12,13 @@ namespace laml {
         constexpr inline size_t num_rows() const { return 3; }
         constexpr inline size_t num_cols() const { return 3; }
 
-        constexpr Matrix() : _data{ 0,0,0,0,0,0,0,0,0 } {}
+        // initialized through _cols, the member constant expressions read (see Matrix<T, 2, 2>)
+        constexpr Matrix() : _cols{} {}
         constexpr Matrix(T _11, T _21, T _31, T _12, T _22, T _32, T _13, T _23, T _33) : 
-            _data{ _11, _21, _31, _12, _22, _32, _13, _23, _33 } {}
-        constexpr Matrix(T _diag) : _data{ _diag, 0, 0, 0, _diag, 0, 0, 0, _diag } {}
-        Matrix(const float* in_data) : 
-            _data{ in_data[0], in_data[1], in_data[2], in_data[3], in_data[4], in_data[5], in_data[6], in_data[7], in_data[8] } {}
+            _cols{ Vector<T, 3>(_11, _21, _31), Vector<T, 3>(_12, _22, _32), Vector<T, 3>(_13, _23, _33) } {}
+        constexpr Matrix(T _diag) : _cols{ Vector<T, 3>(_diag, 0, 0), Vector<T, 3>(0, _diag, 0), Vector<T, 3>(0, 0, _diag) } {}
+        constexpr Matrix(const float* in_data) : 
+            _cols{ Vector<T, 3>(in_data), Vector<T, 3>(in_data + 3), Vector<T, 3>(in_data + 6) } {}
         constexpr Matrix(const Vector<T, 3>& v1, const Vector<T, 3>& v2, const Vector<T, 3>& v3) : _cols{v1, v2, v3} {}
 
         union {
@@ -27,48 +28,48 @@ namespace laml {
         };
 
         // access like an array
-        Vector<T, 3>& operator[](size_t idx) {
+        constexpr Vector<T, 3>& operator[](size_t idx) {
             return _cols[idx];
         }
-        const Vector<T, 3>& operator[](size_t idx) const {
+        constexpr const Vector<T, 3>& operator[](size_t idx) const {
             return _cols[idx];
         }
     };
 
     template<typename T>
-    void fill(Matrix<T, 3, 3>& mat, T value) {
-        mat.c_11 = value;
-        mat.c_12 = value;
-        mat.c_13 = value;
-        mat.c_21 = value;
-        mat.c_22 = value;
-        mat.c_23 = value;
-        mat.c_31 = value;
-        mat.c_32 = value;
-        mat.c_33 = value;
+    constexpr void fill(Matrix<T, 3, 3>& mat, T value) {
+        mat[0][0] = value;
+        mat[1][0] = value;
+        mat[2][0] = value;
+        mat[0][1] = value;
+        mat[1][1] = value;
+        mat[2][1] = value;
+        mat[0][2] = value;
+        mat[1][2] = value;
+        mat[2][2] = value;
     }
 
     // 3x3 * 3x3 multiply specialization
     template<typename T>
-    Matrix<T, 3, 3> mul(const Matrix<T, 3, 3>& m1, const Matrix<T, 3, 3>& m2) {
+    constexpr Matrix<T, 3, 3> mul(const Matrix<T, 3, 3>& m1, const Matrix<T, 3, 3>& m2) {
         //std::cout << "FAST MUL [" << 3 << "," << 3 << "]x[" << 3 << "," << 3 << "]" << std::endl;
         return Matrix<T, 3, 3>(
-            m1.c_11 * m2.c_11 + m1.c_12 * m2.c_21 + m1.c_13 * m2.c_31, // col 1
-            m1.c_21 * m2.c_11 + m1.c_22 * m2.c_21 + m1.c_23 * m2.c_31,
-            m1.c_31 * m2.c_11 + m1.c_32 * m2.c_21 + m1.c_33 * m2.c_31,
+            m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1] + m1[2][0] * m2[0][2], // col 1
+            m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1] + m1[2][1] * m2[0][2],
+            m1[0][2] * m2[0][0] + m1[1][2] * m2[0][1] + m1[2][2] * m2[0][2],
     
-            m1.c_11 * m2.c_12 + m1.c_12 * m2.c_22 + m1.c_13 * m2.c_32, // col 2
-            m1.c_21 * m2.c_12 + m1.c_22 * m2.c_22 + m1.c_23 * m2.c_32,
-            m1.c_31 * m2.c_12 + m1.c_32 * m2.c_22 + m1.c_33 * m2.c_32,
+            m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1] + m1[2][0] * m2[1][2], // col 2
+            m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1] + m1[2][1] * m2[1][2],
+            m1[0][2] * m2[1][0] + m1[1][2] * m2[1][1] + m1[2][2] * m2[1][2],
     
-            m1.c_11 * m2.c_13 + m1.c_12 * m2.c_23 + m1.c_13 * m2.c_33, // col 3
-            m1.c_21 * m2.c_13 + m1.c_22 * m2.c_23 + m1.c_23 * m2.c_33,
-            m1.c_31 * m2.c_13 + m1.c_32 * m2.c_23 + m1.c_33 * m2.c_33);
+            m1[0][0] * m2[2][0] + m1[1][0] * m2[2][1] + m1[2][0] * m2[2][2], // col 3
+            m1[0][1] * m2[2][0] + m1[1][1] * m2[2][1] + m1[2][1] * m2[2][2],
+            m1[0][2] * m2[2][0] + m1[1][2] * m2[2][1] + m1[2][2] * m2[2][2]);
     }
 
     // determinant - 3x3 case
     template<typename T>
-    T det(const Matrix<T, 3, 3>& mat) {
+    constexpr T det(const Matrix<T, 3, 3>& mat) {
         return mat[0][0] * mat[1][1] * mat[2][2] -
             mat[0][0] * mat[1][2] * mat[2][1] -
             mat[0][1] * mat[1][0] * mat[2][2] +
@@ -79,7 +80,7 @@ namespace laml {
 
     // inverse
     template<typename T>
-    Matrix<T, 3, 3> inverse(const Matrix<T, 3, 3>& mat) {
+    constexpr Matrix<T, 3, 3> inverse(const Matrix<T, 3, 3>& mat) {
         /*
         * inv(m) = adj(m)/det(m)
         * only valid if det(m) != 0, so calculate that first.
@@ -91,7 +92,7 @@ namespace laml {
         */
 
         T determinant = det(mat);
-        if (fabs(determinant) < 1e-8) {
+        if (cx::abs(determinant) < 1e-8) {
             #if 0
                 std::cout << "Cannot inverse matrix: determinant = " << determinant << std::endl;
             #endif
@@ -99,17 +100,17 @@ namespace laml {
         }
 
         Matrix<T, 3, 3> adj(
-            (mat.c_22 * mat.c_33 - mat.c_32 * mat.c_23),
-            (mat.c_31 * mat.c_23 - mat.c_21 * mat.c_33),
-            (mat.c_21 * mat.c_32 - mat.c_22 * mat.c_31),
+            (mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1]),
+            (mat[0][2] * mat[2][1] - mat[0][1] * mat[2][2]),
+            (mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2]),
 
-            (mat.c_32 * mat.c_13 - mat.c_12 * mat.c_33),
-            (mat.c_11 * mat.c_33 - mat.c_31 * mat.c_13),
-            (mat.c_31 * mat.c_12 - mat.c_11 * mat.c_32),
+            (mat[1][2] * mat[2][0] - mat[1][0] * mat[2][2]),
+            (mat[0][0] * mat[2][2] - mat[0][2] * mat[2][0]),
+            (mat[0][2] * mat[1][0] - mat[0][0] * mat[1][2]),
 
-            (mat.c_12 * mat.c_23 - mat.c_22 * mat.c_13),
-            (mat.c_21 * mat.c_13 - mat.c_11 * mat.c_23),
-            (mat.c_11 * mat.c_22 - mat.c_21 * mat.c_12));
+            (mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]),
+            (mat[0][1] * mat[2][0] - mat[0][0] * mat[2][1]),
+            (mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0]));
 
         return adj / determinant;
     }
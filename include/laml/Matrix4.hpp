@@ -2,6 +2,7 @@
 #define __MATRIX_4_H
 
 #include <laml/Matrix_base.hpp>
+#include <laml/Simd.hpp>
 
 namespace laml {
 
@@ -12,30 +13,27 @@ namespace laml {
         constexpr inline size_t num_rows() const { return 4; }
         constexpr inline size_t num_cols() const { return 4; }
 
-        constexpr Matrix() : _data{ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } {}
+        // initialized through _cols, the member constant expressions read (see Matrix<T, 2, 2>)
+        constexpr Matrix() : _cols{} {}
         constexpr Matrix(
             T _11, T _21, T _31, T _41, 
             T _12, T _22, T _32, T _42,
             T _13, T _23, T _33, T _43,
             T _14, T _24, T _34, T _44):
-            _data{ 
-            _11, _21, _31, _41, 
-            _12, _22, _32, _42, 
-            _13, _23, _33, _43,
-            _14, _24, _34, _44} {}
-        constexpr Matrix(T _diag) : _data{ _diag, 0, 0, 0, 0, _diag, 0, 0, 0, 0, _diag, 0, 0, 0, 0, _diag } {}
-        constexpr Matrix(T _d1, T _d2, T _d3, T _d4) : _data{ _d1, 0, 0, 0, 0, _d2, 0, 0, 0, 0, _d3, 0, 0, 0, 0, _d4 } {}
-        Matrix(const float* in_data) :
-            _data{ 
-            in_data[0], in_data[1], in_data[2], in_data[3], 
-            in_data[4], in_data[5], in_data[6], in_data[7], 
-            in_data[8], in_data[9], in_data[10], in_data[11],
-            in_data[12], in_data[13], in_data[14], in_data[15] } {}
-        constexpr Matrix(const Matrix<T, 3, 3>& m3) : _data{
-            m3.c_11, m3.c_21, m3.c_31, 0,
-            m3.c_12, m3.c_22, m3.c_32, 0,
-            m3.c_13, m3.c_23, m3.c_33, 0,
-            0, 0, 0, 1} {}
+            _cols{ 
+            Vector<T, 4>(_11, _21, _31, _41), 
+            Vector<T, 4>(_12, _22, _32, _42), 
+            Vector<T, 4>(_13, _23, _33, _43),
+            Vector<T, 4>(_14, _24, _34, _44)} {}
+        constexpr Matrix(T _diag) : Matrix(_diag, _diag, _diag, _diag) {}
+        constexpr Matrix(T _d1, T _d2, T _d3, T _d4) : _cols{ Vector<T, 4>(_d1, 0, 0, 0), Vector<T, 4>(0, _d2, 0, 0), Vector<T, 4>(0, 0, _d3, 0), Vector<T, 4>(0, 0, 0, _d4) } {}
+        constexpr Matrix(const float* in_data) :
+            _cols{ Vector<T, 4>(in_data), Vector<T, 4>(in_data + 4), Vector<T, 4>(in_data + 8), Vector<T, 4>(in_data + 12) } {}
+        constexpr Matrix(const Matrix<T, 3, 3>& m3) : _cols{
+            Vector<T, 4>(m3[0], 0),
+            Vector<T, 4>(m3[1], 0),
+            Vector<T, 4>(m3[2], 0),
+            Vector<T, 4>(0, 0, 0, 1)} {}
 
         union {
             T _data[16];
@@ -44,51 +42,364 @@ namespace laml {
         };
 
         // access like an array
-        Vector<T, 4>& operator[](size_t idx) {
+        constexpr Vector<T, 4>& operator[](size_t idx) {
             return _cols[idx];
         }
-        const Vector<T, 4>& operator[](size_t idx) const {
+        constexpr const Vector<T, 4>& operator[](size_t idx) const {
             return _cols[idx];
         }
     };
 
     template<typename T>
-    void fill(Matrix<T, 4, 4>& mat, T value) {
-        mat.c_11 = value;
-        mat.c_12 = value;
-        mat.c_13 = value;
-        mat.c_14 = value;
-        mat.c_21 = value;
-        mat.c_22 = value;
-        mat.c_23 = value;
-        mat.c_24 = value;
-        mat.c_31 = value;
-        mat.c_32 = value;
-        mat.c_33 = value;
-        mat.c_34 = value;
-        mat.c_41 = value;
-        mat.c_42 = value;
-        mat.c_43 = value;
-        mat.c_44 = value;
+    constexpr void fill(Matrix<T, 4, 4>& mat, T value) {
+        mat[0][0] = value;
+        mat[1][0] = value;
+        mat[2][0] = value;
+        mat[3][0] = value;
+        mat[0][1] = value;
+        mat[1][1] = value;
+        mat[2][1] = value;
+        mat[3][1] = value;
+        mat[0][2] = value;
+        mat[1][2] = value;
+        mat[2][2] = value;
+        mat[3][2] = value;
+        mat[0][3] = value;
+        mat[1][3] = value;
+        mat[2][3] = value;
+        mat[3][3] = value;
     }
 
-    //// 3x3 * 3x3 multiply specialization
-    //template<typename T>
-    //Matrix<T, 3, 3> mul(const Matrix<T, 3, 3>& m1, const Matrix<T, 3, 3>& m2) {
-    //    //std::cout << "FAST MUL [" << 3 << "," << 3 << "]x[" << 3 << "," << 3 << "]" << std::endl;
-    //    return Matrix<T, 3, 3>(
-    //        m1.c_11 * m2.c_11 + m1.c_12 * m2.c_21 + m1.c_13 * m2.c_31, // col 1
-    //        m1.c_21 * m2.c_11 + m1.c_22 * m2.c_21 + m1.c_23 * m2.c_31,
-    //        m1.c_31 * m2.c_11 + m1.c_32 * m2.c_21 + m1.c_33 * m2.c_31,
-    //
-    //        m1.c_11 * m2.c_12 + m1.c_12 * m2.c_22 + m1.c_13 * m2.c_32, // col 2
-    //        m1.c_21 * m2.c_12 + m1.c_22 * m2.c_22 + m1.c_23 * m2.c_32,
-    //        m1.c_31 * m2.c_12 + m1.c_32 * m2.c_22 + m1.c_33 * m2.c_32,
-    //
-    //        m1.c_11 * m2.c_13 + m1.c_12 * m2.c_23 + m1.c_13 * m2.c_33, // col 3
-    //        m1.c_21 * m2.c_13 + m1.c_22 * m2.c_23 + m1.c_23 * m2.c_33,
-    //        m1.c_31 * m2.c_13 + m1.c_32 * m2.c_23 + m1.c_33 * m2.c_33);
-    //}
+    // 4x4 * 4x4 multiply specialization
+    // Each column of the result is the columns of m1 weighted by one column of m2 (column-broadcast).
+    // The sums are accumulated in the same order as the generic mul(), so both give identical results.
+    template<typename T>
+    constexpr Matrix<T, 4, 4> mul(const Matrix<T, 4, 4>& m1, const Matrix<T, 4, 4>& m2) {
+        //std::cout << "FAST MUL [" << 4 << "," << 4 << "]x[" << 4 << "," << 4 << "]" << std::endl;
+        Matrix<T, 4, 4> res;
+        for (size_t col = 0; col < 4; col++) {
+            const T b0 = m2[col][0];
+            const T b1 = m2[col][1];
+            const T b2 = m2[col][2];
+            const T b3 = m2[col][3];
+            res[col][0] = m1[0][0] * b0 + m1[1][0] * b1 + m1[2][0] * b2 + m1[3][0] * b3;
+            res[col][1] = m1[0][1] * b0 + m1[1][1] * b1 + m1[2][1] * b2 + m1[3][1] * b3;
+            res[col][2] = m1[0][2] * b0 + m1[1][2] * b1 + m1[2][2] * b2 + m1[3][2] * b3;
+            res[col][3] = m1[0][3] * b0 + m1[1][3] * b1 + m1[2][3] * b2 + m1[3][3] * b3;
+        }
+        return res;
+    }
+
+    // determinant - 4x4 case
+    // expanded through the 2x2 sub-determinants of the top two and bottom two rows
+    template<typename T>
+    constexpr T det(const Matrix<T, 4, 4>& mat) {
+        const T s0 = mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0];
+        const T s1 = mat[0][0] * mat[2][1] - mat[0][1] * mat[2][0];
+        const T s2 = mat[0][0] * mat[3][1] - mat[0][1] * mat[3][0];
+        const T s3 = mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0];
+        const T s4 = mat[1][0] * mat[3][1] - mat[1][1] * mat[3][0];
+        const T s5 = mat[2][0] * mat[3][1] - mat[2][1] * mat[3][0];
+
+        const T c5 = mat[2][2] * mat[3][3] - mat[2][3] * mat[3][2];
+        const T c4 = mat[1][2] * mat[3][3] - mat[1][3] * mat[3][2];
+        const T c3 = mat[1][2] * mat[2][3] - mat[1][3] * mat[2][2];
+        const T c2 = mat[0][2] * mat[3][3] - mat[0][3] * mat[3][2];
+        const T c1 = mat[0][2] * mat[2][3] - mat[0][3] * mat[2][2];
+        const T c0 = mat[0][2] * mat[1][3] - mat[0][3] * mat[1][2];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+
+    // inverse - closed-form cofactor expansion
+    // reuses the 12 2x2 sub-determinants from det() instead of building 16 3x3 minors
+    template<typename T>
+    constexpr Matrix<T, 4, 4> inverse(const Matrix<T, 4, 4>& mat) {
+        const T s0 = mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0];
+        const T s1 = mat[0][0] * mat[2][1] - mat[0][1] * mat[2][0];
+        const T s2 = mat[0][0] * mat[3][1] - mat[0][1] * mat[3][0];
+        const T s3 = mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0];
+        const T s4 = mat[1][0] * mat[3][1] - mat[1][1] * mat[3][0];
+        const T s5 = mat[2][0] * mat[3][1] - mat[2][1] * mat[3][0];
+
+        const T c5 = mat[2][2] * mat[3][3] - mat[2][3] * mat[3][2];
+        const T c4 = mat[1][2] * mat[3][3] - mat[1][3] * mat[3][2];
+        const T c3 = mat[1][2] * mat[2][3] - mat[1][3] * mat[2][2];
+        const T c2 = mat[0][2] * mat[3][3] - mat[0][3] * mat[3][2];
+        const T c1 = mat[0][2] * mat[2][3] - mat[0][3] * mat[2][2];
+        const T c0 = mat[0][2] * mat[1][3] - mat[0][3] * mat[1][2];
+
+        T determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (cx::abs(determinant) < 1e-8) {
+            #if 0
+                std::cout << "Cannot inverse matrix: determinant = " << determinant << std::endl;
+            #endif
+            return mat;
+        }
+        const T inv_det = static_cast<T>(1.0) / determinant;
+
+        return Matrix<T, 4, 4>(
+            ( mat[1][1] * c5 - mat[2][1] * c4 + mat[3][1] * c3) * inv_det, // col 1
+            (-mat[0][1] * c5 + mat[2][1] * c2 - mat[3][1] * c1) * inv_det,
+            ( mat[0][1] * c4 - mat[1][1] * c2 + mat[3][1] * c0) * inv_det,
+            (-mat[0][1] * c3 + mat[1][1] * c1 - mat[2][1] * c0) * inv_det,
+
+            (-mat[1][0] * c5 + mat[2][0] * c4 - mat[3][0] * c3) * inv_det, // col 2
+            ( mat[0][0] * c5 - mat[2][0] * c2 + mat[3][0] * c1) * inv_det,
+            (-mat[0][0] * c4 + mat[1][0] * c2 - mat[3][0] * c0) * inv_det,
+            ( mat[0][0] * c3 - mat[1][0] * c1 + mat[2][0] * c0) * inv_det,
+
+            ( mat[1][3] * s5 - mat[2][3] * s4 + mat[3][3] * s3) * inv_det, // col 3
+            (-mat[0][3] * s5 + mat[2][3] * s2 - mat[3][3] * s1) * inv_det,
+            ( mat[0][3] * s4 - mat[1][3] * s2 + mat[3][3] * s0) * inv_det,
+            (-mat[0][3] * s3 + mat[1][3] * s1 - mat[2][3] * s0) * inv_det,
+
+            (-mat[1][2] * s5 + mat[2][2] * s4 - mat[3][2] * s3) * inv_det, // col 4
+            ( mat[0][2] * s5 - mat[2][2] * s2 + mat[3][2] * s1) * inv_det,
+            (-mat[0][2] * s4 + mat[1][2] * s2 - mat[3][2] * s0) * inv_det,
+            ( mat[0][2] * s3 - mat[1][2] * s1 + mat[2][2] * s0) * inv_det);
+    }
+
+    // inverse of an affine transform - bottom row is assumed to be [0 0 0 1]
+    // inv([A t; 0 1]) = [inv(A) -inv(A)*t; 0 1]
+    template<typename T>
+    constexpr Matrix<T, 4, 4> inverse_affine(const Matrix<T, 4, 4>& mat) {
+        // 3x3 adjugate of the upper-left block
+        const T a11 = mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1];
+        const T a21 = mat[0][2] * mat[2][1] - mat[0][1] * mat[2][2];
+        const T a31 = mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2];
+
+        T determinant = mat[0][0] * a11 + mat[1][0] * a21 + mat[2][0] * a31;
+        if (cx::abs(determinant) < 1e-8) {
+            return mat;
+        }
+        const T inv_det = static_cast<T>(1.0) / determinant;
+
+        const T i11 = a11 * inv_det;
+        const T i21 = a21 * inv_det;
+        const T i31 = a31 * inv_det;
+        const T i12 = (mat[1][2] * mat[2][0] - mat[1][0] * mat[2][2]) * inv_det;
+        const T i22 = (mat[0][0] * mat[2][2] - mat[0][2] * mat[2][0]) * inv_det;
+        const T i32 = (mat[0][2] * mat[1][0] - mat[0][0] * mat[1][2]) * inv_det;
+        const T i13 = (mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]) * inv_det;
+        const T i23 = (mat[0][1] * mat[2][0] - mat[0][0] * mat[2][1]) * inv_det;
+        const T i33 = (mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0]) * inv_det;
+
+        return Matrix<T, 4, 4>(
+            i11, i21, i31, 0,
+            i12, i22, i32, 0,
+            i13, i23, i33, 0,
+            -(i11 * mat[3][0] + i12 * mat[3][1] + i13 * mat[3][2]),
+            -(i21 * mat[3][0] + i22 * mat[3][1] + i23 * mat[3][2]),
+            -(i31 * mat[3][0] + i32 * mat[3][1] + i33 * mat[3][2]),
+            1);
+    }
+
+    // inverse of a rigid transform (rotation + translation only, no scale or shear)
+    // inv([R t; 0 1]) = [R^T -R^T*t; 0 1]
+    template<typename T>
+    constexpr Matrix<T, 4, 4> inverse_rigid(const Matrix<T, 4, 4>& mat) {
+        return Matrix<T, 4, 4>(
+            mat[0][0], mat[1][0], mat[2][0], 0,
+            mat[0][1], mat[1][1], mat[2][1], 0,
+            mat[0][2], mat[1][2], mat[2][2], 0,
+            -(mat[0][0] * mat[3][0] + mat[0][1] * mat[3][1] + mat[0][2] * mat[3][2]),
+            -(mat[1][0] * mat[3][0] + mat[1][1] * mat[3][1] + mat[1][2] * mat[3][2]),
+            -(mat[2][0] * mat[3][0] + mat[2][1] * mat[3][1] + mat[2][2] * mat[3][2]),
+            1);
+    }
+
+    // product of two affine transforms - both bottom rows are assumed to be [0 0 0 1]
+    // [A t; 0 1] * [B u; 0 1] = [A*B A*u+t; 0 1], so the bottom row is never multiplied through
+    template<typename T>
+    constexpr Matrix<T, 4, 4> mul_affine(const Matrix<T, 4, 4>& m1, const Matrix<T, 4, 4>& m2) {
+        return Matrix<T, 4, 4>(
+            m1[0][0] * m2[0][0] + m1[1][0] * m2[0][1] + m1[2][0] * m2[0][2], // col 1
+            m1[0][1] * m2[0][0] + m1[1][1] * m2[0][1] + m1[2][1] * m2[0][2],
+            m1[0][2] * m2[0][0] + m1[1][2] * m2[0][1] + m1[2][2] * m2[0][2],
+            0,
+
+            m1[0][0] * m2[1][0] + m1[1][0] * m2[1][1] + m1[2][0] * m2[1][2], // col 2
+            m1[0][1] * m2[1][0] + m1[1][1] * m2[1][1] + m1[2][1] * m2[1][2],
+            m1[0][2] * m2[1][0] + m1[1][2] * m2[1][1] + m1[2][2] * m2[1][2],
+            0,
+
+            m1[0][0] * m2[2][0] + m1[1][0] * m2[2][1] + m1[2][0] * m2[2][2], // col 3
+            m1[0][1] * m2[2][0] + m1[1][1] * m2[2][1] + m1[2][1] * m2[2][2],
+            m1[0][2] * m2[2][0] + m1[1][2] * m2[2][1] + m1[2][2] * m2[2][2],
+            0,
+
+            m1[0][0] * m2[3][0] + m1[1][0] * m2[3][1] + m1[2][0] * m2[3][2] + m1[3][0], // col 4
+            m1[0][1] * m2[3][0] + m1[1][1] * m2[3][1] + m1[2][1] * m2[3][2] + m1[3][1],
+            m1[0][2] * m2[3][0] + m1[1][2] * m2[3][1] + m1[2][2] * m2[3][2] + m1[3][2],
+            1);
+    }
+
+// The intrinsic overloads below hand constant evaluation back to the templates above, which compute the same sums.
+#if defined(LAML_SIMD_AVX)
+    // AVX: two result columns per iteration, each 128-bit half broadcasts from its own column of m2
+    constexpr inline Matrix<float, 4, 4> mul(const Matrix<float, 4, 4>& m1, const Matrix<float, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<float>(m1, m2);
+        }
+        const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m1._data[0]));
+        const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m1._data[4]));
+        const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m1._data[8]));
+        const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m1._data[12]));
+
+        Matrix<float, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 8) {
+            const __m256 b = _mm256_loadu_ps(&m2._data[n]);
+            __m256 r =        _mm256_mul_ps(a0, _mm256_shuffle_ps(b, b, 0x00));
+            r = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_shuffle_ps(b, b, 0x55)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_shuffle_ps(b, b, 0xAA)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_shuffle_ps(b, b, 0xFF)));
+            _mm256_storeu_ps(&res._data[n], r);
+        }
+        return res;
+    }
+
+    constexpr inline Matrix<double, 4, 4> mul(const Matrix<double, 4, 4>& m1, const Matrix<double, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<double>(m1, m2);
+        }
+        const __m256d a0 = _mm256_loadu_pd(&m1._data[0]);
+        const __m256d a1 = _mm256_loadu_pd(&m1._data[4]);
+        const __m256d a2 = _mm256_loadu_pd(&m1._data[8]);
+        const __m256d a3 = _mm256_loadu_pd(&m1._data[12]);
+
+        Matrix<double, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            __m256d r =        _mm256_mul_pd(a0, _mm256_broadcast_sd(&m2._data[n + 0]));
+            r = _mm256_add_pd(r, _mm256_mul_pd(a1, _mm256_broadcast_sd(&m2._data[n + 1])));
+            r = _mm256_add_pd(r, _mm256_mul_pd(a2, _mm256_broadcast_sd(&m2._data[n + 2])));
+            r = _mm256_add_pd(r, _mm256_mul_pd(a3, _mm256_broadcast_sd(&m2._data[n + 3])));
+            _mm256_storeu_pd(&res._data[n], r);
+        }
+        return res;
+    }
+#elif defined(LAML_SIMD_SSE)
+    constexpr inline Matrix<float, 4, 4> mul(const Matrix<float, 4, 4>& m1, const Matrix<float, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<float>(m1, m2);
+        }
+        const __m128 a0 = _mm_loadu_ps(&m1._data[0]);
+        const __m128 a1 = _mm_loadu_ps(&m1._data[4]);
+        const __m128 a2 = _mm_loadu_ps(&m1._data[8]);
+        const __m128 a3 = _mm_loadu_ps(&m1._data[12]);
+
+        Matrix<float, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            __m128 r =     _mm_mul_ps(a0, _mm_set1_ps(m2._data[n + 0]));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(m2._data[n + 1])));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(m2._data[n + 2])));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(m2._data[n + 3])));
+            _mm_storeu_ps(&res._data[n], r);
+        }
+        return res;
+    }
+
+    // SSE2 only holds two doubles, so each column is done as a top and bottom half
+    constexpr inline Matrix<double, 4, 4> mul(const Matrix<double, 4, 4>& m1, const Matrix<double, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<double>(m1, m2);
+        }
+        const __m128d a0_lo = _mm_loadu_pd(&m1._data[0]);
+        const __m128d a0_hi = _mm_loadu_pd(&m1._data[2]);
+        const __m128d a1_lo = _mm_loadu_pd(&m1._data[4]);
+        const __m128d a1_hi = _mm_loadu_pd(&m1._data[6]);
+        const __m128d a2_lo = _mm_loadu_pd(&m1._data[8]);
+        const __m128d a2_hi = _mm_loadu_pd(&m1._data[10]);
+        const __m128d a3_lo = _mm_loadu_pd(&m1._data[12]);
+        const __m128d a3_hi = _mm_loadu_pd(&m1._data[14]);
+
+        Matrix<double, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            const __m128d b0 = _mm_set1_pd(m2._data[n + 0]);
+            const __m128d b1 = _mm_set1_pd(m2._data[n + 1]);
+            const __m128d b2 = _mm_set1_pd(m2._data[n + 2]);
+            const __m128d b3 = _mm_set1_pd(m2._data[n + 3]);
+
+            __m128d lo =       _mm_mul_pd(a0_lo, b0);
+            lo = _mm_add_pd(lo, _mm_mul_pd(a1_lo, b1));
+            lo = _mm_add_pd(lo, _mm_mul_pd(a2_lo, b2));
+            lo = _mm_add_pd(lo, _mm_mul_pd(a3_lo, b3));
+
+            __m128d hi =       _mm_mul_pd(a0_hi, b0);
+            hi = _mm_add_pd(hi, _mm_mul_pd(a1_hi, b1));
+            hi = _mm_add_pd(hi, _mm_mul_pd(a2_hi, b2));
+            hi = _mm_add_pd(hi, _mm_mul_pd(a3_hi, b3));
+
+            _mm_storeu_pd(&res._data[n + 0], lo);
+            _mm_storeu_pd(&res._data[n + 2], hi);
+        }
+        return res;
+    }
+#elif defined(LAML_SIMD_NEON)
+    // NEON: separate vmulq/vaddq (not vmlaq/vfmaq) so rounding matches the scalar path
+    constexpr inline Matrix<float, 4, 4> mul(const Matrix<float, 4, 4>& m1, const Matrix<float, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<float>(m1, m2);
+        }
+        const float32x4_t a0 = vld1q_f32(&m1._data[0]);
+        const float32x4_t a1 = vld1q_f32(&m1._data[4]);
+        const float32x4_t a2 = vld1q_f32(&m1._data[8]);
+        const float32x4_t a3 = vld1q_f32(&m1._data[12]);
+
+        Matrix<float, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            float32x4_t r =  vmulq_n_f32(a0, m2._data[n + 0]);
+            r = vaddq_f32(r, vmulq_n_f32(a1, m2._data[n + 1]));
+            r = vaddq_f32(r, vmulq_n_f32(a2, m2._data[n + 2]));
+            r = vaddq_f32(r, vmulq_n_f32(a3, m2._data[n + 3]));
+            vst1q_f32(&res._data[n], r);
+        }
+        return res;
+    }
+#endif
+
+#if defined(LAML_SIMD_SSE)
+    // m1's bottom row [0 0 0 1] makes the w lane come out as 0 (or 1 for the translation column) by itself
+    constexpr inline Matrix<float, 4, 4> mul_affine(const Matrix<float, 4, 4>& m1, const Matrix<float, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul_affine<float>(m1, m2);
+        }
+        const __m128 a0 = _mm_loadu_ps(&m1._data[0]);
+        const __m128 a1 = _mm_loadu_ps(&m1._data[4]);
+        const __m128 a2 = _mm_loadu_ps(&m1._data[8]);
+        const __m128 a3 = _mm_loadu_ps(&m1._data[12]);
+
+        Matrix<float, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            __m128 r =     _mm_mul_ps(a0, _mm_set1_ps(m2._data[n + 0]));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(m2._data[n + 1])));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(m2._data[n + 2])));
+            _mm_storeu_ps(&res._data[n], r);
+        }
+        _mm_storeu_ps(&res._data[12], _mm_add_ps(_mm_loadu_ps(&res._data[12]), a3));
+        return res;
+    }
+#elif defined(LAML_SIMD_NEON)
+    constexpr inline Matrix<float, 4, 4> mul_affine(const Matrix<float, 4, 4>& m1, const Matrix<float, 4, 4>& m2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul_affine<float>(m1, m2);
+        }
+        const float32x4_t a0 = vld1q_f32(&m1._data[0]);
+        const float32x4_t a1 = vld1q_f32(&m1._data[4]);
+        const float32x4_t a2 = vld1q_f32(&m1._data[8]);
+        const float32x4_t a3 = vld1q_f32(&m1._data[12]);
+
+        Matrix<float, 4, 4> res;
+        for (size_t n = 0; n < 16; n += 4) {
+            float32x4_t r =  vmulq_n_f32(a0, m2._data[n + 0]);
+            r = vaddq_f32(r, vmulq_n_f32(a1, m2._data[n + 1]));
+            r = vaddq_f32(r, vmulq_n_f32(a2, m2._data[n + 2]));
+            vst1q_f32(&res._data[n], r);
+        }
+        vst1q_f32(&res._data[12], vaddq_f32(vld1q_f32(&res._data[12]), a3));
+        return res;
+    }
+#endif
 
 }
 
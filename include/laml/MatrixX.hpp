@@ -0,0 +1,757 @@
+#ifndef __LAML_MATRIXX_H
+#define __LAML_MATRIXX_H
+
+#include <laml/laml.hpp>
+#include <laml/Simd.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace laml {
+    /* Runtime-sized matrices and vectors, for systems with tens to hundreds of unknowns (IK, least squares).
+    * Storage is column-major like Matrix<T,rows,cols>: element (row, col) lives at data[col * stride + row].
+    * Kernels read ConstMatrixViews and write MatrixViews, which can also look at a fixed-size Matrix or Vector without copying (see view()).
+    * */
+
+    // Non-owning, read-only view of a column-major block. Kernels take their inputs through it.
+    template<typename T>
+    struct ConstMatrixView {
+        const T* _data;
+        size_t _rows;
+        size_t _cols;
+        size_t _stride; // elements from the start of one column to the next
+
+        ConstMatrixView(const T* data, size_t rows, size_t cols, size_t stride) : _data(data), _rows(rows), _cols(cols), _stride(stride) {}
+
+        size_t rows() const { return _rows; }
+        size_t cols() const { return _cols; }
+        size_t stride() const { return _stride; }
+
+        const T* data() const { return _data; }
+        const T* col(size_t c) const { return _data + c * _stride; }
+
+        const T& operator()(size_t row, size_t col) const { return _data[col * _stride + row]; }
+
+        // view of the rows x cols block whose top-left element is (row, col)
+        ConstMatrixView block(size_t row, size_t col, size_t rows, size_t cols) const {
+            return { _data + col * _stride + row, rows, cols, _stride };
+        }
+    };
+
+    // Non-owning view of a writable block; it is also a read-only view of the same elements.
+    template<typename T>
+    struct MatrixView : public ConstMatrixView<T> {
+        MatrixView(T* data, size_t rows, size_t cols, size_t stride) : ConstMatrixView<T>(data, rows, cols, stride) {}
+
+        // the data of a writable view is only ever set from T*
+        T* data() { return const_cast<T*>(this->_data); }
+        const T* data() const { return this->_data; }
+        T* col(size_t c) { return data() + c * this->_stride; }
+        const T* col(size_t c) const { return this->_data + c * this->_stride; }
+
+        T& operator()(size_t row, size_t col) { return data()[col * this->_stride + row]; }
+        const T& operator()(size_t row, size_t col) const { return this->_data[col * this->_stride + row]; }
+
+        MatrixView block(size_t row, size_t col, size_t rows, size_t cols) {
+            return { data() + col * this->_stride + row, rows, cols, this->_stride };
+        }
+        ConstMatrixView<T> block(size_t row, size_t col, size_t rows, size_t cols) const {
+            return ConstMatrixView<T>::block(row, col, rows, cols);
+        }
+    };
+
+    // Zero-copy views over the fixed-size types; const ones give read-only views
+    template<typename T, size_t rows, size_t cols>
+    MatrixView<T> view(Matrix<T, rows, cols>& mat) {
+        return { &mat[0][0], rows, cols, sizeof(Vector<T, rows>) / sizeof(T) };
+    }
+    template<typename T, size_t rows, size_t cols>
+    ConstMatrixView<T> view(const Matrix<T, rows, cols>& mat) {
+        return { &mat[0][0], rows, cols, sizeof(Vector<T, rows>) / sizeof(T) };
+    }
+    template<typename T, size_t size>
+    MatrixView<T> view(Vector<T, size>& vec) {
+        return { &vec[0], size, 1, size };
+    }
+    template<typename T, size_t size>
+    ConstMatrixView<T> view(const Vector<T, size>& vec) {
+        return { &vec[0], size, 1, size };
+    }
+
+    // dst = src; both have the same shape
+    template<typename T>
+    void copy(const ConstMatrixView<T>& src, MatrixView<T> dst) {
+        for (size_t c = 0; c < src.cols(); c++) {
+            for (size_t r = 0; r < src.rows(); r++) {
+                dst(r, c) = src(r, c);
+            }
+        }
+    }
+
+    namespace detail {
+        // column length rounded up so every column starts on a simd::alignment boundary
+        template<typename T>
+        inline size_t padded_stride(size_t rows) {
+            const size_t lane_elems = simd::alignment / sizeof(T);
+            return ((rows + lane_elems - 1) / lane_elems) * lane_elems;
+        }
+    }
+
+    /* Owning matrix on aligned heap storage.
+    * Every column starts on a simd::alignment boundary; the padding rows are kept at zero.
+    * */
+    template<typename T>
+    struct MatrixX : public MatrixView<T> {
+        MatrixX() : MatrixView<T>(nullptr, 0, 0, 0) {}
+        MatrixX(size_t rows, size_t cols) : MatrixX() {
+            resize(rows, cols);
+        }
+        explicit MatrixX(const ConstMatrixView<T>& other) : MatrixX(other.rows(), other.cols()) {
+            copy(other, *this);
+        }
+        MatrixX(const MatrixX& other) : MatrixX(static_cast<const ConstMatrixView<T>&>(other)) {}
+        MatrixX(MatrixX&& other) noexcept : MatrixX() {
+            swap(other);
+        }
+        ~MatrixX() {
+            release(this->data());
+        }
+
+        MatrixX& operator=(const MatrixX& other) {
+            if (this != &other) {
+                MatrixX tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+        MatrixX& operator=(MatrixX&& other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        // existing elements are kept, new ones are zero
+        void resize(size_t rows, size_t cols) {
+            if (rows == this->_rows && cols == this->_cols) {
+                return;
+            }
+            const size_t stride = detail::padded_stride<T>(rows);
+            T* data = nullptr;
+            if (stride != 0 && cols != 0) {
+                data = static_cast<T*>(::operator new(sizeof(T) * stride * cols, std::align_val_t(simd::alignment)));
+                for (size_t n = 0; n < stride * cols; n++) {
+                    data[n] = static_cast<T>(0.0);
+                }
+            }
+            const MatrixView<T> kept{ data, std::min(rows, this->_rows), std::min(cols, this->_cols), stride };
+            copy(this->block(0, 0, kept.rows(), kept.cols()), kept);
+            release(this->data());
+            this->_data = data;
+            this->_rows = rows;
+            this->_cols = cols;
+            this->_stride = stride;
+        }
+
+        void swap(MatrixX& other) noexcept {
+            std::swap(this->_data, other._data);
+            std::swap(this->_rows, other._rows);
+            std::swap(this->_cols, other._cols);
+            std::swap(this->_stride, other._stride);
+        }
+
+    private:
+        static void release(T* block) {
+            if (block) {
+                ::operator delete(block, std::align_val_t(simd::alignment));
+            }
+        }
+    };
+
+    // Owning column vector: a MatrixX with one column
+    template<typename T>
+    struct VectorX : public MatrixX<T> {
+        VectorX() : MatrixX<T>(0, 1) {}
+        explicit VectorX(size_t size) : MatrixX<T>(size, 1) {}
+        // copy of a single-column view
+        explicit VectorX(const ConstMatrixView<T>& column) : MatrixX<T>(column) {}
+        template<size_t size>
+        explicit VectorX(const Vector<T, size>& vec) : MatrixX<T>(view(vec)) {}
+
+        size_t size() const { return this->_rows; }
+
+        T& operator[](size_t idx) { return this->data()[idx]; }
+        const T& operator[](size_t idx) const { return this->_data[idx]; }
+
+        // existing elements are kept, new ones are zero
+        void resize(size_t size) {
+            MatrixX<T>::resize(size, 1);
+        }
+    };
+
+    namespace detail {
+        // y[0:n] += alpha * x[0:n]
+        template<typename T>
+        inline void axpy(size_t n, T alpha, const T* x, T* y) {
+            typedef simd::packet<T> P;
+            const P a = simd::splat<T, P>::from(alpha);
+            size_t i = 0;
+            for (; i + P::width <= n; i += P::width) {
+                simd::storeu(y + i, simd::loadu(y + i) + a * simd::loadu(x + i));
+            }
+            for (; i < n; i++) {
+                y[i] = y[i] + alpha * x[i];
+            }
+        }
+
+        // x[0:n] . y[0:n]
+        template<typename T>
+        inline T inner(size_t n, const T* x, const T* y) {
+            typedef simd::packet<T> P;
+            P acc = simd::splat<T, P>::from(static_cast<T>(0.0));
+            size_t i = 0;
+            for (; i + P::width <= n; i += P::width) {
+                acc = acc + simd::loadu(x + i) * simd::loadu(y + i);
+            }
+            T lanes[P::width];
+            simd::storeu(lanes, acc);
+            T res = static_cast<T>(0.0);
+            for (size_t k = 0; k < P::width; k++) {
+                res = res + lanes[k];
+            }
+            for (; i < n; i++) {
+                res = res + x[i] * y[i];
+            }
+            return res;
+        }
+
+        template<typename R, typename T, typename F>
+        R map(const ConstMatrixView<T>& a, F op) {
+            R res(a);
+            for (size_t c = 0; c < a.cols(); c++) {
+                for (size_t r = 0; r < a.rows(); r++) {
+                    res(r, c) = op(a(r, c));
+                }
+            }
+            return res;
+        }
+        template<typename R, typename T, typename F>
+        R zip(const ConstMatrixView<T>& a, const ConstMatrixView<T>& b, F op) {
+            R res(a);
+            for (size_t c = 0; c < a.cols(); c++) {
+                for (size_t r = 0; r < a.rows(); r++) {
+                    res(r, c) = op(a(r, c), b(r, c));
+                }
+            }
+            return res;
+        }
+    }
+
+    /* Component-wise operators
+    * */
+    template<typename T>
+    MatrixX<T> operator+(const MatrixX<T>& a, const MatrixX<T>& b) {
+        return detail::zip<MatrixX<T>>(a, b, [](T x, T y) { return x + y; });
+    }
+    template<typename T>
+    MatrixX<T> operator-(const MatrixX<T>& a, const MatrixX<T>& b) {
+        return detail::zip<MatrixX<T>>(a, b, [](T x, T y) { return x - y; });
+    }
+    template<typename T>
+    MatrixX<T> operator*(const MatrixX<T>& a, const T& factor) {
+        return detail::map<MatrixX<T>>(a, [factor](T x) { return x * factor; });
+    }
+    template<typename T>
+    MatrixX<T> operator/(const MatrixX<T>& a, const T& factor) {
+        return detail::map<MatrixX<T>>(a, [factor](T x) { return x / factor; });
+    }
+    template<typename T>
+    VectorX<T> operator+(const VectorX<T>& a, const VectorX<T>& b) {
+        return detail::zip<VectorX<T>>(a, b, [](T x, T y) { return x + y; });
+    }
+    template<typename T>
+    VectorX<T> operator-(const VectorX<T>& a, const VectorX<T>& b) {
+        return detail::zip<VectorX<T>>(a, b, [](T x, T y) { return x - y; });
+    }
+    template<typename T>
+    VectorX<T> operator*(const VectorX<T>& a, const T& factor) {
+        return detail::map<VectorX<T>>(a, [factor](T x) { return x * factor; });
+    }
+    template<typename T>
+    VectorX<T> operator/(const VectorX<T>& a, const T& factor) {
+        return detail::map<VectorX<T>>(a, [factor](T x) { return x / factor; });
+    }
+
+    // Free functions
+    template<typename T>
+    void fill(MatrixView<T> mat, T value) {
+        for (size_t c = 0; c < mat.cols(); c++) {
+            for (size_t r = 0; r < mat.rows(); r++) {
+                mat(r, c) = value;
+            }
+        }
+    }
+
+    template<typename T>
+    void identity(MatrixView<T> mat) {
+        fill(mat, static_cast<T>(0.0));
+        for (size_t n = 0; n < mat.rows() && n < mat.cols(); n++) {
+            mat(n, n) = static_cast<T>(1.0);
+        }
+    }
+
+    template<typename T>
+    MatrixX<T> transpose(const ConstMatrixView<T>& mat) {
+        MatrixX<T> res(mat.cols(), mat.rows());
+        for (size_t c = 0; c < mat.cols(); c++) {
+            for (size_t r = 0; r < mat.rows(); r++) {
+                res(c, r) = mat(r, c);
+            }
+        }
+        return res;
+    }
+
+    template<typename T>
+    T dot(const VectorX<T>& a, const VectorX<T>& b) {
+        return detail::inner(a.size(), a.data(), b.data());
+    }
+    template<typename T>
+    T length(const VectorX<T>& vec) {
+        return std::sqrt(dot(vec, vec));
+    }
+
+    namespace detail {
+        // Cache blocking of gemm: a gemm_rows x gemm_depth block of A (64KB of float) stays in L2
+        // while every column of B streams past it.
+        constexpr size_t gemm_rows = 128;
+        constexpr size_t gemm_depth = 128;
+
+        /* c[0:rows, 0:NR] += alpha * a[0:rows, 0:depth] * b[0:depth, 0:NR], rows a multiple of V::width.
+        * Register tile of 2 packets x NR columns: each load of A feeds NR multiply-adds.
+        * */
+        template<typename V, size_t NR, typename T>
+        inline void gemm_tile(size_t rows, size_t depth, const T* a, size_t lda, const T* b, size_t ldb, T alpha, T* c, size_t ldc) {
+            const size_t W = V::width;
+            const V zero = simd::splat<T, V>::from(static_cast<T>(0.0));
+            const V scale = simd::splat<T, V>::from(alpha);
+            size_t i = 0;
+            for (; i + 2 * W <= rows; i += 2 * W) {
+                V acc0[NR], acc1[NR];
+                for (size_t j = 0; j < NR; j++) {
+                    acc0[j] = zero;
+                    acc1[j] = zero;
+                }
+                for (size_t k = 0; k < depth; k++) {
+                    const V a0 = simd::load<T, V>::from(a + k * lda + i);
+                    const V a1 = simd::load<T, V>::from(a + k * lda + i + W);
+                    for (size_t j = 0; j < NR; j++) {
+                        const V bk = simd::splat<T, V>::from(b[j * ldb + k]);
+                        acc0[j] = acc0[j] + a0 * bk;
+                        acc1[j] = acc1[j] + a1 * bk;
+                    }
+                }
+                for (size_t j = 0; j < NR; j++) {
+                    T* cj = c + j * ldc + i;
+                    simd::storeu(cj, simd::load<T, V>::from(cj) + scale * acc0[j]);
+                    simd::storeu(cj + W, simd::load<T, V>::from(cj + W) + scale * acc1[j]);
+                }
+            }
+            for (; i < rows; i += W) {
+                V acc[NR];
+                for (size_t j = 0; j < NR; j++) {
+                    acc[j] = zero;
+                }
+                for (size_t k = 0; k < depth; k++) {
+                    const V a0 = simd::load<T, V>::from(a + k * lda + i);
+                    for (size_t j = 0; j < NR; j++) {
+                        acc[j] = acc[j] + a0 * simd::splat<T, V>::from(b[j * ldb + k]);
+                    }
+                }
+                for (size_t j = 0; j < NR; j++) {
+                    T* cj = c + j * ldc + i;
+                    simd::storeu(cj, simd::load<T, V>::from(cj) + scale * acc[j]);
+                }
+            }
+        }
+
+        // whole packets of rows, then the remaining rows one at a time
+        template<size_t NR, typename T>
+        inline void gemm_panel(size_t rows, size_t depth, const T* a, size_t lda, const T* b, size_t ldb, T alpha, T* c, size_t ldc) {
+            typedef simd::packet<T> P;
+            const size_t packed = rows - rows % P::width;
+            gemm_tile<P, NR>(packed, depth, a, lda, b, ldb, alpha, c, ldc);
+            gemm_tile<simd::scalar_v<T>, NR>(rows - packed, depth, a + packed, lda, b, ldb, alpha, c + packed, ldc);
+        }
+    }
+
+    /* c = alpha * a * b + beta * c, blocked for the cache.
+    * a is m x k, b is k x n and c is m x n; c must not overlap a or b.
+    * beta = 0 ignores the old contents of c, so it does not need to be initialized.
+    * */
+    template<typename T>
+    void gemm(const ConstMatrixView<T>& a, const ConstMatrixView<T>& b, MatrixView<T> c,
+              T alpha = static_cast<T>(1.0), T beta = static_cast<T>(0.0)) {
+        for (size_t col = 0; col < c.cols(); col++) {
+            T* cc = c.col(col);
+            for (size_t row = 0; row < c.rows(); row++) {
+                cc[row] = (beta == static_cast<T>(0.0)) ? static_cast<T>(0.0) : beta * cc[row];
+            }
+        }
+        const size_t m = c.rows(), n = c.cols(), depth = a.cols();
+        for (size_t kk = 0; kk < depth; kk += detail::gemm_depth) {
+            const size_t kc = std::min(detail::gemm_depth, depth - kk);
+            for (size_t ii = 0; ii < m; ii += detail::gemm_rows) {
+                const size_t mc = std::min(detail::gemm_rows, m - ii);
+                const T* ab = a.col(kk) + ii;
+                size_t j = 0;
+                for (; j + 4 <= n; j += 4) {
+                    detail::gemm_panel<4>(mc, kc, ab, a.stride(), b.col(j) + kk, b.stride(), alpha, c.col(j) + ii, c.stride());
+                }
+                for (; j < n; j++) {
+                    detail::gemm_panel<1>(mc, kc, ab, a.stride(), b.col(j) + kk, b.stride(), alpha, c.col(j) + ii, c.stride());
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    MatrixX<T> mul(const ConstMatrixView<T>& a, const ConstMatrixView<T>& b) {
+        MatrixX<T> res(a.rows(), b.cols());
+        gemm(a, b, res);
+        return res;
+    }
+    template<typename T>
+    VectorX<T> mul(const ConstMatrixView<T>& a, const VectorX<T>& x) {
+        VectorX<T> res(a.rows());
+        gemm(a, x, res);
+        return res;
+    }
+
+    /* LU factorization with partial pivoting, P A = L U, of a square matrix.
+    * The runtime-sized counterpart of Lu<T,size>, with the trailing updates vectorized along the columns.
+    * */
+    template<typename T>
+    struct LuX {
+        MatrixX<T> lu;              // U on and above the diagonal, L below it (its unit diagonal implied)
+        std::vector<size_t> pivots; // step k swapped rows k and pivots[k]
+        T sign;                     // parity of the row swaps, +1 or -1
+        bool singular;              // a pivot was negligible against the largest entry of A, or rcond is below epsilon
+        T rcond;                    // estimate of 1 / (|A|_1 |inv(A)|_1): 1 is perfectly conditioned, 0 singular
+    };
+
+    namespace detail {
+        // x = A^-1 x in place
+        template<typename T>
+        void lu_solve(const LuX<T>& f, T* x) {
+            const size_t n = f.lu.rows();
+            for (size_t k = 0; k < n; k++) {
+                std::swap(x[k], x[f.pivots[k]]);
+            }
+            for (size_t k = 0; k < n; k++) {
+                axpy(n - k - 1, -x[k], f.lu.col(k) + k + 1, x + k + 1);
+            }
+            for (size_t k = n; k-- > 0;) {
+                x[k] = x[k] / f.lu(k, k);
+                axpy(k, -x[k], f.lu.col(k), x);
+            }
+        }
+
+        // x = A^-T x in place: through U^T and L^T, then the row swaps in reverse
+        template<typename T>
+        void lu_solve_transpose(const LuX<T>& f, T* x) {
+            const size_t n = f.lu.rows();
+            for (size_t k = 0; k < n; k++) {
+                x[k] = (x[k] - inner(k, f.lu.col(k), x)) / f.lu(k, k);
+            }
+            for (size_t k = n; k-- > 0;) {
+                x[k] = x[k] - inner(n - k - 1, f.lu.col(k) + k + 1, x + k + 1);
+            }
+            for (size_t k = n; k-- > 0;) {
+                std::swap(x[k], x[f.pivots[k]]);
+            }
+        }
+
+        // |inv(A)|_1 estimated from a few solves, as for Lu<T,size>
+        template<typename T>
+        T inverse_norm1(const LuX<T>& f) {
+            const size_t n = f.lu.rows();
+            std::vector<T> x(n, static_cast<T>(1.0) / static_cast<T>(n));
+            std::vector<T> y(n), z(n);
+            T estimate = static_cast<T>(0.0);
+            for (size_t iter = 0; iter < 5; iter++) {
+                y = x;
+                lu_solve(f, y.data());
+                T norm = static_cast<T>(0.0);
+                for (size_t i = 0; i < n; i++) {
+                    norm = norm + std::abs(y[i]);
+                    z[i] = (y[i] < static_cast<T>(0.0)) ? static_cast<T>(-1.0) : static_cast<T>(1.0);
+                }
+                if (iter > 0 && norm <= estimate) {
+                    break;
+                }
+                estimate = norm;
+
+                lu_solve_transpose(f, z.data());
+                size_t best = 0;
+                for (size_t i = 0; i < n; i++) {
+                    best = (std::abs(z[i]) > std::abs(z[best])) ? i : best;
+                }
+                if (iter > 0 && std::abs(z[best]) <= inner(n, z.data(), x.data())) {
+                    break;
+                }
+                std::fill(x.begin(), x.end(), static_cast<T>(0.0));
+                x[best] = static_cast<T>(1.0);
+            }
+            return estimate;
+        }
+    }
+
+    template<typename T>
+    LuX<T> lu(const ConstMatrixView<T>& a) {
+        const size_t n = a.rows();
+        LuX<T> res{ MatrixX<T>(a), std::vector<size_t>(n), static_cast<T>(1.0), false, static_cast<T>(0.0) };
+        MatrixX<T>& m = res.lu;
+
+        T largest = static_cast<T>(0.0);
+        T norm = static_cast<T>(0.0);
+        for (size_t c = 0; c < n; c++) {
+            T col_sum = static_cast<T>(0.0);
+            for (size_t r = 0; r < n; r++) {
+                largest = std::max(largest, std::abs(m(r, c)));
+                col_sum = col_sum + std::abs(m(r, c));
+            }
+            norm = std::max(norm, col_sum);
+        }
+        // catches pivots that vanish up to the rounding of the elimination itself
+        const T tolerance = largest * static_cast<T>(n) * std::numeric_limits<T>::epsilon();
+
+        for (size_t k = 0; k < n; k++) {
+            T* ck = m.col(k);
+            size_t p = k;
+            for (size_t i = k + 1; i < n; i++) {
+                p = (std::abs(ck[i]) > std::abs(ck[p])) ? i : p;
+            }
+            res.pivots[k] = p;
+            if (p != k) {
+                for (size_t j = 0; j < n; j++) {
+                    std::swap(m(k, j), m(p, j));
+                }
+                res.sign = -res.sign;
+            }
+            if (std::abs(ck[k]) <= tolerance) {
+                res.singular = true;
+                if (ck[k] == static_cast<T>(0.0)) {
+                    continue;
+                }
+            }
+            // column k becomes L, then a rank-1 update of the trailing block, one contiguous column at a time
+            const T inv_pivot = static_cast<T>(1.0) / ck[k];
+            for (size_t i = k + 1; i < n; i++) {
+                ck[i] = ck[i] * inv_pivot;
+            }
+            for (size_t j = k + 1; j < n; j++) {
+                T* cj = m.col(j);
+                detail::axpy(n - k - 1, -cj[k], ck + k + 1, cj + k + 1);
+            }
+        }
+
+        // singular to working precision, as for Lu<T,size>: the pivot test alone misses rounded rank deficiency
+        if (!res.singular) {
+            res.rcond = static_cast<T>(1.0) / (norm * detail::inverse_norm1(res));
+            res.singular = res.rcond <= std::numeric_limits<T>::epsilon();
+        }
+        return res;
+    }
+
+    template<typename T>
+    VectorX<T> solve(const LuX<T>& f, const VectorX<T>& b) {
+        VectorX<T> x(b);
+        detail::lu_solve(f, x.data());
+        return x;
+    }
+    template<typename T>
+    MatrixX<T> solve(const LuX<T>& f, const ConstMatrixView<T>& b) {
+        MatrixX<T> x(b);
+        for (size_t c = 0; c < x.cols(); c++) {
+            detail::lu_solve(f, x.col(c));
+        }
+        return x;
+    }
+
+    template<typename T>
+    T det(const LuX<T>& f) {
+        T res = f.sign;
+        for (size_t k = 0; k < f.lu.rows(); k++) {
+            res = res * f.lu(k, k);
+        }
+        return res;
+    }
+
+    template<typename T>
+    MatrixX<T> inverse(const LuX<T>& f) {
+        MatrixX<T> res(f.lu.rows(), f.lu.rows());
+        identity(res);
+        for (size_t c = 0; c < res.cols(); c++) {
+            detail::lu_solve(f, res.col(c));
+        }
+        return res;
+    }
+
+    /* Cholesky factorization A = L L^T of a symmetric positive definite matrix.
+    * Half the work of LU and no pivoting; only the lower triangle of A is read.
+    * */
+    template<typename T>
+    struct CholeskyX {
+        MatrixX<T> l;            // lower triangular, zero above the diagonal
+        bool positive_definite;  // false if a pivot was not positive; l is then incomplete
+    };
+
+    template<typename T>
+    CholeskyX<T> cholesky(const ConstMatrixView<T>& a) {
+        const size_t n = a.rows();
+        CholeskyX<T> res{ MatrixX<T>(n, n), true };
+        MatrixX<T>& l = res.l;
+        for (size_t j = 0; j < n; j++) {
+            T* lj = l.col(j);
+            for (size_t i = j; i < n; i++) {
+                lj[i] = a(i, j);
+            }
+            for (size_t k = 0; k < j; k++) {
+                detail::axpy(n - j, -l(j, k), l.col(k) + j, lj + j);
+            }
+            if (!(lj[j] > static_cast<T>(0.0))) {
+                res.positive_definite = false;
+                return res;
+            }
+            lj[j] = std::sqrt(lj[j]);
+            const T inv_pivot = static_cast<T>(1.0) / lj[j];
+            for (size_t i = j + 1; i < n; i++) {
+                lj[i] = lj[i] * inv_pivot;
+            }
+        }
+        return res;
+    }
+
+    template<typename T>
+    VectorX<T> solve(const CholeskyX<T>& f, const VectorX<T>& b) {
+        const size_t n = f.l.rows();
+        VectorX<T> x(b);
+        for (size_t k = 0; k < n; k++) {
+            x[k] = x[k] / f.l(k, k);
+            detail::axpy(n - k - 1, -x[k], f.l.col(k) + k + 1, x.data() + k + 1);
+        }
+        for (size_t k = n; k-- > 0;) {
+            x[k] = (x[k] - detail::inner(n - k - 1, f.l.col(k) + k + 1, x.data() + k + 1)) / f.l(k, k);
+        }
+        return x;
+    }
+
+    /* Householder QR factorization A = Q R of a rows x cols matrix, rows >= cols.
+    * Slower than LU and Cholesky but stable on ill-conditioned and non-square systems:
+    * solve() gives the least-squares solution of an overdetermined system.
+    * */
+    template<typename T>
+    struct QrX {
+        MatrixX<T> qr;  // R on and above the diagonal, the Householder vectors v_k below it (v_k[k] = 1 implied)
+        VectorX<T> tau; // reflector k is H_k = I - tau[k] v_k v_k^T, and Q = H_0 H_1 ... H_cols-1
+        bool full_rank; // no diagonal element of R is negligible against the largest one
+
+        // thin Q, rows x cols with orthonormal columns
+        MatrixX<T> q() const;
+        // cols x cols upper triangle
+        MatrixX<T> r() const;
+    };
+
+    namespace detail {
+        // x[k:rows] = H_k x[k:rows]
+        template<typename T>
+        void reflect(const MatrixX<T>& qr, size_t k, T tau, T* x) {
+            const size_t m = qr.rows();
+            const T* v = qr.col(k);
+            const T w = tau * (x[k] + inner(m - k - 1, v + k + 1, x + k + 1));
+            x[k] = x[k] - w;
+            axpy(m - k - 1, -w, v + k + 1, x + k + 1);
+        }
+    }
+
+    template<typename T>
+    QrX<T> qr(const ConstMatrixView<T>& a) {
+        const size_t m = a.rows(), n = a.cols();
+        QrX<T> res{ MatrixX<T>(a), VectorX<T>(n), true };
+        MatrixX<T>& f = res.qr;
+        T largest = static_cast<T>(0.0);
+        for (size_t k = 0; k < n; k++) {
+            T* ck = f.col(k);
+            const T alpha = ck[k];
+            const T tail = detail::inner(m - k - 1, ck + k + 1, ck + k + 1);
+            if (tail > static_cast<T>(0.0)) {
+                // beta gets the opposite sign of alpha, so alpha - beta does not cancel
+                const T norm = std::sqrt(alpha * alpha + tail);
+                const T beta = (alpha > static_cast<T>(0.0)) ? -norm : norm;
+                res.tau[k] = (beta - alpha) / beta;
+                const T inv = static_cast<T>(1.0) / (alpha - beta);
+                for (size_t i = k + 1; i < m; i++) {
+                    ck[i] = ck[i] * inv;
+                }
+                ck[k] = beta;
+                for (size_t j = k + 1; j < n; j++) {
+                    detail::reflect(f, k, res.tau[k], f.col(j));
+                }
+            }
+            largest = std::max(largest, std::abs(ck[k]));
+        }
+        const T tolerance = largest * static_cast<T>(m) * std::numeric_limits<T>::epsilon();
+        for (size_t k = 0; k < n; k++) {
+            res.full_rank = res.full_rank && std::abs(f(k, k)) > tolerance;
+        }
+        return res;
+    }
+
+    template<typename T>
+    MatrixX<T> QrX<T>::q() const {
+        MatrixX<T> res(qr.rows(), qr.cols());
+        identity(res);
+        for (size_t c = 0; c < res.cols(); c++) {
+            for (size_t k = qr.cols(); k-- > 0;) {
+                detail::reflect(qr, k, tau[k], res.col(c));
+            }
+        }
+        return res;
+    }
+
+    template<typename T>
+    MatrixX<T> QrX<T>::r() const {
+        MatrixX<T> res(qr.cols(), qr.cols());
+        for (size_t c = 0; c < res.cols(); c++) {
+            for (size_t r = 0; r <= c; r++) {
+                res(r, c) = qr(r, c);
+            }
+        }
+        return res;
+    }
+
+    // x minimizing |A x - b|; the exact solution when A is square
+    template<typename T>
+    VectorX<T> solve(const QrX<T>& f, const VectorX<T>& b) {
+        const size_t n = f.qr.cols();
+        VectorX<T> y(b);
+        for (size_t k = 0; k < n; k++) {
+            detail::reflect(f.qr, k, f.tau[k], y.data());
+        }
+        VectorX<T> x(y.block(0, 0, n, 1));
+        for (size_t k = n; k-- > 0;) {
+            x[k] = x[k] / f.qr(k, k);
+            detail::axpy(k, -x[k], f.qr.col(k), x.data());
+        }
+        return x;
+    }
+
+    // Useful shorthands
+    typedef MatrixX<float> MatX;
+    typedef VectorX<float> VecX;
+    typedef MatrixX<double> MatX_highp;
+    typedef VectorX<double> VecX_highp;
+}
+
+#endif // __LAML_MATRIXX_H
@@ -10,6 +10,8 @@
 #include <laml/laml.hpp>
 #include <laml/Vector.hpp>
 #include <laml/Data_types.hpp>
+#include <cmath>
+#include <limits>
 
 
 namespace laml {
@@ -40,17 +42,17 @@ namespace laml {
 		
         // Initialize with single value for all diagonal - Not really a constructor tho..
         template<class V = typename std::enable_if<rows != 1 && rows==cols, T>::type>
-        Matrix(T value) {
+        constexpr Matrix(T value) : _data{} {
             for (size_t n = 0; n < rows; n++) {
                 _data[n][n] = value;
             }
         }
 		
         // access like an array
-        Vector<T,rows>& operator[](size_t idx) {
+        constexpr Vector<T,rows>& operator[](size_t idx) {
             return _data[idx];
         }
-        const Vector<T, rows>& operator[](size_t idx) const {
+        constexpr const Vector<T, rows>& operator[](size_t idx) const {
             return _data[idx];
         }
 		
@@ -101,7 +103,7 @@ namespace laml {
         * These are all component-wise operations
         * */
     template<typename T, size_t rows, size_t cols>
-    Matrix<T, rows, cols> operator+(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
+    constexpr Matrix<T, rows, cols> operator+(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
         Matrix<T, rows, cols> res;
         for (size_t n = 0; n < cols; n++) {
             res[n] = mat[n] + other[n];
@@ -110,7 +112,7 @@ namespace laml {
     }
 	
     template<typename T, size_t rows, size_t cols>
-    Matrix<T, rows, cols> operator-(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
+    constexpr Matrix<T, rows, cols> operator-(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
         Matrix<T, rows, cols> res;
         for (size_t n = 0; n < cols; n++) {
             res[n] = mat[n] - other[n];
@@ -137,7 +139,7 @@ namespace laml {
     //}
 
     template<typename T, size_t rows, size_t cols>
-    bool operator==(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
+    constexpr bool operator==(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
                    for (size_t n = 0; n < cols; n++) {
                    if (mat[n] != other[n])
                    return false;
@@ -145,7 +147,7 @@ namespace laml {
                    return true;
     }
     template<typename T, size_t rows, size_t cols>
-    bool operator!=(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
+    constexpr bool operator!=(const Matrix<T, rows, cols>& mat, const Matrix<T, rows, cols>& other) {
                    for (size_t n = 0; n < cols; n++) {
                    if (mat[n] == other[n])
                    return false;
@@ -158,7 +160,7 @@ namespace laml {
         * These are all component-wise operations
         * */
     template<typename T, size_t rows, size_t cols>
-    Matrix<T, rows, cols> operator*(const Matrix<T, rows, cols>& mat, const T& factor) {
+    constexpr Matrix<T, rows, cols> operator*(const Matrix<T, rows, cols>& mat, const T& factor) {
         Matrix<T, rows, cols> res;
         for (size_t n = 0; n < cols; n++) {
             res[n] = mat[n] * factor;
@@ -167,7 +169,7 @@ namespace laml {
     }
 
     template<typename T, size_t rows, size_t cols>
-    Matrix<T, rows, cols> operator/(const Matrix<T, rows, cols>& mat, const T& factor) {
+    constexpr Matrix<T, rows, cols> operator/(const Matrix<T, rows, cols>& mat, const T& factor) {
         Matrix<T, rows, cols> res;
         for (size_t n = 0; n < cols; n++) {
             res[n] = mat[n] / factor;
@@ -177,7 +179,7 @@ namespace laml {
 
     // Free functions
     template<typename T, size_t size>
-    void identity(Matrix<T, size, size>& mat) {
+    constexpr void identity(Matrix<T, size, size>& mat) {
         fill(mat, static_cast<T>(0.0));
         for (size_t i = 0; i < size; i++) {
             mat[i][i] = static_cast<T>(1.0);
@@ -185,10 +187,10 @@ namespace laml {
     }
 
     template<typename T, size_t rows, size_t cols>
-    void fill(Matrix<T, rows, cols>& mat, T value) {
-        for (size_t i = 0; i < rows; i++) {
-            for (size_t j = 0; j < cols; j++) {
-                mat[i][j] = value;
+    constexpr void fill(Matrix<T, rows, cols>& mat, T value) {
+        for (size_t j = 0; j < cols; j++) {
+            for (size_t i = 0; i < rows; i++) {
+                mat[j][i] = value;
             }
         }
     }
@@ -196,7 +198,7 @@ namespace laml {
     // Slow multiply (triple for-loop). Make specialiazations for common-use cases
     template<typename T, size_t rows1, size_t cols1, size_t rows2, size_t cols2,
     class V = typename std::enable_if<cols1==rows2, T>::type>
-    Matrix<T, rows1, cols2> mul(const Matrix<T, rows1, cols1>& m1, const Matrix<T, rows2, cols2>& m2) {
+    constexpr Matrix<T, rows1, cols2> mul(const Matrix<T, rows1, cols1>& m1, const Matrix<T, rows2, cols2>& m2) {
         //std::cout << "SLOW MUL [" << rows1 << "," << cols1 << "]x[" << rows2 << "," << cols2 << "]" << std::endl;
         Matrix<T, rows1, cols2> res;
         for (size_t col = 0; col < cols2; col++) {
@@ -210,7 +212,7 @@ namespace laml {
     }
 
     template<typename T, size_t rows, size_t cols>
-    Matrix<T, cols, rows> transpose(const Matrix<T, rows, cols>& mat) {
+    constexpr Matrix<T, cols, rows> transpose(const Matrix<T, rows, cols>& mat) {
         Matrix<T, cols, rows> res;
         for (size_t i = 0; i < cols; i++) {
             for (size_t j = 0; j < rows; j++) {
@@ -220,35 +222,221 @@ namespace laml {
         return res;
     }
 
-    // determinant - recusrive method for arbitrary square matrix
+    /* LU factorization with partial pivoting, P A = L U.
+    * n^3/3 multiply-adds instead of the n! of a cofactor expansion, and one factorization
+    * serves det(), inverse() and any number of solve() calls.
+    * */
     template<typename T, size_t size>
-    T det(const Matrix<T, size, size>& mat) {
-#if 0
-        // TODO: Rethink logging/error handling
-        printf("recursive version\n");
-#endif
-        // create the minor matrices of rank size-1
-        // expand along the first column
-        T res = 0;
-        for (size_t n = 0; n < size; n++) {
-            T scalar = mat[0][n] * (n % 2 == 0 ? static_cast<T>(1.0) : static_cast<T>(-1));
-            Matrix<T, size - 1, size - 1> minor_mat = minor(mat, 0, n);
+    struct Lu {
+        Matrix<T, size, size> lu;   // U on and above the diagonal, L below it (unit diagonal implied)
+        size_t pivots[size];        // step k swapped rows k and pivots[k]
+        T sign;                     // parity of the row swaps, +1 or -1
+        bool singular;              // a pivot was negligible against the largest entry of A, or (lu() only) rcond is below epsilon
+        T rcond;                    // estimate of 1 / (|A|_1 |inv(A)|_1): 1 is perfectly conditioned, 0 singular
+    };
+
+    namespace detail {
+        // x = inv(A) x
+        template<typename T, size_t size>
+        void lu_solve(const Lu<T, size>& f, Vector<T, size>& x) {
+            for (size_t k = 0; k < size; k++) {
+                const T tmp = x[k];
+                x[k] = x[f.pivots[k]];
+                x[f.pivots[k]] = tmp;
+            }
+            for (size_t k = 0; k < size; k++) {
+                for (size_t i = k + 1; i < size; i++) {
+                    x[i] = x[i] - f.lu[k][i] * x[k];
+                }
+            }
+            for (size_t k = size; k-- > 0;) {
+                x[k] = x[k] / f.lu[k][k];
+                for (size_t i = 0; i < k; i++) {
+                    x[i] = x[i] - f.lu[k][i] * x[k];
+                }
+            }
+        }
+
+        // x = inv(A)^T x: through U^T and L^T, then the row swaps in reverse
+        template<typename T, size_t size>
+        void lu_solve_transpose(const Lu<T, size>& f, Vector<T, size>& x) {
+            for (size_t k = 0; k < size; k++) {
+                for (size_t i = 0; i < k; i++) {
+                    x[k] = x[k] - f.lu[k][i] * x[i];
+                }
+                x[k] = x[k] / f.lu[k][k];
+            }
+            for (size_t k = size; k-- > 0;) {
+                for (size_t i = k + 1; i < size; i++) {
+                    x[k] = x[k] - f.lu[k][i] * x[i];
+                }
+            }
+            for (size_t k = size; k-- > 0;) {
+                const T tmp = x[k];
+                x[k] = x[f.pivots[k]];
+                x[f.pivots[k]] = tmp;
+            }
+        }
+
+        // |inv(A)|_1 estimated from a few solves instead of the inverse (Hager 1984, Higham 1988)
+        template<typename T, size_t size>
+        T inverse_norm1(const Lu<T, size>& f) {
+            Vector<T, size> x;
+            for (size_t i = 0; i < size; i++) {
+                x[i] = static_cast<T>(1.0) / static_cast<T>(size);
+            }
+            T estimate = static_cast<T>(0.0);
+            for (size_t iter = 0; iter < 5; iter++) {
+                Vector<T, size> y = x;
+                lu_solve(f, y);
+                T norm = static_cast<T>(0.0);
+                Vector<T, size> z;
+                for (size_t i = 0; i < size; i++) {
+                    norm = norm + std::abs(y[i]);
+                    z[i] = (y[i] < static_cast<T>(0.0)) ? static_cast<T>(-1.0) : static_cast<T>(1.0);
+                }
+                if (iter > 0 && norm <= estimate) {
+                    break;
+                }
+                estimate = norm;
+
+                // the gradient picks the unit vector to try next; stop once it cannot improve
+                lu_solve_transpose(f, z);
+                size_t best = 0;
+                T zx = static_cast<T>(0.0);
+                for (size_t i = 0; i < size; i++) {
+                    best = (std::abs(z[i]) > std::abs(z[best])) ? i : best;
+                    zx = zx + z[i] * x[i];
+                }
+                if (iter > 0 && std::abs(z[best]) <= zx) {
+                    break;
+                }
+                for (size_t i = 0; i < size; i++) {
+                    x[i] = (i == best) ? static_cast<T>(1.0) : static_cast<T>(0.0);
+                }
+            }
+            return estimate;
+        }
+
+        // the factorization without the condition estimate, for det(), inverse() and solve() on a plain matrix
+        template<typename T, size_t size>
+        Lu<T, size> lu_factor(const Matrix<T, size, size>& mat, T& norm) {
+            Lu<T, size> res;
+            res.lu = mat;
+            res.sign = static_cast<T>(1.0);
+            res.singular = false;
+            Matrix<T, size, size>& m = res.lu;
+
+            T largest = static_cast<T>(0.0);
+            norm = static_cast<T>(0.0);
+            for (size_t j = 0; j < size; j++) {
+                T col_sum = static_cast<T>(0.0);
+                for (size_t i = 0; i < size; i++) {
+                    largest = std::abs(m[j][i]) > largest ? std::abs(m[j][i]) : largest;
+                    col_sum = col_sum + std::abs(m[j][i]);
+                }
+                norm = col_sum > norm ? col_sum : norm;
+            }
+            // catches pivots that vanish up to the rounding of the elimination itself
+            const T tolerance = largest * static_cast<T>(size) * std::numeric_limits<T>::epsilon();
+
+            for (size_t k = 0; k < size; k++) {
+                size_t p = k;
+                for (size_t i = k + 1; i < size; i++) {
+                    p = (std::abs(m[k][i]) > std::abs(m[k][p])) ? i : p;
+                }
+                res.pivots[k] = p;
+                if (p != k) {
+                    for (size_t j = 0; j < size; j++) {
+                        const T tmp = m[j][k];
+                        m[j][k] = m[j][p];
+                        m[j][p] = tmp;
+                    }
+                    res.sign = -res.sign;
+                }
+                if (std::abs(m[k][k]) <= tolerance) {
+                    res.singular = true;
+                    if (m[k][k] == static_cast<T>(0.0)) {
+                        continue;
+                    }
+                }
+                const T inv_pivot = static_cast<T>(1.0) / m[k][k];
+                for (size_t i = k + 1; i < size; i++) {
+                    m[k][i] = m[k][i] * inv_pivot;
+                }
+                for (size_t j = k + 1; j < size; j++) {
+                    for (size_t i = k + 1; i < size; i++) {
+                        m[j][i] = m[j][i] - m[j][k] * m[k][i];
+                    }
+                }
+            }
+            res.rcond = static_cast<T>(0.0);
+            return res;
+        }
+    }
+
+    template<typename T, size_t size>
+    Lu<T, size> lu(const Matrix<T, size, size>& mat) {
+        T norm;
+        Lu<T, size> res = detail::lu_factor(mat, norm);
+        // A that is singular only to working precision (say a row that is a rounded combination of others)
+        // can keep its last pivot thousands of times above the tolerance; its condition number gives it away
+        if (!res.singular) {
+            res.rcond = static_cast<T>(1.0) / (norm * detail::inverse_norm1(res));
+            res.singular = res.rcond <= std::numeric_limits<T>::epsilon();
+        }
+        return res;
+    }
 
-            // calculate dterminants of minor matrices "recursively"
-            // not techncally recursive, since templates tho :)
-            res = res + det(minor_mat) * scalar;
+    template<typename T, size_t size>
+    T det(const Lu<T, size>& f) {
+        T res = f.sign;
+        for (size_t k = 0; k < size; k++) {
+            res = res * f.lu[k][k];
         }
         return res;
     }
 
+    // solves A x = b, reusing the factorization of A
+    template<typename T, size_t size>
+    Vector<T, size> solve(const Lu<T, size>& f, const Vector<T, size>& b) {
+        Vector<T, size> x = b;
+        detail::lu_solve(f, x);
+        return x;
+    }
+    template<typename T, size_t size>
+    Vector<T, size> solve(const Matrix<T, size, size>& mat, const Vector<T, size>& b) {
+        T norm;
+        return solve(detail::lu_factor(mat, norm), b);
+    }
+
+    template<typename T, size_t size>
+    Matrix<T, size, size> inverse(const Lu<T, size>& f) {
+        Matrix<T, size, size> res;
+        for (size_t j = 0; j < size; j++) {
+            Vector<T, size> e;
+            e[j] = static_cast<T>(1.0);
+            detail::lu_solve(f, e);
+            res[j] = e;
+        }
+        return res;
+    }
+
+    // determinant - arbitrary square matrix, through its LU factorization
+    template<typename T, size_t size>
+    T det(const Matrix<T, size, size>& mat) {
+        T norm;
+        return det(detail::lu_factor(mat, norm));
+    }
+
     // determinant - 1x1 case
     template<typename T>
-    T det(const Matrix<T, 1, 1>& mat) {
+    constexpr T det(const Matrix<T, 1, 1>& mat) {
         return mat[0][0];
     }
 
     template<typename T, size_t size>
-    T trace(const Matrix<T, size, size>& mat) {
+    constexpr T trace(const Matrix<T, size, size>& mat) {
         T res = static_cast<T>(0.0);
         for (size_t n = 0; n < size; n++) {
             res = res + mat[n][n];
@@ -257,7 +445,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> diag(const Matrix<T, size, size>& mat) {
+    constexpr Vector<T, size> diag(const Matrix<T, size, size>& mat) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = mat[n][n];
@@ -267,7 +455,7 @@ namespace laml {
 
     // minor matrix
     template<typename T, size_t size>
-    Matrix<T, size-1, size-1> minor(const Matrix<T, size, size>& mat, size_t pick_col, size_t pick_row) {
+    constexpr Matrix<T, size-1, size-1> minor(const Matrix<T, size, size>& mat, size_t pick_col, size_t pick_row) {
         Matrix<T, size - 1, size - 1> minor;
         for (size_t i = 0; i < size - 1; i++) {
             size_t new_i = (i + 1 > pick_col) ? i + 1 : i;
@@ -280,40 +468,17 @@ namespace laml {
         return minor;
     }
 
-    // inverse - NOT FULLY IMPLEMENTED FOR ALL CASES
+    // inverse - arbitrary square matrix, through its LU factorization
+    // a singular matrix is returned unchanged, like the 2x2-4x4 versions; lu() reports singularity and conditioning
     template<typename T, size_t rows, size_t cols,
     class V = typename std::enable_if<rows==cols, T>::type>
     Matrix<T, rows, cols> inverse(const Matrix<T, rows, cols>& mat) {
-        /*
-        * inv(m) = adj(m)/det(m)
-        * only valid if det(m) != 0, so calculate that first.
-        * 
-        * to calculate adj(m):
-        *  - transpose m ->mT
-        *  - replace every element (i,j) of mT with the det(minor(m,i,j))
-        *  - multiply every element by its cofactor (+/- 1 alternating)
-        */
-
-        T determinant = det(mat);
-        if (fabs(determinant) < 1e-8) {
-            // TODO: Remove all print statements in this code >.<
-#if 0
-            std::cout << "Cannot inverse matrix: determinant = " << determinant << std::endl;
-#endif
+        T norm;
+        const Lu<T, rows> f = detail::lu_factor(mat, norm);
+        if (f.singular) {
             return mat;
         }
-
-        Matrix<T, rows, cols> mat_transpose = laml::transpose(mat);
-		
-        Matrix<T, rows, cols> res;
-        for (size_t i = 0; i < cols; i++) {
-            for (size_t j = 0; j < rows; j++) {
-                T cofactor = (i + j) % 2 == 0 ? static_cast<T>(1.0) : static_cast<T>(-1.0);
-                res[i][j] = laml::det(laml::minor(mat_transpose, i, j)) * cofactor;
-            }
-        }
-
-        return res / determinant;
+        return inverse(f);
     }
 
     // Specializations
@@ -0,0 +1,452 @@
+#ifndef __LAML_PACKED_H
+#define __LAML_PACKED_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <cstring>
+
+namespace laml {
+    /* Storage-only types for streamed data: decode to Vector<float,N> / Quaternion<float> to do math on them.
+    * Every type has batch encode()/decode() over arrays, overloaded on the packed type.
+    * Errors against the float input, measured over the ranges given:
+    *
+    *   half            |x| <= 65504        rel error <= 2^-11 (4.9e-4) for |x| >= 2^-14, abs error <= 2^-25 below
+    *   snorm16         [-1, 1]             abs error <= 1/65534 (1.6e-5)
+    *   unorm8          [0, 1]              abs error <= 1/510 (2.0e-3)
+    *   Vec3_oct        unit vectors        angle error < 7e-5 rad (0.004 degrees)
+    *   Quat_smallest3  unit quaternions    abs error < 7e-5 per component (of q or -q)
+    *
+    * Sizes against float: half and snorm16 are 2x smaller, unorm8 4x, Vec3_oct 3x, Quat_smallest3 2.7x.
+    * Outside those ranges: half rounds to inf past 65504 and keeps NaN a NaN; snorm16 and unorm8 clamp, with NaN
+    * going to the bottom of the range. Vec3_oct and Quat_smallest3 expect unit length input.
+    * */
+    namespace packed {
+
+        // IEEE 754 binary16: 1 sign, 5 exponent and 10 mantissa bits
+        struct half {
+            uint16 bits;
+
+            half() = default;
+            explicit half(float f);
+            explicit operator float() const;
+        };
+
+        // N storage values of type S, for N-component vectors
+        template<typename S, size_t N>
+        struct PackedVector {
+            S _data[N];
+
+            constexpr inline size_t num_elements() const { return N; }
+
+            constexpr S& operator[](size_t idx) { return _data[idx]; }
+            constexpr const S& operator[](size_t idx) const { return _data[idx]; }
+        };
+
+        // Unit vectors folded onto the octahedron |x| + |y| + |z| = 1 and projected to 2D, as two snorm16
+        struct Vec3_oct {
+            int16 _data[2];
+        };
+
+        /* Unit quaternions without their largest component, which is rebuilt from the unit length.
+        * The other three lie in [-1/sqrt(2), 1/sqrt(2)] and get 15 bits each; the largest one's index (2 bits)
+        * goes in the top bits of the first two, and its sign is made positive (q and -q are the same rotation).
+        * */
+        struct Quat_smallest3 {
+            uint16 _data[3];
+        };
+
+        namespace detail {
+            inline uint32 bits(float f) {
+                uint32 u;
+                std::memcpy(&u, &f, sizeof(u));
+                return u;
+            }
+            inline float from_bits(uint32 u) {
+                float f;
+                std::memcpy(&f, &u, sizeof(f));
+                return f;
+            }
+
+            /* float to half, rounding to nearest even.
+            * Subnormal results are rounded by the FPU: adding 0.5 lines the half subnormal step up with the float's last bit.
+            * */
+            inline uint16 float_to_half(float f) {
+                uint32 u = bits(f);
+                const uint32 sign = u & 0x80000000u;
+                u ^= sign;
+                // rebias the exponent from 127 to 15, and round the 13 dropped mantissa bits (a carry may reach inf)
+                const uint32 normal = (u + 0xc8000fffu + ((u >> 13) & 1u)) >> 13;
+                const uint32 subnormal = bits(from_bits(u) + 0.5f) - 0x3f000000u;
+                const uint32 inf_nan = (u > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+                const uint32 res = (u >= 0x47800000u) ? inf_nan : ((u < 0x38800000u) ? subnormal : normal);
+                return static_cast<uint16>(res | (sign >> 16));
+            }
+
+            inline float half_to_float(uint16 h) {
+                const uint32 shifted = (static_cast<uint32>(h) & 0x7fffu) << 13;
+                const uint32 exp = shifted & 0x0f800000u;
+                // rebias the exponent from 15 to 127, and once more for inf and NaN so they stay all ones
+                uint32 res = shifted + 0x38000000u + ((exp == 0x0f800000u) ? 0x38000000u : 0u);
+                // zero and subnormals: the mantissa as a float, minus the implicit one it was given
+                const uint32 subnormal = bits(from_bits(res + 0x00800000u) - from_bits(0x38800000u));
+                res = (exp == 0u) ? subnormal : res;
+                return from_bits(res | ((static_cast<uint32>(h) & 0x8000u) << 16));
+            }
+
+#if defined(LAML_SIMD_SSE)
+            // The same two conversions on SSE2 integer ops, one half per 32-bit lane
+            inline __m128i select(__m128i m, __m128i a, __m128i b) {
+                return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+            }
+            inline __m128i float_to_half(__m128 f) {
+                __m128i u = _mm_castps_si128(f);
+                const __m128i sign = _mm_and_si128(u, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+                u = _mm_xor_si128(u, sign);
+                const __m128i odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+                const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(static_cast<int>(0xc8000fffu))), odd), 13);
+                const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3f000000));
+                // u has no sign bit left, so the signed compares are fine
+                const __m128i inf_nan = select(_mm_cmpgt_epi32(u, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x7e00), _mm_set1_epi32(0x7c00));
+                __m128i res = select(_mm_cmplt_epi32(u, _mm_set1_epi32(0x38800000)), subnormal, normal);
+                res = select(_mm_cmpgt_epi32(u, _mm_set1_epi32(0x477fffff)), inf_nan, res);
+                return _mm_or_si128(res, _mm_srli_epi32(sign, 16));
+            }
+            inline __m128 half_to_float(__m128i h) {
+                const __m128i shifted = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+                const __m128i exp = _mm_and_si128(shifted, _mm_set1_epi32(0x0f800000));
+                const __m128i rebias = _mm_set1_epi32(0x38000000);
+                __m128i res = _mm_add_epi32(_mm_add_epi32(shifted, rebias), _mm_and_si128(_mm_cmpeq_epi32(exp, _mm_set1_epi32(0x0f800000)), rebias));
+                const __m128i subnormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(res, _mm_set1_epi32(0x00800000))),
+                                                                      _mm_castsi128_ps(_mm_set1_epi32(0x38800000))));
+                res = select(_mm_cmpeq_epi32(exp, _mm_setzero_si128()), subnormal, res);
+                return _mm_castsi128_ps(_mm_or_si128(res, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+            }
+            // Low 16 bits of each 32-bit lane of a, then of b (sign-extended first, so the saturating pack keeps them)
+            inline __m128i pack_low16(__m128i a, __m128i b) {
+                return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+            }
+#endif
+
+            // Truncates floats holding whole numbers in [-32768, 65535] to their low 16 bits
+            template<typename S>
+            inline void store_16(const float* in, S* out, size_t count) {
+                static_assert(sizeof(S) == 2, "16-bit storage");
+                size_t n = 0;
+#if defined(LAML_SIMD_SSE)
+                for (; n + 8 <= count; n += 8) {
+                    const __m128i r = pack_low16(_mm_cvttps_epi32(_mm_loadu_ps(in + n)), _mm_cvttps_epi32(_mm_loadu_ps(in + n + 4)));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), r);
+                }
+#endif
+                for (; n < count; n++) {
+                    out[n] = static_cast<S>(static_cast<int32>(in[n]));
+                }
+            }
+            // Truncates floats holding whole numbers in [0, 255]
+            inline void store_8(const float* in, uint8* out, size_t count) {
+                size_t n = 0;
+#if defined(LAML_SIMD_SSE)
+                for (; n + 16 <= count; n += 16) {
+                    const __m128i lo = _mm_packs_epi32(_mm_cvttps_epi32(_mm_loadu_ps(in + n)), _mm_cvttps_epi32(_mm_loadu_ps(in + n + 4)));
+                    const __m128i hi = _mm_packs_epi32(_mm_cvttps_epi32(_mm_loadu_ps(in + n + 8)), _mm_cvttps_epi32(_mm_loadu_ps(in + n + 12)));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), _mm_packus_epi16(lo, hi));
+                }
+#endif
+                for (; n < count; n++) {
+                    out[n] = static_cast<uint8>(static_cast<int32>(in[n]));
+                }
+            }
+            inline void store_narrow(const float* in, int16* out, size_t count) { store_16(in, out, count); }
+            inline void store_narrow(const float* in, uint8* out, size_t count) { store_8(in, out, count); }
+
+            // Elements per tile: the float math runs one packet at a time into stack lanes, which are then stored narrow
+            constexpr size_t tile_size = soa::detail::tile_size;
+
+            template<typename P>
+            inline P k(float value) {
+                return simd::splat<float, P>::from(value);
+            }
+            template<typename P>
+            inline P sign_not_zero(const P& v) {
+                return simd::select(v < k<P>(0.0f), k<P>(-1.0f), k<P>(1.0f));
+            }
+
+            // kernel(const P* in, P* out) over count floats, one packet at a time, then stored narrow
+            template<typename S, typename F>
+            inline void encode_flat(const float* in, S* out, size_t count, F kernel) {
+                alignas(simd::alignment) float scaled[tile_size];
+                for (size_t base = 0; base < count; base += tile_size) {
+                    const size_t tile = (count - base < tile_size) ? (count - base) : tile_size;
+                    const float* src[1] = { in + base };
+                    float* dst[1] = { scaled };
+                    const size_t stride[1] = { 1 };
+                    soa::detail::for_each_packet(tile, src, stride, dst, stride, kernel);
+                    store_narrow(scaled, out + base, tile);
+                }
+            }
+
+            // v clamped to [lo, hi], NaN to lo. The comparison, not max, keeps NaN out: NEON's max propagates it,
+            // and a NaN that reached the integer conversion in store_16/store_8 would be undefined behavior
+            template<typename P>
+            inline P clamp(const P& v, const P& lo, const P& hi) {
+                return simd::min(simd::select(v >= lo, v, lo), hi);
+            }
+
+            // Scaled so truncation rounds to nearest, halves away from zero
+            template<typename P>
+            inline P snorm16_scaled(const P& v) {
+                const P x = clamp(v, k<P>(-1.0f), k<P>(1.0f));
+                return x * k<P>(32767.0f) + simd::select(x < k<P>(0.0f), k<P>(-0.5f), k<P>(0.5f));
+            }
+            inline float from_snorm16(int16 q) {
+                // -32768 is also -1
+                const float x = static_cast<float>(q) * (1.0f / 32767.0f);
+                return (x > -1.0f) ? x : -1.0f;
+            }
+            template<typename P>
+            inline P unorm8_scaled(const P& v) {
+                const P x = clamp(v, k<P>(0.0f), k<P>(1.0f));
+                return x * k<P>(255.0f) + k<P>(0.5f);
+            }
+            inline float from_unorm8(uint8 q) {
+                return static_cast<float>(q) * (1.0f / 255.0f);
+            }
+        }
+
+        inline half::half(float f) : bits(detail::float_to_half(f)) {}
+        inline half::operator float() const { return detail::half_to_float(bits); }
+
+        // Plain arrays of floats. With F16C (e.g. -mf16c or -march=native) the hardware conversion is used;
+        // it rounds the same way, only NaN payloads may come out differently
+        inline void encode(const float* in, half* out, size_t count) {
+            size_t n = 0;
+#if defined(__F16C__) && !defined(LAML_NO_SIMD)
+            for (; n + 8 <= count; n += 8) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), _mm256_cvtps_ph(_mm256_loadu_ps(in + n), _MM_FROUND_TO_NEAREST_INT));
+            }
+#elif defined(LAML_SIMD_SSE)
+            for (; n + 8 <= count; n += 8) {
+                const __m128i r = detail::pack_low16(detail::float_to_half(_mm_loadu_ps(in + n)), detail::float_to_half(_mm_loadu_ps(in + n + 4)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), r);
+            }
+#endif
+            for (; n < count; n++) {
+                out[n].bits = detail::float_to_half(in[n]);
+            }
+        }
+        inline void decode(const half* in, float* out, size_t count) {
+            size_t n = 0;
+#if defined(__F16C__) && !defined(LAML_NO_SIMD)
+            for (; n + 8 <= count; n += 8) {
+                _mm256_storeu_ps(out + n, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + n))));
+            }
+#elif defined(LAML_SIMD_SSE)
+            for (; n + 8 <= count; n += 8) {
+                const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + n));
+                _mm_storeu_ps(out + n, detail::half_to_float(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+                _mm_storeu_ps(out + n + 4, detail::half_to_float(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+            }
+#endif
+            for (; n < count; n++) {
+                out[n] = detail::half_to_float(in[n].bits);
+            }
+        }
+
+        // Vectors as flat arrays of floats, one packed value per component
+        template<size_t N>
+        void encode(const Vector<float, N>* in, PackedVector<half, N>* out, size_t count) {
+            static_assert(sizeof(Vector<float, N>) == N * sizeof(float), "Vector<float,N> has no padding");
+            encode(in ? in[0]._data : nullptr, out ? out[0]._data : nullptr, N * count);
+        }
+        template<size_t N>
+        void decode(const PackedVector<half, N>* in, Vector<float, N>* out, size_t count) {
+            decode(in ? in[0]._data : nullptr, out ? out[0]._data : nullptr, N * count);
+        }
+
+        template<size_t N>
+        void encode(const Vector<float, N>* in, PackedVector<int16, N>* out, size_t count) {
+            static_assert(sizeof(Vector<float, N>) == N * sizeof(float), "Vector<float,N> has no padding");
+            typedef simd::packet<float> P;
+            detail::encode_flat(in ? in[0]._data : nullptr, out ? out[0]._data : nullptr, N * count,
+                [](const P* v, P* r) { r[0] = detail::snorm16_scaled(v[0]); });
+        }
+        template<size_t N>
+        void decode(const PackedVector<int16, N>* in, Vector<float, N>* out, size_t count) {
+            const int16* src = in ? in[0]._data : nullptr;
+            float* dst = out ? out[0]._data : nullptr;
+            for (size_t n = 0; n < N * count; n++) {
+                dst[n] = detail::from_snorm16(src[n]);
+            }
+        }
+
+        template<size_t N>
+        void encode(const Vector<float, N>* in, PackedVector<uint8, N>* out, size_t count) {
+            static_assert(sizeof(Vector<float, N>) == N * sizeof(float), "Vector<float,N> has no padding");
+            typedef simd::packet<float> P;
+            detail::encode_flat(in ? in[0]._data : nullptr, out ? out[0]._data : nullptr, N * count,
+                [](const P* v, P* r) { r[0] = detail::unorm8_scaled(v[0]); });
+        }
+        template<size_t N>
+        void decode(const PackedVector<uint8, N>* in, Vector<float, N>* out, size_t count) {
+            const uint8* src = in ? in[0]._data : nullptr;
+            float* dst = out ? out[0]._data : nullptr;
+            for (size_t n = 0; n < N * count; n++) {
+                dst[n] = detail::from_unorm8(src[n]);
+            }
+        }
+
+        // Unit vectors, simd::packet<float>::width at a time
+        inline void encode(const Vector<float, 3>* in, Vec3_oct* out, size_t count) {
+            typedef simd::packet<float> P;
+            const soa::ConstVectorView<float, 3> src = soa::view(in, count);
+            // x, y interleaved like the output
+            alignas(simd::alignment) float xy[2 * detail::tile_size];
+            for (size_t base = 0; base < count; base += detail::tile_size) {
+                const size_t tile = (count - base < detail::tile_size) ? (count - base) : detail::tile_size;
+                const soa::ConstVectorView<float, 3> part = src.slice(base, tile);
+                const float* lanes[3] = { part.lane(0), part.lane(1), part.lane(2) };
+                const size_t strides[3] = { part.stride(), part.stride(), part.stride() };
+                float* res[2] = { xy, xy + 1 };
+                const size_t res_strides[2] = { 2, 2 };
+                soa::detail::for_each_packet(tile, lanes, strides, res, res_strides,
+                    [](const P* v, P* r) {
+                        const P one = detail::k<P>(1.0f);
+                        const P inv_l1 = one / (simd::abs(v[0]) + simd::abs(v[1]) + simd::abs(v[2]));
+                        const P x = v[0] * inv_l1, y = v[1] * inv_l1;
+                        // the lower half folds over the diagonals onto the corners
+                        const auto lower = v[2] < detail::k<P>(0.0f);
+                        r[0] = detail::snorm16_scaled(simd::select(lower, (one - simd::abs(y)) * detail::sign_not_zero(x), x));
+                        r[1] = detail::snorm16_scaled(simd::select(lower, (one - simd::abs(x)) * detail::sign_not_zero(y), y));
+                    });
+                detail::store_16(xy, out[base]._data, 2 * tile);
+            }
+        }
+        // Decoded vectors are renormalized
+        inline void decode(const Vec3_oct* in, Vector<float, 3>* out, size_t count) {
+            typedef simd::packet<float> P;
+            soa::VectorView<float, 3> dst = soa::view(out, count);
+            alignas(simd::alignment) float xy[2 * detail::tile_size];
+            for (size_t base = 0; base < count; base += detail::tile_size) {
+                const size_t tile = (count - base < detail::tile_size) ? (count - base) : detail::tile_size;
+                const int16* src = in[base]._data;
+                for (size_t i = 0; i < 2 * tile; i++) {
+                    xy[i] = detail::from_snorm16(src[i]);
+                }
+                soa::VectorView<float, 3> part = dst.slice(base, tile);
+                const float* lanes[2] = { xy, xy + 1 };
+                const size_t strides[2] = { 2, 2 };
+                float* res[3] = { part.lane(0), part.lane(1), part.lane(2) };
+                const size_t res_strides[3] = { part.stride(), part.stride(), part.stride() };
+                soa::detail::for_each_packet(tile, lanes, strides, res, res_strides,
+                    [](const P* v, P* r) {
+                        const P zero = detail::k<P>(0.0f);
+                        const P z = detail::k<P>(1.0f) - simd::abs(v[0]) - simd::abs(v[1]);
+                        // unfold the lower half: move x and y back towards the axes by how far z is below 0
+                        const P t = simd::max(-z, zero);
+                        const P x = v[0] + simd::select(v[0] < zero, t, -t);
+                        const P y = v[1] + simd::select(v[1] < zero, t, -t);
+                        const P inv_len = detail::k<P>(1.0f) / simd::sqrt(x * x + y * y + z * z);
+                        r[0] = x * inv_len;
+                        r[1] = y * inv_len;
+                        r[2] = z * inv_len;
+                    });
+            }
+        }
+
+        // Unit quaternions; picking and rebuilding the largest component is done simd::packet<float>::width at a time
+        inline void encode(const Quaternion<float>* in, Quat_smallest3* out, size_t count) {
+            typedef simd::packet<float> P;
+            const soa::ConstVectorView<float, 4> src = soa::view(in, count);
+            // the three stored values as whole numbers, interleaved like the output
+            alignas(simd::alignment) float abc[3 * detail::tile_size];
+            for (size_t base = 0; base < count; base += detail::tile_size) {
+                const size_t tile = (count - base < detail::tile_size) ? (count - base) : detail::tile_size;
+                const soa::ConstVectorView<float, 4> part = src.slice(base, tile);
+                const float* lanes[4] = { part.lane(0), part.lane(1), part.lane(2), part.lane(3) };
+                const size_t strides[4] = { part.stride(), part.stride(), part.stride(), part.stride() };
+                float* res[3] = { abc, abc + 1, abc + 2 };
+                const size_t res_strides[3] = { 3, 3, 3 };
+                soa::detail::for_each_packet(tile, lanes, strides, res, res_strides,
+                    [](const P* v, P* r) {
+                        // the first largest magnitude wins ties
+                        P m = simd::abs(v[0]);
+                        P idx = detail::k<P>(0.0f);
+                        for (size_t c = 1; c < 4; c++) {
+                            const P a = simd::abs(v[c]);
+                            const auto larger = a > m;
+                            m = simd::select(larger, a, m);
+                            idx = simd::select(larger, detail::k<P>(static_cast<float>(c)), idx);
+                        }
+                        const auto at0 = idx < detail::k<P>(0.5f);
+                        const auto at1 = idx < detail::k<P>(1.5f);
+                        const auto at2 = idx < detail::k<P>(2.5f);
+                        const P largest = simd::select(at0, v[0], simd::select(at1, v[1], simd::select(at2, v[2], v[3])));
+                        // [-1/sqrt(2), 1/sqrt(2)] to [0.5, 32767.5] (truncated later), with the sign that makes largest positive
+                        const P scale = detail::sign_not_zero(largest) * detail::k<P>(32767.0f * 0.70710678f);
+                        const P mid = detail::k<P>(32767.0f * 0.5f + 0.5f);
+                        const P zero = detail::k<P>(0.0f), top = detail::k<P>(32767.0f);
+                        const P a = detail::clamp(simd::select(at0, v[1], v[0]) * scale + mid, zero, top);
+                        const P b = detail::clamp(simd::select(at1, v[2], v[1]) * scale + mid, zero, top);
+                        const P c = detail::clamp(simd::select(at2, v[3], v[2]) * scale + mid, zero, top);
+                        // the index goes in bit 15: 1 and 3 in the first value, 2 and 3 in the second
+                        const P bit15 = detail::k<P>(32768.0f);
+                        const auto odd = ((idx > detail::k<P>(0.5f)) & at1) | (idx > detail::k<P>(2.5f));
+                        r[0] = a + simd::select(odd, bit15, zero);
+                        r[1] = b + simd::select(at1, zero, bit15);
+                        r[2] = c;
+                    });
+                detail::store_16(abc, out[base]._data, 3 * tile);
+            }
+        }
+        inline void decode(const Quat_smallest3* in, Quaternion<float>* out, size_t count) {
+            typedef simd::packet<float> P;
+            soa::VectorView<float, 4> dst = soa::view(out, count);
+            alignas(simd::alignment) float abc[3 * detail::tile_size];
+            for (size_t base = 0; base < count; base += detail::tile_size) {
+                const size_t tile = (count - base < detail::tile_size) ? (count - base) : detail::tile_size;
+                const uint16* src = in[base]._data;
+                for (size_t i = 0; i < 3 * tile; i++) {
+                    abc[i] = static_cast<float>(src[i]);
+                }
+                soa::VectorView<float, 4> part = dst.slice(base, tile);
+                const float* lanes[3] = { abc, abc + 1, abc + 2 };
+                const size_t strides[3] = { 3, 3, 3 };
+                float* res[4] = { part.lane(0), part.lane(1), part.lane(2), part.lane(3) };
+                const size_t res_strides[4] = { part.stride(), part.stride(), part.stride(), part.stride() };
+                soa::detail::for_each_packet(tile, lanes, strides, res, res_strides,
+                    [](const P* v, P* r) {
+                        const P zero = detail::k<P>(0.0f), bit15 = detail::k<P>(32768.0f);
+                        const auto lo = v[0] >= bit15;
+                        const auto hi = v[1] >= bit15;
+                        const P idx = simd::select(lo, detail::k<P>(1.0f), zero) + simd::select(hi, detail::k<P>(2.0f), zero);
+                        const P scale = detail::k<P>(1.41421356f / 32767.0f);
+                        const P mid = detail::k<P>(32767.0f * 0.5f);
+                        const P a = (simd::select(lo, v[0] - bit15, v[0]) - mid) * scale;
+                        const P b = (simd::select(hi, v[1] - bit15, v[1]) - mid) * scale;
+                        const P c = (v[2] - mid) * scale;
+                        const P largest = simd::sqrt(simd::max(detail::k<P>(1.0f) - a * a - b * b - c * c, zero));
+                        const auto at0 = idx < detail::k<P>(0.5f);
+                        const auto at1 = idx < detail::k<P>(1.5f);
+                        const auto at2 = idx < detail::k<P>(2.5f);
+                        r[0] = simd::select(at0, largest, a);
+                        r[1] = simd::select(at0, a, simd::select(at1, largest, b));
+                        r[2] = simd::select(at1, b, simd::select(at2, largest, c));
+                        r[3] = simd::select(at2, c, largest);
+                    });
+            }
+        }
+
+        // Useful shorthands
+        typedef PackedVector<half, 2> Vec2_half;
+        typedef PackedVector<half, 3> Vec3_half;
+        typedef PackedVector<half, 4> Vec4_half;
+        typedef PackedVector<int16, 2> Vec2_snorm16;
+        typedef PackedVector<int16, 3> Vec3_snorm16;
+        typedef PackedVector<int16, 4> Vec4_snorm16;
+        typedef PackedVector<uint8, 2> Vec2_unorm8;
+        typedef PackedVector<uint8, 3> Vec3_unorm8;
+        typedef PackedVector<uint8, 4> Vec4_unorm8;
+    }
+}
+
+#endif // __LAML_PACKED_H
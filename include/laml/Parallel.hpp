@@ -0,0 +1,350 @@
+#ifndef __LAML_PARALLEL_H
+#define __LAML_PARALLEL_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace laml {
+    /* Multi-threaded versions of the batch kernels.
+    * Work is split into contiguous chunks and run on a lazily created, process-wide work-stealing thread pool.
+    * Batches smaller than min_chunk elements are not worth waking threads for and run inline.
+    * The pool runs on std::thread, so code including this header links the platform thread library
+    * (in CMake, find_package(Threads) and Threads::Threads); the rest of laml does not need it.
+    * */
+    namespace parallel {
+
+        /* Each thread that takes part in a run() starts on its own contiguous block of task indices and works through
+        * it front to back. A thread that runs out steals the back half of another thread's remaining block, so uneven
+        * tasks balance out without a shared counter every thread contends on.
+        *
+        * The starting blocks only depend on the task count and concurrency(), so repeated runs over the same data hand
+        * the same ranges to the same threads: memory a worker first touched (and, on NUMA machines, had placed on its
+        * own node) keeps going to that worker. Threads are not pinned, that is left to the OS.
+        * */
+        class ThreadPool {
+        public:
+            // num_threads == 0 starts one worker per hardware thread, minus the calling thread
+            explicit ThreadPool(size_t num_threads = 0) {
+                if (num_threads == 0) {
+                    const size_t hw = std::thread::hardware_concurrency();
+                    num_threads = hw > 1 ? hw - 1 : 0;
+                }
+                _slots.reset(new Slot[num_threads + 1]);
+                _limit = num_threads + 1;
+                for (size_t n = 0; n < num_threads; n++) {
+                    _workers.emplace_back([this, n]() { worker_loop(n + 1); });
+                }
+            }
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stop = true;
+                }
+                _wake.notify_all();
+                for (std::thread& worker : _workers) {
+                    worker.join();
+                }
+            }
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            // number of threads that execute tasks, including the caller of run()
+            size_t concurrency() const { return _limit.load(); }
+            size_t max_concurrency() const { return _workers.size() + 1; }
+
+            // Limits run() to the first num_threads threads (the caller included), e.g. to measure scaling.
+            // 0 or anything above max_concurrency() uses them all again.
+            void set_concurrency(size_t num_threads) {
+                _limit = (num_threads == 0 || num_threads > max_concurrency()) ? max_concurrency() : num_threads;
+            }
+
+            // Runs task(i) for every i in [0, num_tasks) and returns once all of them are done.
+            // The calling thread takes tasks as well. Calls made from inside a task run serially.
+            template<typename F>
+            void run(size_t num_tasks, F&& task) {
+                const size_t threads = concurrency();
+                if (num_tasks <= 1 || threads == 1 || in_worker()) {
+                    for (size_t i = 0; i < num_tasks; i++) {
+                        task(i);
+                    }
+                    return;
+                }
+                std::lock_guard<std::mutex> run_lock(_run_mutex); // one job in flight at a time
+                // task ranges are packed into 32 bits, so larger counts go in several jobs
+                for (size_t first = 0; first < num_tasks; first += max_tasks) {
+                    const size_t count = (num_tasks - first < max_tasks) ? num_tasks - first : max_tasks;
+                    run_job(count, threads, [&task, first](size_t i) { task(first + i); });
+                }
+            }
+
+            static ThreadPool& global() {
+                static ThreadPool pool;
+                return pool;
+            }
+
+        private:
+            static constexpr size_t max_tasks = 0xffffffff;
+
+            // [begin, end) of the tasks a thread has left, begin in the low half. On its own cache line.
+            struct alignas(64) Slot {
+                std::atomic<uint64_t> range{ 0 };
+            };
+
+            struct Job {
+                std::function<void(size_t)> fn;
+                size_t count = 0;
+                Slot* slots = nullptr;
+                size_t num_slots = 0;  // threads taking part, the caller is slot 0
+                std::atomic<size_t> done{ 0 };
+                size_t active = 0; // workers currently holding this job, guarded by _mutex
+            };
+
+            static uint64_t pack(size_t begin, size_t end) {
+                return static_cast<uint64_t>(begin) | (static_cast<uint64_t>(end) << 32);
+            }
+
+            // next task from the front of our own block
+            static bool pop(Slot& slot, size_t& task) {
+                uint64_t range = slot.range.load();
+                for (;;) {
+                    const size_t begin = static_cast<size_t>(range & max_tasks), end = static_cast<size_t>(range >> 32);
+                    if (begin >= end) {
+                        return false;
+                    }
+                    if (slot.range.compare_exchange_weak(range, pack(begin + 1, end))) {
+                        task = begin;
+                        return true;
+                    }
+                }
+            }
+
+            // Takes the back half of the first non-empty block after ours: its first task is returned, the rest
+            // become our block. Nobody else writes to an empty slot, so storing into ours needs no CAS.
+            static bool steal(Job& job, size_t self, size_t& task) {
+                for (size_t k = 1; k < job.num_slots; k++) {
+                    Slot& victim = job.slots[(self + k) % job.num_slots];
+                    uint64_t range = victim.range.load();
+                    for (;;) {
+                        const size_t begin = static_cast<size_t>(range & max_tasks), end = static_cast<size_t>(range >> 32);
+                        if (begin >= end) {
+                            break;
+                        }
+                        const size_t mid = begin + (end - begin) / 2;
+                        if (victim.range.compare_exchange_weak(range, pack(begin, mid))) {
+                            task = mid;
+                            job.slots[self].range = pack(mid + 1, end);
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            void run_job(size_t num_tasks, size_t threads, std::function<void(size_t)> fn) {
+                Job job;
+                job.fn = std::move(fn);
+                job.count = num_tasks;
+                job.slots = _slots.get();
+                job.num_slots = num_tasks < threads ? num_tasks : threads;
+                for (size_t s = 0; s < job.num_slots; s++) {
+                    job.slots[s].range = pack(num_tasks * s / job.num_slots, num_tasks * (s + 1) / job.num_slots);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _job = &job;
+                    _generation++;
+                }
+                _wake.notify_all();
+
+                // the caller's own tasks count as pool tasks, so nested run() calls from them stay serial
+                in_worker() = true;
+                execute(job, 0);
+                in_worker() = false;
+
+                std::unique_lock<std::mutex> lock(_mutex);
+                _finished.wait(lock, [&job]() { return job.done.load() == job.count && job.active == 0; });
+                _job = nullptr;
+            }
+
+            // true while the current thread is executing pool tasks
+            static bool& in_worker() {
+                thread_local bool flag = false;
+                return flag;
+            }
+
+            static void execute(Job& job, size_t self) {
+                size_t task;
+                while (pop(job.slots[self], task) || steal(job, self, task)) {
+                    job.fn(task);
+                    job.done.fetch_add(1);
+                }
+            }
+
+            void worker_loop(size_t self) {
+                in_worker() = true;
+                size_t seen = 0;
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (;;) {
+                    _wake.wait(lock, [&]() { return _stop || (_job && _generation != seen); });
+                    if (_stop) {
+                        return;
+                    }
+                    seen = _generation;
+                    Job* job = _job;
+                    if (self >= job->num_slots) {
+                        continue; // not taking part in this one
+                    }
+                    job->active++;
+                    lock.unlock();
+
+                    execute(*job, self);
+
+                    lock.lock();
+                    if (--job->active == 0) {
+                        _finished.notify_all();
+                    }
+                }
+            }
+
+            std::vector<std::thread> _workers;
+            std::unique_ptr<Slot[]> _slots;
+            std::atomic<size_t> _limit{ 1 };
+            std::mutex _run_mutex;
+            std::mutex _mutex;
+            std::condition_variable _wake;
+            std::condition_variable _finished;
+            Job* _job = nullptr;
+            size_t _generation = 0;
+            bool _stop = false;
+        };
+
+        // Chunks per thread when a range is split: a few more than one, so stealing can even out uneven chunks
+        constexpr size_t chunks_per_thread = 4;
+
+        // Splits [0, count) into contiguous chunks of at least min_chunk elements, at most chunks_per_thread per thread,
+        // and calls fn(begin, end) for every chunk.
+        template<typename F>
+        void for_range(size_t count, size_t min_chunk, F&& fn) {
+            ThreadPool& pool = ThreadPool::global();
+            const size_t threads = pool.concurrency();
+            size_t chunks = count / (min_chunk ? min_chunk : 1);
+            if (chunks > threads * chunks_per_thread) {
+                chunks = threads * chunks_per_thread;
+            }
+            if (chunks <= 1 || threads == 1) {
+                fn(static_cast<size_t>(0), count);
+                return;
+            }
+            pool.run(chunks, [&](size_t i) {
+                fn(count * i / chunks, count * (i + 1) / chunks);
+            });
+        }
+
+        // Default chunk sizes, picked so each chunk costs far more than a thread wake-up
+        constexpr size_t transform_points_chunk = 16384;
+        constexpr size_t mul_chunk = 8192;
+        constexpr size_t normalize_chunk = 16384;
+        constexpr size_t quat_from_mat_chunk = 8192;
+        constexpr size_t decompose_chunk = 2048;
+
+        template<typename T>
+        void transform_points(const Matrix<T, 4, 4>& mat, const soa::ConstVectorView<T, 3>& in, soa::VectorView<T, 3> out, T w,
+                              bool perspective_divide = false, size_t min_chunk = transform_points_chunk) {
+            for_range(out.size(), min_chunk, [&](size_t begin, size_t end) {
+                transform::transform_points(mat, in.slice(begin, end - begin), out.slice(begin, end - begin), w, perspective_divide);
+            });
+        }
+        template<typename T>
+        void transform_points(const Matrix<T, 4, 4>& mat, const Vector<T, 3>* in, Vector<T, 3>* out, size_t count, T w,
+                              bool perspective_divide = false, size_t min_chunk = transform_points_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                transform::transform_points(mat, in + begin, out + begin, end - begin, w, perspective_divide);
+            });
+        }
+        template<typename T, size_t A>
+        void transform_points(const Matrix<T, 4, 4>& mat, const Aligned<Vector<T, 3>, A>* in, Aligned<Vector<T, 3>, A>* out, size_t count, T w,
+                              bool perspective_divide = false, size_t min_chunk = transform_points_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                transform::transform_points(mat, in + begin, out + begin, end - begin, w, perspective_divide);
+            });
+        }
+
+        // out[i] = a[i] * b[i]
+        template<typename T>
+        void mul(const Matrix<T, 4, 4>* a, const Matrix<T, 4, 4>* b, Matrix<T, 4, 4>* out, size_t count, size_t min_chunk = mul_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                for (size_t n = begin; n < end; n++) {
+                    out[n] = laml::mul(a[n], b[n]);
+                }
+            });
+        }
+        // out[i] = a * b[i], e.g. one parent transform applied to many locals
+        template<typename T>
+        void mul(const Matrix<T, 4, 4>& a, const Matrix<T, 4, 4>* b, Matrix<T, 4, 4>* out, size_t count, size_t min_chunk = mul_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                for (size_t n = begin; n < end; n++) {
+                    out[n] = laml::mul(a, b[n]);
+                }
+            });
+        }
+
+        template<typename T, size_t N>
+        void normalize(const soa::ConstVectorView<T, N>& in, soa::VectorView<T, N> out, size_t min_chunk = normalize_chunk) {
+            for_range(out.size(), min_chunk, [&](size_t begin, size_t end) {
+                soa::normalize(in.slice(begin, end - begin), out.slice(begin, end - begin));
+            });
+        }
+        template<typename T, size_t N>
+        void normalize(const Vector<T, N>* in, Vector<T, N>* out, size_t count, size_t min_chunk = normalize_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                for (size_t n = begin; n < end; n++) {
+                    out[n] = laml::normalize(in[n]);
+                }
+            });
+        }
+        template<typename T>
+        void normalize(const Quaternion<T>* in, Quaternion<T>* out, size_t count, size_t min_chunk = normalize_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                laml::normalize(in + begin, out + begin, end - begin);
+            });
+        }
+
+        template<typename T>
+        void quat_from_mat(const Matrix<T, 3, 3>* in, Quaternion<T>* out, size_t count, size_t min_chunk = quat_from_mat_chunk) {
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                for (size_t n = begin; n < end; n++) {
+                    out[n] = transform::quat_from_mat(in[n]);
+                }
+            });
+        }
+
+        // transform::decompose() on every matrix. Returns false if any of them could not be decomposed
+        // (outputs for those are left as they were).
+        template<typename T>
+        bool decompose(const Matrix<T, 4, 4>* in, Matrix<T, 3, 3>* rot_mat, Vector<T, 3>* trans_vec, Vector<T, 3>* scale_vec,
+                       size_t count, size_t min_chunk = decompose_chunk) {
+            std::atomic<bool> ok{ true };
+            for_range(count, min_chunk, [&](size_t begin, size_t end) {
+                bool chunk_ok = true;
+                for (size_t n = begin; n < end; n++) {
+                    chunk_ok &= transform::decompose(in[n], rot_mat[n], trans_vec[n], scale_vec[n]);
+                }
+                if (!chunk_ok) {
+                    ok = false;
+                }
+            });
+            return ok;
+        }
+    }
+}
+
+#endif // __LAML_PARALLEL_H
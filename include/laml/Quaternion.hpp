@@ -21,27 +21,28 @@ namespace laml {
 
         // Default constructor
         constexpr Quaternion() : _data{ 0, 0, 0, 1.0 } {}
-        constexpr Quaternion(const Quaternion<T>& other) : _data{ other.x, other.y, other.z, other.w } {}
+        constexpr Quaternion(const Quaternion<T>& other) : _data{ other[0], other[1], other[2], other[3] } {}
+        constexpr Quaternion<T>& operator=(const Quaternion<T>&) = default;
 
         template<typename T_other>
-        constexpr Quaternion(const Quaternion<T_other>& other) : _data {static_cast<T>(other.x), static_cast<T>(other.y), static_cast<T>(other.z), static_cast<T>(other.w)} {}
+        constexpr Quaternion(const Quaternion<T_other>& other) : _data {static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]), static_cast<T>(other[3])} {}
 
         // Construct with float array
-        Quaternion(const float* in_data) : _data{static_cast<T>(in_data[0]), static_cast<T>(in_data[1]), static_cast<T>(in_data[2]), static_cast<T>(in_data[3])} {}
+        constexpr Quaternion(const float* in_data) : _data{static_cast<T>(in_data[0]), static_cast<T>(in_data[1]), static_cast<T>(in_data[2]), static_cast<T>(in_data[3])} {}
 
         // Initialize with list of components
         constexpr Quaternion(T _x, T _y, T _z, T _w) noexcept : _data{ _x, _y, _z, _w } {}
 
         //// access like an array
-        T& operator[](size_t idx) {
+        constexpr T& operator[](size_t idx) {
             return _data[idx];
         }
-        const T& operator[](size_t idx) const {
+        constexpr const T& operator[](size_t idx) const {
             return _data[idx];
         }
 
-        const T* data() const { return _data; }
-        T* data() { return _data; }
+        constexpr const T* data() const { return _data; }
+        constexpr T* data() { return _data; }
     };
 
 #ifdef LAML_STD_INCLUDE
@@ -73,21 +74,21 @@ namespace laml {
         * these operations are strange for quaternions, only really use them to lerp/slerp
         * */
     template<typename T>
-    Quaternion<T> operator+(const Quaternion<T>& quat, const Quaternion<T>& other) {
+    constexpr Quaternion<T> operator+(const Quaternion<T>& quat, const Quaternion<T>& other) {
         return Quaternion<T>(
-            quat.x + other.x,
-            quat.y + other.y,
-            quat.z + other.z,
-            quat.w + other.w);
+            quat[0] + other[0],
+            quat[1] + other[1],
+            quat[2] + other[2],
+            quat[3] + other[3]);
     }
 
     template<typename T>
-    Quaternion<T> operator-(const Quaternion<T>& quat, const Quaternion<T>& other) {
+    constexpr Quaternion<T> operator-(const Quaternion<T>& quat, const Quaternion<T>& other) {
         return Quaternion<T>(
-            quat.x - other.x,
-            quat.y - other.y,
-            quat.z - other.z,
-            quat.w - other.w);
+            quat[0] - other[0],
+            quat[1] - other[1],
+            quat[2] - other[2],
+            quat[3] - other[3]);
     }
 
     /* Scaling operators
@@ -95,7 +96,7 @@ namespace laml {
         * These are all component-wise operations
         * */
     template<typename T>
-    Quaternion<T> operator*(const Quaternion<T>& quat, const T& factor) {
+    constexpr Quaternion<T> operator*(const Quaternion<T>& quat, const T& factor) {
         Quaternion<T> res;
         for (size_t n = 0; n < 4; n++) {
             res[n] = quat[n] * factor;
@@ -104,7 +105,7 @@ namespace laml {
     }
 
     template<typename T>
-    Quaternion<T> operator/(const Quaternion<T>& quat, const T& factor) {
+    constexpr Quaternion<T> operator/(const Quaternion<T>& quat, const T& factor) {
         Quaternion<T> res;
         for (size_t n = 0; n < 4; n++) {
             res[n] = quat[n] / factor;
@@ -112,7 +113,7 @@ namespace laml {
         return res;
     }
     template<typename T>
-    Quaternion<T> operator*(const T& factor, const Quaternion<T>& quat) {
+    constexpr Quaternion<T> operator*(const T& factor, const Quaternion<T>& quat) {
         Quaternion<T> res;
         for (size_t n = 0; n < 4; n++) {
             res[n] = quat[n] * factor;
@@ -121,7 +122,7 @@ namespace laml {
     }
 
     template<typename T>
-    Quaternion<T> operator/(const T& factor, const Quaternion<T>& quat) {
+    constexpr Quaternion<T> operator/(const T& factor, const Quaternion<T>& quat) {
         Quaternion<T> res;
         for (size_t n = 0; n < 4; n++) {
             res[n] = quat[n] / factor;
@@ -131,63 +132,156 @@ namespace laml {
 
     // Free functions
     template<typename T>
-    T dot(const Quaternion<T>& q1, const Quaternion<T>& q2) {
-        return (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z) + (q1.w * q2.w);
+    constexpr T dot(const Quaternion<T>& q1, const Quaternion<T>& q2) {
+        return (q1[0] * q2[0]) + (q1[1] * q2[1]) + (q1[2] * q2[2]) + (q1[3] * q2[3]);
     }
 
     template<typename T>
-    T length_sq(const Quaternion<T>& quat) {
-        return (quat.x * quat.x) + (quat.y * quat.y) + (quat.z * quat.z) + (quat.w * quat.w);
+    constexpr T length_sq(const Quaternion<T>& quat) {
+        return (quat[0] * quat[0]) + (quat[1] * quat[1]) + (quat[2] * quat[2]) + (quat[3] * quat[3]);
     }
 
     template<typename T>
-    T length(const Quaternion<T>& quat) {
-        return static_cast<T>(sqrt(length_sq(quat)));
+    constexpr T length(const Quaternion<T>& quat) {
+        return cx::sqrt(length_sq(quat));
     }
 
-    template<typename T>
-    Quaternion<T> normalize(const Quaternion<T>& quat) {
-        T mag = length(quat);
-        return (quat / mag);
+    template<typename T, typename Math = math::default_policy>
+    constexpr Quaternion<T> normalize(const Quaternion<T>& quat, Math = Math()) {
+        // one divide instead of four
+        T inv_mag = Math::rsqrt(length_sq(quat));
+        return (quat * inv_mag);
     }
 
     // Weird quaternion functions
     template<typename T>
-    Quaternion<T> inverse(const Quaternion<T>& quat) {
-        return Quaternion<T>(quat.x, quat.w, quat.z, quat.w);
+    constexpr Quaternion<T> inverse(const Quaternion<T>& quat) {
+        return Quaternion<T>(quat[0], quat[3], quat[2], quat[3]);
     }
 
     template<typename T>
-    Quaternion<T> mul(const Quaternion<T>& q1, const Quaternion<T>& q2) {
-        // Hamilton operator
+    constexpr Quaternion<T> conjugate(const Quaternion<T>& quat) {
+        return Quaternion<T>(-quat[0], -quat[1], -quat[2], quat[3]);
+    }
 
-        // really bad, but easy implementation that doe ssome vector math using Vector<T,3>s 
-        Vector<T, 3> v1(q1.x, q1.y, q1.z);
-        Vector<T, 3> v2(q2.x, q2.y, q2.z);
-        Vector<T, 3> v = v1*q2.w + v2*q1.w + laml::cross(v1, v2);
+    template<typename T>
+    constexpr Quaternion<T> mul(const Quaternion<T>& q1, const Quaternion<T>& q2) {
+        // Hamilton product, written out so it maps onto 4-wide SIMD:
+        // q2 * w1 plus three sign-flipped shuffles of q2 scaled by x1, y1, z1
+        return Quaternion<T>(
+            q1[3] * q2[0] + q1[0] * q2[3] + q1[1] * q2[2] - q1[2] * q2[1],
+            q1[3] * q2[1] - q1[0] * q2[2] + q1[1] * q2[3] + q1[2] * q2[0],
+            q1[3] * q2[2] + q1[0] * q2[1] - q1[1] * q2[0] + q1[2] * q2[3],
+            q1[3] * q2[3] - q1[0] * q2[0] - q1[1] * q2[1] - q1[2] * q2[2]);
+    }
 
-        return Quaternion<T>(v.x, v.y, v.z, q1.w * q2.w - laml::dot(v1, v2));
+#if defined(LAML_SIMD_SSE)
+    // same operation order as the generic version, so results are bit-identical
+    // the template above is used during constant evaluation
+    constexpr inline Quaternion<float> mul(const Quaternion<float>& q1, const Quaternion<float>& q2) {
+        if (LAML_IS_CONSTANT_EVALUATED()) {
+            return mul<float>(q1, q2);
+        }
+        const __m128 b = _mm_loadu_ps(q2._data);
+        const __m128 b_wzyx = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+        const __m128 b_zwxy = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f));
+        const __m128 b_yxwz = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+        __m128 r =     _mm_mul_ps(_mm_set1_ps(q1.w), b);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q1.x), b_wzyx));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q1.y), b_zwxy));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q1.z), b_yxwz));
+
+        Quaternion<float> res;
+        _mm_storeu_ps(res._data, r);
+        return res;
     }
+#endif
 
+    // Rotate a vector by a unit quaternion, without going through a matrix.
+    // v' = v + 2w(q x v) + 2q x (q x v), evaluated as t = 2(q x v), v' = v + w*t + q x t
     template<typename T>
-    Quaternion<T> lerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor) {
-        return q2 * factor + q1 * (static_cast<T>(1.0) - factor);
+    constexpr Vector<T, 3> rotate(const Quaternion<T>& quat, const Vector<T, 3>& vec) {
+        const T two = static_cast<T>(2.0);
+        const T tx = two * (quat[1] * vec[2] - quat[2] * vec[1]);
+        const T ty = two * (quat[2] * vec[0] - quat[0] * vec[2]);
+        const T tz = two * (quat[0] * vec[1] - quat[1] * vec[0]);
+        return Vector<T, 3>(
+            vec[0] + quat[3] * tx + (quat[1] * tz - quat[2] * ty),
+            vec[1] + quat[3] * ty + (quat[2] * tx - quat[0] * tz),
+            vec[2] + quat[3] * tz + (quat[0] * ty - quat[1] * tx));
+    }
+
+    // Batched versions over plain arrays; out may be the same array as an input.
+    // See soa::quat_mul/soa::rotate in laml/Soa.hpp for the SIMD versions over SoA data.
+    template<typename T>
+    void mul(const Quaternion<T>* q1, const Quaternion<T>* q2, Quaternion<T>* out, size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = mul(q1[n], q2[n]);
+        }
+    }
+    template<typename T>
+    void normalize(const Quaternion<T>* quats, Quaternion<T>* out, size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = normalize(quats[n]);
+        }
+    }
+    template<typename T>
+    void rotate(const Quaternion<T>* quats, const Vector<T, 3>* vecs, Vector<T, 3>* out, size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = rotate(quats[n], vecs[n]);
+        }
+    }
+    template<typename T>
+    void rotate(const Quaternion<T>& quat, const Vector<T, 3>* vecs, Vector<T, 3>* out, size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = rotate(quat, vecs[n]);
+        }
     }
 
     template<typename T>
-    Quaternion<T> slerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor) {
-        const T eps = 1e-4;
+    constexpr Quaternion<T> lerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor) {
+        return q2 * factor + q1 * (static_cast<T>(1.0) - factor);
+    }
+
+    template<typename T, typename Math = math::default_policy>
+    Quaternion<T> slerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor, Math = Math()) {
+        const T one = static_cast<T>(1.0);
+        const T eps = static_cast<T>(1e-4);
 
         T cos_omega = dot(q1,q2);
-        if (fabs(1.0 - cos_omega) < eps) {
+        if (fabs(one - cos_omega) < eps) {
             return q1;
         }
-        T omega = acos(laml::clamp(cos_omega, -1.0f, 1.0f));
-        T s_omega_inv = 1.0 / sin(omega);
-        Quaternion<T> q = (static_cast<float>(sin((1.0 - factor) * omega) * s_omega_inv) * q1) + (static_cast<float>(sin(factor * omega) * s_omega_inv) * q2);
+        T omega = static_cast<T>(Math::acos(laml::clamp(cos_omega, -one, one)));
+        T s_omega_inv = one / static_cast<T>(Math::sin(omega));
+        Quaternion<T> q = (static_cast<T>(Math::sin((one - factor) * omega) * s_omega_inv) * q1) + (static_cast<T>(Math::sin(factor * omega) * s_omega_inv) * q2);
         return q;
     }
 
+    // Normalized lerp along the shortest path (q and -q are the same rotation).
+    // Cheap, but the angular velocity is not constant: it is fastest at factor = 0.5.
+    template<typename T>
+    constexpr Quaternion<T> nlerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor) {
+        const T one = static_cast<T>(1.0);
+        const T t2 = dot(q1, q2) < static_cast<T>(0.0) ? -factor : factor;
+        return normalize(q1 * (one - factor) + q2 * t2);
+    }
+
+    /* Approximate slerp: nlerp with the factor re-timed by a polynomial fit in (factor, |cos omega|),
+    * which cancels nlerp's speed-up towards the middle of the arc.
+    * No trig; shortest path; the result stays within ~1e-3 radians of slerp for unit quaternions.
+    * */
+    template<typename T>
+    constexpr Quaternion<T> slerp_fast(const Quaternion<T>& q1, const Quaternion<T>& q2, T factor) {
+        const T half = static_cast<T>(0.5);
+        const T d = cx::abs(dot(q1, q2));
+        const T A = static_cast<T>(1.0904) + d * (static_cast<T>(-3.2452) + d * (static_cast<T>(3.55645) - d * static_cast<T>(1.43519)));
+        const T B = static_cast<T>(0.848013) + d * (static_cast<T>(-1.06021) + d * static_cast<T>(0.215638));
+        const T k = A * (factor - half) * (factor - half) + B;
+        const T t = factor + factor * (factor - half) * (factor - static_cast<T>(1.0)) * k;
+        return nlerp(q1, q2, t);
+    }
 
     // Useful shorthands
     typedef Quaternion<float> Quat;
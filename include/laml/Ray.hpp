@@ -0,0 +1,61 @@
+#ifndef __LAML_RAY_H
+#define __LAML_RAY_H
+
+#include <laml/laml.hpp>
+#include <laml/Bounds.hpp>
+
+namespace laml {
+    /* Ray with the per-ray terms of the slab test precomputed:
+    * the inverse direction and, per axis, whether the ray travels towards -inf (sign = 1).
+    * A zero direction component gives an infinite inverse, which the slab test handles.
+    * The direction does not have to be normalized; distances t are in units of its length.
+    * */
+    template<typename T>
+    struct Ray {
+        Vector<T, 3> origin;
+        Vector<T, 3> direction;
+        Vector<T, 3> inv_direction;
+        uint32 sign[3];
+
+        Ray() : Ray(Vector<T, 3>(), Vector<T, 3>(static_cast<T>(0.0), static_cast<T>(0.0), static_cast<T>(-1.0))) {}
+        Ray(const Vector<T, 3>& o, const Vector<T, 3>& d)
+            : origin(o), direction(d),
+              inv_direction(static_cast<T>(1.0) / d.x, static_cast<T>(1.0) / d.y, static_cast<T>(1.0) / d.z),
+              sign{ inv_direction.x < 0 ? 1u : 0u, inv_direction.y < 0 ? 1u : 0u, inv_direction.z < 0 ? 1u : 0u } {}
+    };
+
+    template<typename T>
+    Vector<T, 3> point_at(const Ray<T>& ray, T t) {
+        return ray.origin + ray.direction * t;
+    }
+
+    /* Slab test against a box for t in [0, t_max]; t_enter is where the ray enters the box
+    * (0 if the origin is inside). The sign bits pick the near and far distance of each slab.
+    * A ray lying in a slab plane computes 0 * inf = NaN for that axis; the comparisons ignore it.
+    * */
+    template<typename T>
+    bool intersects(const Ray<T>& ray, const Aabb<T>& box, T t_max, T& t_enter) {
+        T t0 = static_cast<T>(0.0), t1 = t_max;
+        for (size_t k = 0; k < 3; k++) {
+            // indexed rather than branched on: ray directions are random enough to defeat branch prediction
+            const T slab[2] = { (box.min[k] - ray.origin[k]) * ray.inv_direction[k], (box.max[k] - ray.origin[k]) * ray.inv_direction[k] };
+            const T tn = slab[ray.sign[k]];
+            const T tf = slab[1 - ray.sign[k]];
+            t0 = tn > t0 ? tn : t0;
+            t1 = tf < t1 ? tf : t1;
+        }
+        t_enter = t0;
+        return t0 <= t1;
+    }
+    template<typename T>
+    bool intersects(const Ray<T>& ray, const Aabb<T>& box, T t_max) {
+        T t_enter;
+        return intersects(ray, box, t_max, t_enter);
+    }
+
+    // Useful shorthands
+    typedef Ray<float> Ray3;
+    typedef Ray<double> Ray3_highp;
+}
+
+#endif // __LAML_RAY_H
@@ -0,0 +1,255 @@
+#ifndef __LAML_SIMD_H
+#define __LAML_SIMD_H
+
+/* Compile-time instruction set selection.
+* The widest set enabled by the compiler flags is picked (e.g. -mavx or /arch:AVX).
+* Define LAML_NO_SIMD to force every specialization back onto the portable scalar path.
+* */
+#if !defined(LAML_NO_SIMD)
+    #if defined(__AVX512F__)
+        #define LAML_SIMD_AVX512 1
+    #endif
+    #if defined(__AVX__)
+        #define LAML_SIMD_AVX 1
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define LAML_SIMD_SSE 1
+    #endif
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define LAML_SIMD_NEON 1
+    #endif
+#endif
+
+#if defined(LAML_SIMD_AVX) || defined(LAML_SIMD_AVX512)
+    #include <immintrin.h>
+#elif defined(LAML_SIMD_SSE)
+    #include <emmintrin.h>
+#elif defined(LAML_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+#include <laml/Data_types.hpp>
+#include <cstddef>
+#include <cmath>
+#include <utility>
+
+namespace laml {
+    namespace simd {
+
+        // Alignment used for batch storage - a full cache line, enough for any packet width
+        constexpr size_t alignment = 64;
+
+        /* Portable one-lane "packet".
+        * Used for every type without a native packet (double) and for float when SIMD is off,
+        * so batch kernels can be written once against the packet interface.
+        * */
+        template<typename T>
+        struct scalar_v {
+            static constexpr size_t width = 1;
+            T v;
+        };
+
+        template<typename T> inline scalar_v<T> loadu(const T* p) { return { *p }; }
+        template<typename T> inline void storeu(T* p, scalar_v<T> a) { *p = a.v; }
+        template<typename T> inline scalar_v<T> set1(T s) { return { s }; }
+
+        template<typename T> inline scalar_v<T> operator+(scalar_v<T> a, scalar_v<T> b) { return { a.v + b.v }; }
+        template<typename T> inline scalar_v<T> operator-(scalar_v<T> a, scalar_v<T> b) { return { a.v - b.v }; }
+        template<typename T> inline scalar_v<T> operator*(scalar_v<T> a, scalar_v<T> b) { return { a.v * b.v }; }
+        template<typename T> inline scalar_v<T> operator/(scalar_v<T> a, scalar_v<T> b) { return { a.v / b.v }; }
+        template<typename T> inline scalar_v<T> operator-(scalar_v<T> a) { return { -a.v }; }
+        template<typename T> inline scalar_v<T> min(scalar_v<T> a, scalar_v<T> b) { return { a.v < b.v ? a.v : b.v }; }
+        template<typename T> inline scalar_v<T> max(scalar_v<T> a, scalar_v<T> b) { return { a.v > b.v ? a.v : b.v }; }
+        template<typename T> inline scalar_v<T> sqrt(scalar_v<T> a) { return { std::sqrt(a.v) }; }
+        template<typename T> inline scalar_v<T> abs(scalar_v<T> a) { return { a.v < 0 ? -a.v : a.v }; }
+        // 1/sqrt(a), exact here; the native packets give a hardware estimate good to about 12 bits
+        template<typename T> inline scalar_v<T> rsqrt(scalar_v<T> a) { return { static_cast<T>(1.0) / std::sqrt(a.v) }; }
+        // a * 2^n for integral n in [-126, 127]
+        template<typename T> inline scalar_v<T> ldexp(scalar_v<T> a, scalar_v<T> n) { return { std::ldexp(a.v, static_cast<int>(n.v)) }; }
+
+        // comparisons give a plain bool as the one-lane mask
+        template<typename T> inline bool operator<(scalar_v<T> a, scalar_v<T> b) { return a.v < b.v; }
+        template<typename T> inline bool operator<=(scalar_v<T> a, scalar_v<T> b) { return a.v <= b.v; }
+        template<typename T> inline bool operator>(scalar_v<T> a, scalar_v<T> b) { return a.v > b.v; }
+        template<typename T> inline bool operator>=(scalar_v<T> a, scalar_v<T> b) { return a.v >= b.v; }
+        template<typename T> inline scalar_v<T> select(bool m, scalar_v<T> a, scalar_v<T> b) { return m ? a : b; }
+        inline uint32 bits(bool m) { return m ? 1u : 0u; }
+
+        /* Native float packet.
+        * width is 16/8/4 for AVX-512/AVX/SSE+NEON. Masks come from the comparison operators,
+        * combine with & and |, and feed select(mask, a, b) (= mask ? a : b) or bits() (one bit per lane).
+        * */
+#if defined(LAML_SIMD_AVX512)
+        struct vfloat { static constexpr size_t width = 16; __m512 v; };
+        struct vmask  { __mmask16 m; };
+
+        inline vfloat loadu(const float* p) { return { _mm512_loadu_ps(p) }; }
+        inline void storeu(float* p, vfloat a) { _mm512_storeu_ps(p, a.v); }
+        inline vfloat set1(float s) { return { _mm512_set1_ps(s) }; }
+
+        inline vfloat operator+(vfloat a, vfloat b) { return { _mm512_add_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a, vfloat b) { return { _mm512_sub_ps(a.v, b.v) }; }
+        inline vfloat operator*(vfloat a, vfloat b) { return { _mm512_mul_ps(a.v, b.v) }; }
+        inline vfloat operator/(vfloat a, vfloat b) { return { _mm512_div_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a) { return a * set1(-1.0f); }
+        inline vfloat min(vfloat a, vfloat b) { return { _mm512_min_ps(a.v, b.v) }; }
+        inline vfloat max(vfloat a, vfloat b) { return { _mm512_max_ps(a.v, b.v) }; }
+        inline vfloat sqrt(vfloat a) { return { _mm512_sqrt_ps(a.v) }; }
+        inline vfloat abs(vfloat a) { return max(a, -a); }
+        inline vfloat rsqrt(vfloat a) { return { _mm512_rsqrt14_ps(a.v) }; }
+        inline vfloat ldexp(vfloat a, vfloat n) { return { _mm512_scalef_ps(a.v, n.v) }; }
+
+        inline vmask operator<(vfloat a, vfloat b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ) }; }
+        inline vmask operator<=(vfloat a, vfloat b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ) }; }
+        inline vmask operator>(vfloat a, vfloat b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ) }; }
+        inline vmask operator>=(vfloat a, vfloat b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ) }; }
+        inline vmask operator&(vmask a, vmask b) { return { static_cast<__mmask16>(a.m & b.m) }; }
+        inline vmask operator|(vmask a, vmask b) { return { static_cast<__mmask16>(a.m | b.m) }; }
+        inline vfloat select(vmask m, vfloat a, vfloat b) { return { _mm512_mask_blend_ps(m.m, b.v, a.v) }; }
+        inline uint32 bits(vmask m) { return static_cast<uint32>(m.m); }
+#elif defined(LAML_SIMD_AVX)
+        struct vfloat { static constexpr size_t width = 8; __m256 v; };
+        struct vmask  { __m256 m; };
+
+        inline vfloat loadu(const float* p) { return { _mm256_loadu_ps(p) }; }
+        inline void storeu(float* p, vfloat a) { _mm256_storeu_ps(p, a.v); }
+        inline vfloat set1(float s) { return { _mm256_set1_ps(s) }; }
+
+        inline vfloat operator+(vfloat a, vfloat b) { return { _mm256_add_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a, vfloat b) { return { _mm256_sub_ps(a.v, b.v) }; }
+        inline vfloat operator*(vfloat a, vfloat b) { return { _mm256_mul_ps(a.v, b.v) }; }
+        inline vfloat operator/(vfloat a, vfloat b) { return { _mm256_div_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a) { return a * set1(-1.0f); }
+        inline vfloat min(vfloat a, vfloat b) { return { _mm256_min_ps(a.v, b.v) }; }
+        inline vfloat max(vfloat a, vfloat b) { return { _mm256_max_ps(a.v, b.v) }; }
+        inline vfloat sqrt(vfloat a) { return { _mm256_sqrt_ps(a.v) }; }
+        inline vfloat abs(vfloat a) { return max(a, -a); }
+        inline vfloat rsqrt(vfloat a) { return { _mm256_rsqrt_ps(a.v) }; }
+        // the exponent goes straight into the float bits; without AVX2 the integer math is done in two halves
+        inline vfloat ldexp(vfloat a, vfloat n) {
+#if defined(__AVX2__)
+            const __m256i e = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127)), 23);
+#else
+            const __m256i i = _mm256_cvtps_epi32(n.v);
+            const __m128i bias = _mm_set1_epi32(127);
+            const __m128i lo = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(i), bias), 23);
+            const __m128i hi = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(i, 1), bias), 23);
+            const __m256i e = _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+#endif
+            return { _mm256_mul_ps(a.v, _mm256_castsi256_ps(e)) };
+        }
+
+        inline vmask operator<(vfloat a, vfloat b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+        inline vmask operator<=(vfloat a, vfloat b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+        inline vmask operator>(vfloat a, vfloat b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+        inline vmask operator>=(vfloat a, vfloat b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+        inline vmask operator&(vmask a, vmask b) { return { _mm256_and_ps(a.m, b.m) }; }
+        inline vmask operator|(vmask a, vmask b) { return { _mm256_or_ps(a.m, b.m) }; }
+        inline vfloat select(vmask m, vfloat a, vfloat b) { return { _mm256_blendv_ps(b.v, a.v, m.m) }; }
+        inline uint32 bits(vmask m) { return static_cast<uint32>(_mm256_movemask_ps(m.m)); }
+#elif defined(LAML_SIMD_SSE)
+        struct vfloat { static constexpr size_t width = 4; __m128 v; };
+        struct vmask  { __m128 m; };
+
+        inline vfloat loadu(const float* p) { return { _mm_loadu_ps(p) }; }
+        inline void storeu(float* p, vfloat a) { _mm_storeu_ps(p, a.v); }
+        inline vfloat set1(float s) { return { _mm_set1_ps(s) }; }
+
+        inline vfloat operator+(vfloat a, vfloat b) { return { _mm_add_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a, vfloat b) { return { _mm_sub_ps(a.v, b.v) }; }
+        inline vfloat operator*(vfloat a, vfloat b) { return { _mm_mul_ps(a.v, b.v) }; }
+        inline vfloat operator/(vfloat a, vfloat b) { return { _mm_div_ps(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a) { return a * set1(-1.0f); }
+        inline vfloat min(vfloat a, vfloat b) { return { _mm_min_ps(a.v, b.v) }; }
+        inline vfloat max(vfloat a, vfloat b) { return { _mm_max_ps(a.v, b.v) }; }
+        inline vfloat sqrt(vfloat a) { return { _mm_sqrt_ps(a.v) }; }
+        inline vfloat abs(vfloat a) { return max(a, -a); }
+        inline vfloat rsqrt(vfloat a) { return { _mm_rsqrt_ps(a.v) }; }
+        inline vfloat ldexp(vfloat a, vfloat n) {
+            const __m128i e = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127)), 23);
+            return { _mm_mul_ps(a.v, _mm_castsi128_ps(e)) };
+        }
+
+        inline vmask operator<(vfloat a, vfloat b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+        inline vmask operator<=(vfloat a, vfloat b) { return { _mm_cmple_ps(a.v, b.v) }; }
+        inline vmask operator>(vfloat a, vfloat b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+        inline vmask operator>=(vfloat a, vfloat b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+        inline vmask operator&(vmask a, vmask b) { return { _mm_and_ps(a.m, b.m) }; }
+        inline vmask operator|(vmask a, vmask b) { return { _mm_or_ps(a.m, b.m) }; }
+        // SSE2 has no blendv
+        inline vfloat select(vmask m, vfloat a, vfloat b) { return { _mm_or_ps(_mm_and_ps(m.m, a.v), _mm_andnot_ps(m.m, b.v)) }; }
+        inline uint32 bits(vmask m) { return static_cast<uint32>(_mm_movemask_ps(m.m)); }
+#elif defined(LAML_SIMD_NEON) && defined(__aarch64__)
+        struct vfloat { static constexpr size_t width = 4; float32x4_t v; };
+        struct vmask  { uint32x4_t m; };
+
+        inline vfloat loadu(const float* p) { return { vld1q_f32(p) }; }
+        inline void storeu(float* p, vfloat a) { vst1q_f32(p, a.v); }
+        inline vfloat set1(float s) { return { vdupq_n_f32(s) }; }
+
+        inline vfloat operator+(vfloat a, vfloat b) { return { vaddq_f32(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a, vfloat b) { return { vsubq_f32(a.v, b.v) }; }
+        inline vfloat operator*(vfloat a, vfloat b) { return { vmulq_f32(a.v, b.v) }; }
+        inline vfloat operator/(vfloat a, vfloat b) { return { vdivq_f32(a.v, b.v) }; }
+        inline vfloat operator-(vfloat a) { return a * set1(-1.0f); }
+        inline vfloat min(vfloat a, vfloat b) { return { vminq_f32(a.v, b.v) }; }
+        inline vfloat max(vfloat a, vfloat b) { return { vmaxq_f32(a.v, b.v) }; }
+        inline vfloat sqrt(vfloat a) { return { vsqrtq_f32(a.v) }; }
+        inline vfloat abs(vfloat a) { return max(a, -a); }
+        // the NEON estimate is only ~8 bits, one refinement step brings it in line with the x86 ones
+        inline vfloat rsqrt(vfloat a) {
+            const float32x4_t e = vrsqrteq_f32(a.v);
+            return { vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(a.v, e), e)) };
+        }
+        inline vfloat ldexp(vfloat a, vfloat n) {
+            const int32x4_t e = vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(n.v), vdupq_n_s32(127)), 23);
+            return { vmulq_f32(a.v, vreinterpretq_f32_s32(e)) };
+        }
+
+        inline vmask operator<(vfloat a, vfloat b) { return { vcltq_f32(a.v, b.v) }; }
+        inline vmask operator<=(vfloat a, vfloat b) { return { vcleq_f32(a.v, b.v) }; }
+        inline vmask operator>(vfloat a, vfloat b) { return { vcgtq_f32(a.v, b.v) }; }
+        inline vmask operator>=(vfloat a, vfloat b) { return { vcgeq_f32(a.v, b.v) }; }
+        inline vmask operator&(vmask a, vmask b) { return { vandq_u32(a.m, b.m) }; }
+        inline vmask operator|(vmask a, vmask b) { return { vorrq_u32(a.m, b.m) }; }
+        inline vfloat select(vmask m, vfloat a, vfloat b) { return { vbslq_f32(m.m, a.v, b.v) }; }
+        inline uint32 bits(vmask m) {
+            const uint32 lane_bits[4] = { 1, 2, 4, 8 };
+            return vaddvq_u32(vandq_u32(m.m, vld1q_u32(lane_bits)));
+        }
+#else
+        typedef scalar_v<float> vfloat;
+        typedef bool vmask;
+#endif
+
+        // Packet type used by the batch kernels for a given scalar type
+        template<typename T> struct packet_type { typedef scalar_v<T> type; };
+        template<> struct packet_type<float> { typedef vfloat type; };
+        template<typename T>
+        using packet = typename packet_type<T>::type;
+
+        // Result of comparing two packets: a native mask, or bool for the portable packet
+        template<typename T>
+        using mask = decltype(std::declval<packet<T>>() < std::declval<packet<T>>());
+
+        // Broadcast and unaligned load into a given packet type, including the portable one-lane packet
+        template<typename T, typename V>
+        struct splat {
+            static V from(T s) { return set1(s); }
+        };
+        template<typename T>
+        struct splat<T, scalar_v<T>> {
+            static scalar_v<T> from(T s) { return { s }; }
+        };
+        template<typename T, typename V>
+        struct load {
+            static V from(const T* p) { return loadu(p); }
+        };
+        template<typename T>
+        struct load<T, scalar_v<T>> {
+            static scalar_v<T> from(const T* p) { return { *p }; }
+        };
+    }
+}
+
+#endif // __LAML_SIMD_H
@@ -0,0 +1,222 @@
+#ifndef __LAML_SKINNING_H
+#define __LAML_SKINNING_H
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <laml/Parallel.hpp>
+#include <limits>
+#include <type_traits>
+
+namespace laml {
+    /* Linear-blend skinning over vertex streams.
+    * Every vertex has Influences (4 or 8) joint indices and weights, stored Influences per vertex:
+    * joints[Influences * i + k] indexes the skinning matrices and weights[Influences * i + k] is its weight.
+    * Indices may be uint8 or uint16. Weights may be T, or unorm uint8/uint16 (255 or 65535 is a weight of one);
+    * they are used as given, so quantized weights should be rounded to add up to exactly 255 or 65535.
+    * Unused influences get weight 0.
+    * */
+    namespace detail {
+        // Factor that turns a stored weight into T: 1 for floating point weights, 1/max for unorm ones
+        template<typename T, typename W, bool Quantized = std::is_integral<W>::value>
+        struct weight_scale {
+            static constexpr T value = constants::one<T>;
+        };
+        template<typename T, typename W>
+        struct weight_scale<T, W, true> {
+            static_assert(std::is_unsigned<W>::value, "quantized weights are unorm");
+            static constexpr T value = constants::one<T> / static_cast<T>(std::numeric_limits<W>::max());
+        };
+
+        // Vertices per tile: the 3x4 matrices are blended into stack lanes, then applied one packet at a time
+        constexpr size_t skin_lbs_tile_size = 128;
+
+        // Blends the skinning matrices of the tile's vertices into blended[3 * column + row][vertex]: rows 0-2 of the
+        // columns, the bottom row of an affine transform is 0, 0, 0, 1. Lanes past the end of the tile are zeroed.
+        template<size_t Influences, typename T, typename J, typename W>
+        inline void blend_tile(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights, size_t tile, T (&blended)[12][skin_lbs_tile_size]) {
+            const T scale = weight_scale<T, W>::value;
+            size_t i = 0;
+#if defined(LAML_SIMD_SSE)
+            // four vertices at a time: each vertex blends whole columns, a 4x4 transpose per column turns them into lanes
+            if constexpr (std::is_same<T, float>::value) {
+                for (; i < tile; i += 4) {
+                    __m128 cols[4][4];
+                    for (size_t v = 0; v < 4; v++) {
+                        if (i + v >= tile) {
+                            for (size_t c = 0; c < 4; c++) {
+                                cols[c][v] = _mm_setzero_ps();
+                            }
+                            continue;
+                        }
+                        const J* j = joints + Influences * (i + v);
+                        const W* w = weights + Influences * (i + v);
+                        const __m128 w0 = _mm_set1_ps(static_cast<float>(w[0]) * scale);
+                        for (size_t c = 0; c < 4; c++) {
+                            cols[c][v] = _mm_mul_ps(_mm_loadu_ps(&skin_mats[j[0]]._data[4 * c]), w0);
+                        }
+                        for (size_t k = 1; k < Influences; k++) {
+                            const __m128 wk = _mm_set1_ps(static_cast<float>(w[k]) * scale);
+                            const float* m = skin_mats[j[k]]._data;
+                            for (size_t c = 0; c < 4; c++) {
+                                cols[c][v] = _mm_add_ps(cols[c][v], _mm_mul_ps(_mm_loadu_ps(m + 4 * c), wk));
+                            }
+                        }
+                    }
+                    for (size_t c = 0; c < 4; c++) {
+                        _MM_TRANSPOSE4_PS(cols[c][0], cols[c][1], cols[c][2], cols[c][3]);
+                        for (size_t r = 0; r < 3; r++) {
+                            _mm_store_ps(blended[3 * c + r] + i, cols[c][r]);
+                        }
+                    }
+                }
+            }
+#endif
+            for (; i < tile; i++) {
+                const J* j = joints + Influences * i;
+                const W* w = weights + Influences * i;
+                T acc[16];
+                const T w0 = static_cast<T>(w[0]) * scale;
+                for (size_t c = 0; c < 16; c++) {
+                    acc[c] = skin_mats[j[0]]._data[c] * w0;
+                }
+                for (size_t k = 1; k < Influences; k++) {
+                    const T wk = static_cast<T>(w[k]) * scale;
+                    const Matrix<T, 4, 4>& m = skin_mats[j[k]];
+                    for (size_t c = 0; c < 16; c++) {
+                        acc[c] += m._data[c] * wk;
+                    }
+                }
+                for (size_t c = 0; c < 4; c++) {
+                    for (size_t r = 0; r < 3; r++) {
+                        blended[3 * c + r][i] = acc[4 * c + r];
+                    }
+                }
+            }
+            // lanes past the end of the tile are loaded but never stored
+            for (; i < skin_lbs_tile_size; i++) {
+                for (size_t c = 0; c < 12; c++) {
+                    blended[c][i] = constants::zero<T>;
+                }
+            }
+        }
+
+        template<size_t Influences, typename T, typename J, typename W>
+        void skin(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights,
+                  const soa::ConstVectorView<T, 3>& positions, const soa::ConstVectorView<T, 3>* normals,
+                  soa::VectorView<T, 3>& out_positions, soa::VectorView<T, 3>* out_normals) {
+            static_assert(Influences == 4 || Influences == 8, "4 or 8 influences per vertex");
+            static_assert(std::is_integral<J>::value && std::is_unsigned<J>::value, "joint indices are unsigned");
+            typedef simd::packet<T> P;
+            const size_t count = out_positions.size();
+
+            alignas(simd::alignment) T blended[12][skin_lbs_tile_size];
+            alignas(simd::alignment) T staged[4][3][skin_lbs_tile_size];
+            for (size_t base = 0; base < count; base += skin_lbs_tile_size) {
+                const size_t tile = (count - base < skin_lbs_tile_size) ? (count - base) : skin_lbs_tile_size;
+
+                blend_tile<Influences>(skin_mats, joints + Influences * base, weights + Influences * base, tile, blended);
+
+                // strided (AoS) views go through contiguous copies of the tile, like soa::detail::for_each_packet
+                const T* pos[3];
+                const T* nrm[3] = {};
+                T* out_pos[3];
+                T* out_nrm[3] = {};
+                soa::detail::stage_in(positions, base, tile, staged[0], pos);
+                soa::detail::stage_out(out_positions, base, staged[1], out_pos);
+                if (out_normals) {
+                    soa::detail::stage_in(*normals, base, tile, staged[2], nrm);
+                    soa::detail::stage_out(*out_normals, base, staged[3], out_nrm);
+                }
+
+                for (size_t idx = 0; idx < tile; idx += P::width) {
+                    const size_t n = (tile - idx < P::width) ? (tile - idx) : P::width;
+                    P m[12];
+                    for (size_t c = 0; c < 12; c++) {
+                        m[c] = simd::load<T, P>::from(blended[c] + idx);
+                    }
+
+                    P v[3];
+                    for (size_t c = 0; c < 3; c++) {
+                        v[c] = soa::detail::gather(pos[c], idx, 1, n);
+                    }
+                    for (size_t r = 0; r < 3; r++) {
+                        soa::detail::scatter(out_pos[r], idx, 1, n, m[r] * v[0] + m[3 + r] * v[1] + m[6 + r] * v[2] + m[9 + r]);
+                    }
+
+                    if (out_normals) {
+                        for (size_t c = 0; c < 3; c++) {
+                            v[c] = soa::detail::gather(nrm[c], idx, 1, n);
+                        }
+                        P r[3];
+                        for (size_t k = 0; k < 3; k++) {
+                            r[k] = m[k] * v[0] + m[3 + k] * v[1] + m[6 + k] * v[2];
+                        }
+                        // blended matrices are not rotations, so the result is renormalized
+                        const P inv_len = simd::splat<T, P>::from(constants::one<T>) / simd::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+                        for (size_t k = 0; k < 3; k++) {
+                            soa::detail::scatter(out_nrm[k], idx, 1, n, r[k] * inv_len);
+                        }
+                    }
+                }
+
+                soa::detail::stage_flush(out_positions, base, tile, staged[1]);
+                if (out_normals) {
+                    soa::detail::stage_flush(*out_normals, base, tile, staged[3]);
+                }
+            }
+        }
+    }
+
+    /* Skinning matrices for the current frame: skin_mats[j] = joint_mats[j] * inverse_bind[j],
+    * i.e. from bind pose model space to the joint's current model space.
+    * Joint and bind matrices must be affine (bottom row 0, 0, 0, 1): skin() only uses the top three rows.
+    * */
+    template<typename T>
+    void skinning_matrices(const Matrix<T, 4, 4>* joint_mats, const Matrix<T, 4, 4>* inverse_bind, Matrix<T, 4, 4>* skin_mats, size_t num_joints) {
+        for (size_t j = 0; j < num_joints; j++) {
+            skin_mats[j] = mul(joint_mats[j], inverse_bind[j]);
+        }
+    }
+
+    /* Linear-blend skinning, simd::packet<T>::width vertices at a time: each vertex is moved by the weighted sum of
+    * its skinning matrices. Views may be SoA arrays or soa::view() over plain Vector<T,3> arrays; outputs may be the inputs.
+    * */
+    template<size_t Influences, typename T, typename J, typename W>
+    void skin(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights,
+              const soa::ConstVectorView<T, 3>& positions, soa::VectorView<T, 3> out_positions) {
+        detail::skin<Influences, T, J, W>(skin_mats, joints, weights, positions, nullptr, out_positions, nullptr);
+    }
+    // Normals go through the blended 3x3 and are renormalized; that is exact for rotations and uniform scale only
+    template<size_t Influences, typename T, typename J, typename W>
+    void skin(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights,
+              const soa::ConstVectorView<T, 3>& positions, const soa::ConstVectorView<T, 3>& normals,
+              soa::VectorView<T, 3> out_positions, soa::VectorView<T, 3> out_normals) {
+        detail::skin<Influences, T, J, W>(skin_mats, joints, weights, positions, &normals, out_positions, &out_normals);
+    }
+
+    namespace parallel {
+        constexpr size_t skin_chunk = 4096;
+
+        // laml::skin() in chunks of vertices
+        template<size_t Influences, typename T, typename J, typename W>
+        void skin(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights,
+                  const soa::ConstVectorView<T, 3>& positions, soa::VectorView<T, 3> out_positions, size_t min_chunk = skin_chunk) {
+            for_range(out_positions.size(), min_chunk, [&](size_t begin, size_t end) {
+                laml::skin<Influences>(skin_mats, joints + Influences * begin, weights + Influences * begin,
+                                       positions.slice(begin, end - begin), out_positions.slice(begin, end - begin));
+            });
+        }
+        template<size_t Influences, typename T, typename J, typename W>
+        void skin(const Matrix<T, 4, 4>* skin_mats, const J* joints, const W* weights,
+                  const soa::ConstVectorView<T, 3>& positions, const soa::ConstVectorView<T, 3>& normals,
+                  soa::VectorView<T, 3> out_positions, soa::VectorView<T, 3> out_normals, size_t min_chunk = skin_chunk) {
+            for_range(out_positions.size(), min_chunk, [&](size_t begin, size_t end) {
+                laml::skin<Influences>(skin_mats, joints + Influences * begin, weights + Influences * begin,
+                                       positions.slice(begin, end - begin), normals.slice(begin, end - begin),
+                                       out_positions.slice(begin, end - begin), out_normals.slice(begin, end - begin));
+            });
+        }
+    }
+}
+
+#endif // __LAML_SKINNING_H
@@ -0,0 +1,695 @@
+#ifndef __LAML_SOA_H
+#define __LAML_SOA_H
+
+#include <laml/Data_types.hpp>
+#include <laml/Constants.hpp>
+#include <laml/Simd.hpp>
+#include <laml/Vector.hpp>
+#include <laml/Quaternion.hpp>
+#include <laml/Aligned.hpp>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace laml {
+    /* Structure-of-arrays batches of vectors.
+    * A VectorArray<T,N> stores every component in its own aligned lane (all the x's, then all the y's, ...),
+    * so the batch kernels below process simd::packet<T>::width vectors per instruction.
+    * Kernels read ConstVectorViews and write VectorViews, which can also look at a plain array of Vector<T,N> without copying.
+    * */
+    namespace soa {
+
+        // Non-owning, read-only view of N lanes of T. Kernels take their inputs through it.
+        // _stride is in elements: 1 for separate lanes (SoA), sizeof(Vector<T,N>)/sizeof(T) when viewing an array of Vector<T,N> (AoS).
+        template<typename T, size_t N>
+        struct ConstVectorView {
+            const T* _lanes[N];
+            size_t _count;
+            size_t _stride;
+
+            ConstVectorView() : _lanes{}, _count(0), _stride(1) {}
+            ConstVectorView(const T* const (&lanes)[N], size_t count, size_t stride) : _count(count), _stride(stride) {
+                for (size_t k = 0; k < N; k++) {
+                    _lanes[k] = lanes[k];
+                }
+            }
+
+            size_t size() const { return _count; }
+            size_t stride() const { return _stride; }
+
+            const T* lane(size_t k) const { return _lanes[k]; }
+
+            Vector<T, N> get(size_t idx) const {
+                Vector<T, N> res;
+                for (size_t k = 0; k < N; k++) {
+                    res[k] = _lanes[k][idx * _stride];
+                }
+                return res;
+            }
+
+            // view of elements [begin, begin+count)
+            ConstVectorView slice(size_t begin, size_t count) const {
+                ConstVectorView res(_lanes, count, _stride);
+                for (size_t k = 0; k < N; k++) {
+                    res._lanes[k] += begin * _stride;
+                }
+                return res;
+            }
+        };
+
+        // Non-owning view of N writable lanes of T; it is also a read-only view of the same lanes.
+        template<typename T, size_t N>
+        struct VectorView : public ConstVectorView<T, N> {
+            VectorView() = default;
+            VectorView(T* const (&lanes)[N], size_t count, size_t stride) {
+                for (size_t k = 0; k < N; k++) {
+                    this->_lanes[k] = lanes[k];
+                }
+                this->_count = count;
+                this->_stride = stride;
+            }
+
+            // the lanes of a writable view are only ever set from T*
+            T* lane(size_t k) { return const_cast<T*>(this->_lanes[k]); }
+            const T* lane(size_t k) const { return this->_lanes[k]; }
+
+            void set(size_t idx, const Vector<T, N>& v) {
+                for (size_t k = 0; k < N; k++) {
+                    lane(k)[idx * this->_stride] = v[k];
+                }
+            }
+
+            // view of elements [begin, begin+count); a const view only gives a read-only slice
+            VectorView slice(size_t begin, size_t count) {
+                VectorView res;
+                res._count = count;
+                res._stride = this->_stride;
+                for (size_t k = 0; k < N; k++) {
+                    res._lanes[k] = this->_lanes[k] + begin * this->_stride;
+                }
+                return res;
+            }
+            ConstVectorView<T, N> slice(size_t begin, size_t count) const {
+                return ConstVectorView<T, N>::slice(begin, count);
+            }
+        };
+
+        // Owning SoA storage. Every lane starts on a simd::alignment boundary and is padded to a whole number of packets.
+        template<typename T, size_t N>
+        struct VectorArray : public VectorView<T, N> {
+            VectorArray() : VectorView<T, N>(), _block(nullptr), _capacity(0) {}
+            explicit VectorArray(size_t count) : VectorArray() {
+                resize(count);
+            }
+            // de-interleave a plain array of vectors
+            VectorArray(const Vector<T, N>* data, size_t count) : VectorArray(count) {
+                for (size_t n = 0; n < count; n++) {
+                    this->set(n, data[n]);
+                }
+            }
+            VectorArray(const VectorArray& other) : VectorArray(other._count) {
+                copy_lanes(other);
+            }
+            VectorArray(VectorArray&& other) noexcept : VectorArray() {
+                swap(other);
+            }
+            ~VectorArray() {
+                release(_block);
+            }
+
+            VectorArray& operator=(const VectorArray& other) {
+                if (this != &other) {
+                    resize(other._count);
+                    copy_lanes(other);
+                }
+                return *this;
+            }
+            VectorArray& operator=(VectorArray&& other) noexcept {
+                swap(other);
+                return *this;
+            }
+
+            size_t capacity() const { return _capacity; }
+
+            T* x() { return this->lane(0); }
+            T* y() { return this->lane(1); }
+            T* z() { return this->lane(2); }
+            T* w() { return this->lane(3); }
+            const T* x() const { return this->_lanes[0]; }
+            const T* y() const { return this->_lanes[1]; }
+            const T* z() const { return this->_lanes[2]; }
+            const T* w() const { return this->_lanes[3]; }
+
+            // existing elements are kept, new ones are zero
+            void resize(size_t count) {
+                if (count > _capacity) {
+                    const size_t lane_elems = simd::alignment / sizeof(T);
+                    const size_t new_capacity = ((count + lane_elems - 1) / lane_elems) * lane_elems;
+                    T* block = static_cast<T*>(::operator new(sizeof(T) * N * new_capacity, std::align_val_t(simd::alignment)));
+                    for (size_t k = 0; k < N; k++) {
+                        T* dst = block + k * new_capacity;
+                        for (size_t n = 0; n < new_capacity; n++) {
+                            dst[n] = (n < this->_count) ? this->_lanes[k][n] : static_cast<T>(0.0);
+                        }
+                        this->_lanes[k] = dst;
+                    }
+                    release(_block);
+                    _block = block;
+                    _capacity = new_capacity;
+                }
+                else {
+                    for (size_t k = 0; k < N; k++) {
+                        for (size_t n = this->_count; n < count; n++) {
+                            this->lane(k)[n] = static_cast<T>(0.0);
+                        }
+                    }
+                }
+                this->_count = count;
+            }
+
+            void swap(VectorArray& other) noexcept {
+                std::swap(this->_lanes, other._lanes);
+                std::swap(this->_count, other._count);
+                std::swap(_block, other._block);
+                std::swap(_capacity, other._capacity);
+            }
+
+        private:
+            void copy_lanes(const VectorArray& other) {
+                for (size_t k = 0; k < N; k++) {
+                    for (size_t n = 0; n < other._count; n++) {
+                        this->lane(k)[n] = other.lane(k)[n];
+                    }
+                }
+            }
+            static void release(T* block) {
+                if (block) {
+                    ::operator delete(block, std::align_val_t(simd::alignment));
+                }
+            }
+
+            T* _block;
+            size_t _capacity;
+        };
+
+        namespace detail {
+            // View V of an array of E, each holding its N components as consecutive values; const E gives a ConstVectorView
+            template<typename V, size_t N, typename E>
+            V view_elements(E* data, size_t count) {
+                typedef typename std::remove_reference<decltype(data[0][0])>::type C;
+                C* lanes[N];
+                for (size_t k = 0; k < N; k++) {
+                    lanes[k] = data ? &data[0][k] : nullptr;
+                }
+                return V(lanes, count, sizeof(E) / sizeof(C));
+            }
+        }
+
+        // Zero-copy views over an array of Vector<T,N>; a const array gives a read-only view
+        template<typename T, size_t N>
+        VectorView<T, N> view(Vector<T, N>* data, size_t count) {
+            return detail::view_elements<VectorView<T, N>, N>(data, count);
+        }
+        template<typename T, size_t N>
+        ConstVectorView<T, N> view(const Vector<T, N>* data, size_t count) {
+            return detail::view_elements<ConstVectorView<T, N>, N>(data, count);
+        }
+
+        // Quaternions are stored as 4 lanes in x, y, z, w order
+        template<typename T>
+        VectorView<T, 4> view(Quaternion<T>* data, size_t count) {
+            return detail::view_elements<VectorView<T, 4>, 4>(data, count);
+        }
+        template<typename T>
+        ConstVectorView<T, 4> view(const Quaternion<T>* data, size_t count) {
+            return detail::view_elements<ConstVectorView<T, 4>, 4>(data, count);
+        }
+
+        // Padded arrays (Vec3A, QuatA, ...): same lanes, with the padded stride.
+        // These are picked over the overloads above, which would otherwise accept the pointer as a pointer to its base.
+        template<typename T, size_t N, size_t A>
+        VectorView<T, N> view(Aligned<Vector<T, N>, A>* data, size_t count) {
+            return detail::view_elements<VectorView<T, N>, N>(data, count);
+        }
+        template<typename T, size_t N, size_t A>
+        ConstVectorView<T, N> view(const Aligned<Vector<T, N>, A>* data, size_t count) {
+            return detail::view_elements<ConstVectorView<T, N>, N>(data, count);
+        }
+        template<typename T, size_t A>
+        VectorView<T, 4> view(Aligned<Quaternion<T>, A>* data, size_t count) {
+            return detail::view_elements<VectorView<T, 4>, 4>(data, count);
+        }
+        template<typename T, size_t A>
+        ConstVectorView<T, 4> view(const Aligned<Quaternion<T>, A>* data, size_t count) {
+            return detail::view_elements<ConstVectorView<T, 4>, 4>(data, count);
+        }
+
+        // Useful shorthands
+        typedef VectorArray<float, 3> Vec3Array;
+        typedef VectorArray<float, 4> Vec4Array;
+        typedef VectorView<float, 3> Vec3View;
+        typedef VectorView<float, 4> Vec4View;
+        typedef ConstVectorView<float, 3> Vec3ConstView;
+        typedef ConstVectorView<float, 4> Vec4ConstView;
+
+        typedef VectorArray<double, 3> Vec3Array_highp;
+        typedef VectorArray<double, 4> Vec4Array_highp;
+        typedef VectorView<double, 3> Vec3View_highp;
+        typedef VectorView<double, 4> Vec4View_highp;
+        typedef ConstVectorView<double, 3> Vec3ConstView_highp;
+        typedef ConstVectorView<double, 4> Vec4ConstView_highp;
+        typedef VectorArray<float, 4> QuatArray;
+        typedef VectorArray<double, 4> QuatArray_highp;
+
+        namespace detail {
+            // Load one packet starting at element idx.
+            // Strided lanes and the partial packet at the end go through a small zero-filled buffer.
+            template<typename T>
+            inline simd::packet<T> gather(const T* p, size_t idx, size_t stride, size_t n) {
+                typedef simd::packet<T> P;
+                if (stride == 1 && n == P::width) {
+                    return simd::loadu(p + idx);
+                }
+                T tmp[P::width] = {};
+                for (size_t k = 0; k < n; k++) {
+                    tmp[k] = p[(idx + k) * stride];
+                }
+                return simd::loadu(tmp);
+            }
+
+            template<typename T>
+            inline void scatter(T* p, size_t idx, size_t stride, size_t n, simd::packet<T> v) {
+                typedef simd::packet<T> P;
+                if (stride == 1 && n == P::width) {
+                    simd::storeu(p + idx, v);
+                    return;
+                }
+                T tmp[P::width];
+                simd::storeu(tmp, v);
+                for (size_t k = 0; k < n; k++) {
+                    p[(idx + k) * stride] = tmp[k];
+                }
+            }
+
+            template<size_t DstStride, size_t SrcStride, typename T>
+            inline void copy_strided(T* dst, const T* src, size_t n) {
+                for (size_t i = 0; i < n; i++) dst[i * DstStride] = src[i * SrcStride];
+            }
+            // Strides of Vector<T,3>/Vector<T,4> arrays get their own loops so they can be vectorized
+            template<typename T>
+            inline void copy_strided(T* dst, size_t dst_stride, const T* src, size_t src_stride, size_t n) {
+                if (dst_stride == 1 && src_stride == 3) return copy_strided<1, 3>(dst, src, n);
+                if (dst_stride == 1 && src_stride == 4) return copy_strided<1, 4>(dst, src, n);
+                if (dst_stride == 3 && src_stride == 1) return copy_strided<3, 1>(dst, src, n);
+                if (dst_stride == 4 && src_stride == 1) return copy_strided<4, 1>(dst, src, n);
+                for (size_t i = 0; i < n; i++) dst[i * dst_stride] = src[i * src_stride];
+            }
+
+            // Elements per tile when strided (AoS) views are copied through contiguous stack buffers
+            constexpr size_t tile_size = 128;
+
+            // The lanes of a tile of view with unit stride: the view's own memory if it is SoA, otherwise a copy in buf
+            template<typename T, size_t Tile>
+            inline void stage_in(const ConstVectorView<T, 3>& view, size_t base, size_t tile, T (&buf)[3][Tile], const T* (&lanes)[3]) {
+                for (size_t c = 0; c < 3; c++) {
+                    if (view.stride() == 1) {
+                        lanes[c] = view.lane(c) + base;
+                    } else {
+                        copy_strided(buf[c], 1, view.lane(c) + base * view.stride(), view.stride(), tile);
+                        lanes[c] = buf[c];
+                    }
+                }
+            }
+            template<typename T, size_t Tile>
+            inline void stage_out(VectorView<T, 3>& view, size_t base, T (&buf)[3][Tile], T* (&lanes)[3]) {
+                for (size_t c = 0; c < 3; c++) {
+                    lanes[c] = (view.stride() == 1) ? view.lane(c) + base : buf[c];
+                }
+            }
+            // Copies what stage_out() redirected into buf back to the view
+            template<typename T, size_t Tile>
+            inline void stage_flush(VectorView<T, 3>& view, size_t base, size_t tile, T (&buf)[3][Tile]) {
+                if (view.stride() != 1) {
+                    for (size_t c = 0; c < 3; c++) {
+                        copy_strided(view.lane(c) + base * view.stride(), view.stride(), buf[c], 1, tile);
+                    }
+                }
+            }
+
+            // Runs kernel(const P* in, P* out) over count elements, one packet at a time.
+            // Unit-stride lanes are streamed directly; otherwise each tile is first transposed into
+            // contiguous buffers, so the packet loads never wait on a handful of scalar stores.
+            template<typename T, size_t In, size_t Out, typename F>
+            inline void for_each_packet(size_t count,
+                                        const T* const (&in)[In], const size_t (&in_stride)[In],
+                                        T* const (&out)[Out], const size_t (&out_stride)[Out],
+                                        F kernel) {
+                typedef simd::packet<T> P;
+                bool contiguous = true;
+                for (size_t k = 0; k < In; k++) contiguous = contiguous && in_stride[k] == 1;
+                for (size_t k = 0; k < Out; k++) contiguous = contiguous && out_stride[k] == 1;
+
+                if (contiguous) {
+                    size_t idx = 0;
+                    for (; idx + P::width <= count; idx += P::width) {
+                        P a[In];
+                        P r[Out];
+                        for (size_t k = 0; k < In; k++) a[k] = simd::loadu(in[k] + idx);
+                        kernel(a, r);
+                        for (size_t k = 0; k < Out; k++) simd::storeu(out[k] + idx, r[k]);
+                    }
+                    if (idx < count) {
+                        P a[In];
+                        P r[Out];
+                        for (size_t k = 0; k < In; k++) a[k] = gather(in[k], idx, 1, count - idx);
+                        kernel(a, r);
+                        for (size_t k = 0; k < Out; k++) scatter(out[k], idx, 1, count - idx, r[k]);
+                    }
+                    return;
+                }
+
+                alignas(simd::alignment) T in_tile[In][tile_size];
+                alignas(simd::alignment) T out_tile[Out][tile_size];
+                for (size_t base = 0; base < count; base += tile_size) {
+                    const size_t n = (count - base < tile_size) ? (count - base) : tile_size;
+                    for (size_t k = 0; k < In; k++) {
+                        copy_strided(in_tile[k], 1, in[k] + base * in_stride[k], in_stride[k], n);
+                        for (size_t i = n; i < tile_size; i++) in_tile[k][i] = T(0);
+                    }
+                    for (size_t idx = 0; idx < n; idx += P::width) {
+                        P a[In];
+                        P r[Out];
+                        for (size_t k = 0; k < In; k++) a[k] = simd::loadu(in_tile[k] + idx);
+                        kernel(a, r);
+                        for (size_t k = 0; k < Out; k++) simd::storeu(out_tile[k] + idx, r[k]);
+                    }
+                    for (size_t k = 0; k < Out; k++) {
+                        copy_strided(out[k] + base * out_stride[k], out_stride[k], out_tile[k], 1, n);
+                    }
+                }
+            }
+        }
+
+        /* Batched versions of the Vector.hpp free functions.
+        * Every view must hold the same number of elements; the output's size is used.
+        * Outputs may alias inputs element-for-element (e.g. normalize(a, a)).
+        * */
+        template<typename T, size_t N>
+        void add(const ConstVectorView<T, N>& a, const ConstVectorView<T, N>& b, VectorView<T, N> out) {
+            const T* in[2 * N];
+            size_t in_stride[2 * N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                in[N + k] = b.lane(k);     in_stride[N + k] = b.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = v[k] + v[N + k];
+                    }
+                });
+        }
+
+        template<typename T, size_t N>
+        void sub(const ConstVectorView<T, N>& a, const ConstVectorView<T, N>& b, VectorView<T, N> out) {
+            const T* in[2 * N];
+            size_t in_stride[2 * N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                in[N + k] = b.lane(k);     in_stride[N + k] = b.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = v[k] - v[N + k];
+                    }
+                });
+        }
+
+        template<typename T, size_t N>
+        void scale(const ConstVectorView<T, N>& a, T factor, VectorView<T, N> out) {
+            const T* in[N];
+            size_t in_stride[N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            const simd::packet<T> s = simd::set1(factor);
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [s](const simd::packet<T>* v, simd::packet<T>* r) {
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = v[k] * s;
+                    }
+                });
+        }
+
+        template<typename T, size_t N>
+        void dot(const ConstVectorView<T, N>& a, const ConstVectorView<T, N>& b, T* out) {
+            const T* in[2 * N];
+            size_t in_stride[2 * N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                in[N + k] = b.lane(k);     in_stride[N + k] = b.stride();
+            }
+            T* const res[1] = { out };
+            const size_t res_stride[1] = { 1 };
+            detail::for_each_packet(a.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    simd::packet<T> sum = v[0] * v[N];
+                    for (size_t k = 1; k < N; k++) {
+                        sum = sum + v[k] * v[N + k];
+                    }
+                    r[0] = sum;
+                });
+        }
+
+        template<typename T>
+        void cross(const ConstVectorView<T, 3>& a, const ConstVectorView<T, 3>& b, VectorView<T, 3> out) {
+            const T* const in[6] = { a.lane(0), a.lane(1), a.lane(2), b.lane(0), b.lane(1), b.lane(2) };
+            const size_t in_stride[6] = { a.stride(), a.stride(), a.stride(), b.stride(), b.stride(), b.stride() };
+            T* const res[3] = { out.lane(0), out.lane(1), out.lane(2) };
+            const size_t res_stride[3] = { out.stride(), out.stride(), out.stride() };
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    r[0] = v[1] * v[5] - v[2] * v[4];
+                    r[1] = v[2] * v[3] - v[0] * v[5];
+                    r[2] = v[0] * v[4] - v[1] * v[3];
+                });
+        }
+
+        template<typename T, size_t N>
+        void length(const ConstVectorView<T, N>& a, T* out) {
+            const T* in[N];
+            size_t in_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+            }
+            T* const res[1] = { out };
+            const size_t res_stride[1] = { 1 };
+            detail::for_each_packet(a.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    simd::packet<T> sum = v[0] * v[0];
+                    for (size_t k = 1; k < N; k++) {
+                        sum = sum + v[k] * v[k];
+                    }
+                    r[0] = simd::sqrt(sum);
+                });
+        }
+
+        // same convention as laml::normalize - vectors shorter than eps<T> become zero
+        template<typename T, size_t N>
+        void normalize(const ConstVectorView<T, N>& a, VectorView<T, N> out) {
+            const T* in[N];
+            size_t in_stride[N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            const simd::packet<T> zero = simd::set1(constants::zero<T>);
+            const simd::packet<T> tol = simd::set1(laml::eps<T>);
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [zero, tol](const simd::packet<T>* v, simd::packet<T>* r) {
+                    simd::packet<T> sum = v[0] * v[0];
+                    for (size_t k = 1; k < N; k++) {
+                        sum = sum + v[k] * v[k];
+                    }
+                    const simd::packet<T> mag = simd::sqrt(sum);
+                    const auto degenerate = mag < tol;
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = simd::select(degenerate, zero, v[k] / mag);
+                    }
+                });
+        }
+
+        template<typename T, size_t N>
+        void lerp(const ConstVectorView<T, N>& a, const ConstVectorView<T, N>& b, T factor, VectorView<T, N> out) {
+            const T* in[2 * N];
+            size_t in_stride[2 * N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                in[N + k] = b.lane(k);     in_stride[N + k] = b.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            const simd::packet<T> t = simd::set1(factor);
+            const simd::packet<T> one_minus_t = simd::set1(static_cast<T>(1.0) - factor);
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [t, one_minus_t](const simd::packet<T>* v, simd::packet<T>* r) {
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = v[N + k] * t + v[k] * one_minus_t;
+                    }
+                });
+        }
+
+        template<typename T, size_t N>
+        void clamp(const ConstVectorView<T, N>& a, T min_val, T max_val, VectorView<T, N> out) {
+            const T* in[N];
+            size_t in_stride[N];
+            T* res[N];
+            size_t res_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            const simd::packet<T> lo = simd::set1(min_val);
+            const simd::packet<T> hi = simd::set1(max_val);
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [lo, hi](const simd::packet<T>* v, simd::packet<T>* r) {
+                    for (size_t k = 0; k < N; k++) {
+                        r[k] = simd::min(simd::max(v[k], lo), hi);
+                    }
+                });
+        }
+
+        // smallest/largest component of each vector, like laml::min(v)/laml::max(v)
+        template<typename T, size_t N>
+        void min(const ConstVectorView<T, N>& a, T* out) {
+            const T* in[N];
+            size_t in_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+            }
+            T* const res[1] = { out };
+            const size_t res_stride[1] = { 1 };
+            detail::for_each_packet(a.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    simd::packet<T> m = v[0];
+                    for (size_t k = 1; k < N; k++) {
+                        m = simd::min(m, v[k]);
+                    }
+                    r[0] = m;
+                });
+        }
+
+        template<typename T, size_t N>
+        void max(const ConstVectorView<T, N>& a, T* out) {
+            const T* in[N];
+            size_t in_stride[N];
+            for (size_t k = 0; k < N; k++) {
+                in[k] = a.lane(k);         in_stride[k] = a.stride();
+            }
+            T* const res[1] = { out };
+            const size_t res_stride[1] = { 1 };
+            detail::for_each_packet(a.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    simd::packet<T> m = v[0];
+                    for (size_t k = 1; k < N; k++) {
+                        m = simd::max(m, v[k]);
+                    }
+                    r[0] = m;
+                });
+        }
+
+        /* Quaternion kernels, on 4-lane views holding x, y, z, w.
+        * normalize() above works on quaternions as-is.
+        * */
+        // Hamilton product q1 * q2, same operation order as laml::mul
+        template<typename T>
+        void quat_mul(const ConstVectorView<T, 4>& q1, const ConstVectorView<T, 4>& q2, VectorView<T, 4> out) {
+            const T* in[8];
+            size_t in_stride[8];
+            T* res[4];
+            size_t res_stride[4];
+            for (size_t k = 0; k < 4; k++) {
+                in[k] = q1.lane(k);        in_stride[k] = q1.stride();
+                in[4 + k] = q2.lane(k);    in_stride[4 + k] = q2.stride();
+                res[k] = out.lane(k);      res_stride[k] = out.stride();
+            }
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    const simd::packet<T>& x1 = v[0]; const simd::packet<T>& y1 = v[1]; const simd::packet<T>& z1 = v[2]; const simd::packet<T>& w1 = v[3];
+                    const simd::packet<T>& x2 = v[4]; const simd::packet<T>& y2 = v[5]; const simd::packet<T>& z2 = v[6]; const simd::packet<T>& w2 = v[7];
+                    r[0] = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2;
+                    r[1] = w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2;
+                    r[2] = w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2;
+                    r[3] = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2;
+                });
+        }
+
+        namespace detail {
+            // t = 2(q x v), v' = v + w*t + q x t, as in laml::rotate (c + c is exactly 2c)
+            template<typename P>
+            inline void rotate(const P& qx, const P& qy, const P& qz, const P& qw, const P* v, P* r) {
+                const P cx = qy * v[2] - qz * v[1];
+                const P cy = qz * v[0] - qx * v[2];
+                const P cz = qx * v[1] - qy * v[0];
+                const P tx = cx + cx, ty = cy + cy, tz = cz + cz;
+                r[0] = v[0] + qw * tx + (qy * tz - qz * ty);
+                r[1] = v[1] + qw * ty + (qz * tx - qx * tz);
+                r[2] = v[2] + qw * tz + (qx * ty - qy * tx);
+            }
+        }
+
+        // Rotates each vector by its own unit quaternion
+        template<typename T>
+        void rotate(const ConstVectorView<T, 4>& quats, const ConstVectorView<T, 3>& vecs, VectorView<T, 3> out) {
+            const T* const in[7] = { vecs.lane(0), vecs.lane(1), vecs.lane(2), quats.lane(0), quats.lane(1), quats.lane(2), quats.lane(3) };
+            const size_t in_stride[7] = { vecs.stride(), vecs.stride(), vecs.stride(), quats.stride(), quats.stride(), quats.stride(), quats.stride() };
+            T* const res[3] = { out.lane(0), out.lane(1), out.lane(2) };
+            const size_t res_stride[3] = { out.stride(), out.stride(), out.stride() };
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [](const simd::packet<T>* v, simd::packet<T>* r) {
+                    detail::rotate(v[3], v[4], v[5], v[6], v, r);
+                });
+        }
+
+        // Rotates every vector by the same unit quaternion
+        template<typename T>
+        void rotate(const Quaternion<T>& quat, const ConstVectorView<T, 3>& vecs, VectorView<T, 3> out) {
+            const T* const in[3] = { vecs.lane(0), vecs.lane(1), vecs.lane(2) };
+            const size_t in_stride[3] = { vecs.stride(), vecs.stride(), vecs.stride() };
+            T* const res[3] = { out.lane(0), out.lane(1), out.lane(2) };
+            const size_t res_stride[3] = { out.stride(), out.stride(), out.stride() };
+            const simd::packet<T> qx = simd::set1(quat.x), qy = simd::set1(quat.y), qz = simd::set1(quat.z), qw = simd::set1(quat.w);
+            detail::for_each_packet(out.size(), in, in_stride, res, res_stride,
+                [=](const simd::packet<T>* v, simd::packet<T>* r) {
+                    detail::rotate(qx, qy, qz, qw, v, r);
+                });
+        }
+
+        // Element-wise copy between any two views, e.g. AoS -> SoA or back
+        template<typename T, size_t N>
+        void copy(const ConstVectorView<T, N>& src, VectorView<T, N> dst) {
+            for (size_t k = 0; k < N; k++) {
+                const T* s = src.lane(k);
+                T* d = dst.lane(k);
+                for (size_t n = 0; n < dst.size(); n++) {
+                    d[n * dst.stride()] = s[n * src.stride()];
+                }
+            }
+        }
+    }
+}
+
+#endif // __LAML_SOA_H
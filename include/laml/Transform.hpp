@@ -2,12 +2,14 @@
 #define __TRANSFORM_H
 
 #include <cmath>
+#include <laml/Simd.hpp>
+#include <laml/Soa.hpp>
 
 namespace laml {
     namespace transform {
         
         template<typename T>
-        void create_projection_orthographic(Matrix<T, 4, 4>& mat, T left, T right, T bottom, T top, T znear, T zfar) {
+        constexpr void create_projection_orthographic(Matrix<T, 4, 4>& mat, T left, T right, T bottom, T top, T znear, T zfar) {
             laml::fill(mat, constants::zero<T>);
 
             mat[0][0] = constants::two<T> / (right - left);
@@ -22,11 +24,11 @@ namespace laml {
         }
 
         template<typename T>
-        void create_projection_perspective(Matrix<T, 4, 4>& mat, T vertical_fov, T aspect_ratio, T znear, T zfar) {
+        constexpr void create_projection_perspective(Matrix<T, 4, 4>& mat, T vertical_fov, T aspect_ratio, T znear, T zfar) {
             laml::fill(mat, constants::zero<T>);
 
             //const T tan_half = static_cast<T>(tan(vertical_fov * constants::deg2rad / 2.0));
-            const T tan_half = tan(vertical_fov * constants::deg2rad<T> / constants::two<T>);
+            const T tan_half = cx::tan(vertical_fov * constants::deg2rad<T> / constants::two<T>);
 
             mat[0][0] = constants::one<T> / (aspect_ratio * tan_half);
             mat[1][1] = constants::one<T> / tan_half;
@@ -36,22 +38,14 @@ namespace laml {
         }
 
         template<typename T>
-        void create_view_matrix_from_transform(Matrix<T, 4, 4>& view, const Matrix<T, 4, 4>& transform) {
+        constexpr void create_view_matrix_from_transform(Matrix<T, 4, 4>& view, const Matrix<T, 4, 4>& transform) {
             // assume no scale is applied to the camera transform!!
             // V = inv(T x R) = inv(R) x inv(T) = transpose(R) x (-T)
-            Matrix<T, 4, 4> inv_rot(laml::transpose(transform));
-            inv_rot.c_41 = constants::zero<T>;
-            inv_rot.c_42 = constants::zero<T>;
-            inv_rot.c_43 = constants::zero<T>;
-            Matrix<T, 4, 4> inv_translate(constants::one<T>);
-            inv_translate.c_14 = -transform.c_14;
-            inv_translate.c_24 = -transform.c_24;
-            inv_translate.c_34 = -transform.c_34;
-            view = mul(inv_rot, inv_translate);
+            view = laml::inverse_rigid(transform);
         }
 
         template<typename T, size_t size>
-        Vector<T, size> transform_point(const Matrix<T, size, size>& mat, const Vector<T, size>& vec) {
+        constexpr Vector<T, size> transform_point(const Matrix<T, size, size>& mat, const Vector<T, size>& vec) {
             Vector<T, size> res;
             for (size_t i = 0; i < size; i++) {
                 res[i] = constants::zero<T>;
@@ -62,26 +56,123 @@ namespace laml {
             return res;
         }
         template<typename T>
-        Vector<T, 3> transform_point(const Matrix<T, 4, 4>& mat, const Vector<T, 3>& vec, T w) {
+        constexpr Vector<T, 3> transform_point(const Matrix<T, 4, 4>& mat, const Vector<T, 3>& vec, T w) {
             Vector<T, 3> res(
-                mat.c_11 * vec.x + mat.c_12 * vec.y + mat.c_13 * vec.z + mat.c_14 * w,
-                mat.c_21 * vec.x + mat.c_22 * vec.y + mat.c_23 * vec.z + mat.c_24 * w,
-                mat.c_31 * vec.x + mat.c_32 * vec.y + mat.c_33 * vec.z + mat.c_34 * w);
+                mat[0][0] * vec[0] + mat[1][0] * vec[1] + mat[2][0] * vec[2] + mat[3][0] * w,
+                mat[0][1] * vec[0] + mat[1][1] * vec[1] + mat[2][1] * vec[2] + mat[3][1] * w,
+                mat[0][2] * vec[0] + mat[1][2] * vec[1] + mat[2][2] * vec[2] + mat[3][2] * w);
             return res;
         }
         template<typename T>
-        Vector<T, 4> transform_point(const Matrix<T, 4, 4>& mat, const Vector<T, 4>& vec) {
+        constexpr Vector<T, 4> transform_point(const Matrix<T, 4, 4>& mat, const Vector<T, 4>& vec) {
             Vector<T, 4> res(
-                mat.c_11 * vec.x + mat.c_12 * vec.y + mat.c_13 * vec.z + mat.c_14 * vec.w,
-                mat.c_21 * vec.x + mat.c_22 * vec.y + mat.c_23 * vec.z + mat.c_24 * vec.w,
-                mat.c_31 * vec.x + mat.c_32 * vec.y + mat.c_33 * vec.z + mat.c_34 * vec.w,
-                mat.c_41 * vec.x + mat.c_42 * vec.y + mat.c_43 * vec.z + mat.c_44 * vec.w);
+                mat[0][0] * vec[0] + mat[1][0] * vec[1] + mat[2][0] * vec[2] + mat[3][0] * vec[3],
+                mat[0][1] * vec[0] + mat[1][1] * vec[1] + mat[2][1] * vec[2] + mat[3][1] * vec[3],
+                mat[0][2] * vec[0] + mat[1][2] * vec[1] + mat[2][2] * vec[2] + mat[3][2] * vec[3],
+                mat[0][3] * vec[0] + mat[1][3] * vec[1] + mat[2][3] * vec[2] + mat[3][3] * vec[3]);
             return res;
         }
 
+        // Batched transform_point(mat, vec, w) over a whole buffer.
+        // in/out can be SoA arrays or zero-copy views of Vector<T,3> arrays (soa::view), and may be the same buffer.
+        // With perspective_divide each result is divided by its transformed w (clip -> NDC).
+        template<typename T>
+        void transform_points(const Matrix<T, 4, 4>& mat, const soa::ConstVectorView<T, 3>& in, soa::VectorView<T, 3> out, T w, bool perspective_divide = false) {
+            typedef simd::packet<T> P;
+            const T* const src[3] = { in.lane(0), in.lane(1), in.lane(2) };
+            const size_t src_stride[3] = { in.stride(), in.stride(), in.stride() };
+            T* const dst[3] = { out.lane(0), out.lane(1), out.lane(2) };
+            const size_t dst_stride[3] = { out.stride(), out.stride(), out.stride() };
+
+            const P m11 = simd::set1(mat.c_11), m12 = simd::set1(mat.c_12), m13 = simd::set1(mat.c_13), m14 = simd::set1(mat.c_14 * w);
+            const P m21 = simd::set1(mat.c_21), m22 = simd::set1(mat.c_22), m23 = simd::set1(mat.c_23), m24 = simd::set1(mat.c_24 * w);
+            const P m31 = simd::set1(mat.c_31), m32 = simd::set1(mat.c_32), m33 = simd::set1(mat.c_33), m34 = simd::set1(mat.c_34 * w);
+
+            if (perspective_divide) {
+                const P m41 = simd::set1(mat.c_41), m42 = simd::set1(mat.c_42), m43 = simd::set1(mat.c_43), m44 = simd::set1(mat.c_44 * w);
+                soa::detail::for_each_packet(out.size(), src, src_stride, dst, dst_stride,
+                    [=](const P* v, P* r) {
+                        const P inv_w = simd::set1(constants::one<T>) / (m41 * v[0] + m42 * v[1] + m43 * v[2] + m44);
+                        r[0] = (m11 * v[0] + m12 * v[1] + m13 * v[2] + m14) * inv_w;
+                        r[1] = (m21 * v[0] + m22 * v[1] + m23 * v[2] + m24) * inv_w;
+                        r[2] = (m31 * v[0] + m32 * v[1] + m33 * v[2] + m34) * inv_w;
+                    });
+            }
+            else {
+                soa::detail::for_each_packet(out.size(), src, src_stride, dst, dst_stride,
+                    [=](const P* v, P* r) {
+                        r[0] = m11 * v[0] + m12 * v[1] + m13 * v[2] + m14;
+                        r[1] = m21 * v[0] + m22 * v[1] + m23 * v[2] + m24;
+                        r[2] = m31 * v[0] + m32 * v[1] + m33 * v[2] + m34;
+                    });
+            }
+        }
+        namespace detail {
+            // AoS loop: transposing interleaved points into packets costs more than the math itself,
+            // so this is a plain loop with the matrix hoisted into locals (stores to out can't alias them).
+            // V is Vector<T,3> or a padded Vector<T,3>.
+            template<typename T, typename V>
+            void transform_points_aos(const Matrix<T, 4, 4>& mat, const V* in, V* out, size_t count, T w, bool perspective_divide) {
+                const T c11 = mat.c_11, c12 = mat.c_12, c13 = mat.c_13, c14 = mat.c_14 * w;
+                const T c21 = mat.c_21, c22 = mat.c_22, c23 = mat.c_23, c24 = mat.c_24 * w;
+                const T c31 = mat.c_31, c32 = mat.c_32, c33 = mat.c_33, c34 = mat.c_34 * w;
+                if (perspective_divide) {
+                    const T c41 = mat.c_41, c42 = mat.c_42, c43 = mat.c_43, c44 = mat.c_44 * w;
+                    for (size_t n = 0; n < count; n++) {
+                        const T x = in[n].x, y = in[n].y, z = in[n].z;
+                        const T inv_w = constants::one<T> / (c41 * x + c42 * y + c43 * z + c44);
+                        out[n].x = (c11 * x + c12 * y + c13 * z + c14) * inv_w;
+                        out[n].y = (c21 * x + c22 * y + c23 * z + c24) * inv_w;
+                        out[n].z = (c31 * x + c32 * y + c33 * z + c34) * inv_w;
+                    }
+                }
+                else {
+                    for (size_t n = 0; n < count; n++) {
+                        const T x = in[n].x, y = in[n].y, z = in[n].z;
+                        out[n].x = c11 * x + c12 * y + c13 * z + c14;
+                        out[n].y = c21 * x + c22 * y + c23 * z + c24;
+                        out[n].z = c31 * x + c32 * y + c33 * z + c34;
+                    }
+                }
+            }
+        }
+
+        // AoS overload, see detail::transform_points_aos
+        template<typename T>
+        void transform_points(const Matrix<T, 4, 4>& mat, const Vector<T, 3>* in, Vector<T, 3>* out, size_t count, T w, bool perspective_divide = false) {
+            detail::transform_points_aos(mat, in, out, count, w, perspective_divide);
+        }
+        // Padded AoS overload (Vec3A): each point is one aligned 128-bit load, weighted into the matrix columns
+        // with the same sums in the same order as above, and stored whole. The padding lane of out is overwritten.
+        template<typename T, size_t A>
+        void transform_points(const Matrix<T, 4, 4>& mat, const Aligned<Vector<T, 3>, A>* in, Aligned<Vector<T, 3>, A>* out, size_t count, T w, bool perspective_divide = false) {
+#if defined(LAML_SIMD_SSE)
+            if constexpr (std::is_same<T, float>::value && A % 16 == 0) {
+                const __m128 c0 = _mm_loadu_ps(&mat._data[0]);
+                const __m128 c1 = _mm_loadu_ps(&mat._data[4]);
+                const __m128 c2 = _mm_loadu_ps(&mat._data[8]);
+                const __m128 c3 = _mm_mul_ps(_mm_loadu_ps(&mat._data[12]), _mm_set1_ps(w));
+                const __m128 one = _mm_set1_ps(1.0f);
+                for (size_t n = 0; n < count; n++) {
+                    const __m128 v = _mm_load_ps(in[n]._data);
+                    __m128 r =     _mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00));
+                    r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+                    r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)));
+                    r = _mm_add_ps(r, c3);
+                    if (perspective_divide) {
+                        r = _mm_mul_ps(r, _mm_div_ps(one, _mm_shuffle_ps(r, r, 0xFF)));
+                    }
+                    _mm_store_ps(reinterpret_cast<float*>(&out[n]), r);
+                }
+                return;
+            }
+#endif
+            detail::transform_points_aos(mat, in, out, count, w, perspective_divide);
+        }
+
         // convert to quaternion
         template<typename T>
-        Quaternion<T> quat_from_mat(const Matrix<T, 3, 3>& mat) {
+        constexpr Quaternion<T> quat_from_mat(const Matrix<T, 3, 3>& mat) {
                        const T one = constants::one<T>;
                        const T two = constants::two<T>;
                        const T four = static_cast<T>(4.0);
@@ -89,46 +180,43 @@ namespace laml {
                        T tr = trace(mat);
                        Quaternion<T> res;
                        if (tr > 0) {
-                           T S = sqrt(tr + one) * two; // S = 4*qw
-                           res.w = one_fourth * S;
-                           res.x = (mat.c_32 - mat.c_23) / S;
-                           res.y = (mat.c_13 - mat.c_31) / S;
-                           res.z = (mat.c_21 - mat.c_12) / S;
+                           T S = cx::sqrt(tr + one) * two; // S = 4*qw
+                           res[3] = one_fourth * S;
+                           res[0] = (mat[1][2] - mat[2][1]) / S;
+                           res[1] = (mat[2][0] - mat[0][2]) / S;
+                           res[2] = (mat[0][1] - mat[1][0]) / S;
                        }
-                       else if ((mat.c_11 > mat.c_22) && (mat.c_11 > mat.c_33)) {
-                           T S = sqrt(one + mat.c_11 - mat.c_22 - mat.c_33) * two; // S = 4*qx
-                           res.w = (mat.c_32 - mat.c_23) / S;
-                           res.x = one_fourth * S;
-                           res.y = (mat.c_12 + mat.c_21) / S;
-                           res.z = (mat.c_13 + mat.c_31) / S;
+                       else if ((mat[0][0] > mat[1][1]) && (mat[0][0] > mat[2][2])) {
+                           T S = cx::sqrt(one + mat[0][0] - mat[1][1] - mat[2][2]) * two; // S = 4*qx
+                           res[3] = (mat[1][2] - mat[2][1]) / S;
+                           res[0] = one_fourth * S;
+                           res[1] = (mat[1][0] + mat[0][1]) / S;
+                           res[2] = (mat[2][0] + mat[0][2]) / S;
                        }
-                       else if (mat.c_22 > mat.c_33) {
-                           T S = sqrt(one + mat.c_22 - mat.c_11 - mat.c_33) * two; // S = 4*qy
-                           res.w = (mat.c_13 - mat.c_31) / S;
-                           res.x = (mat.c_12 + mat.c_21) / S;
-                           res.y = one_fourth * S;
-                           res.z = (mat.c_23 + mat.c_32) / S;
+                       else if (mat[1][1] > mat[2][2]) {
+                           T S = cx::sqrt(one + mat[1][1] - mat[0][0] - mat[2][2]) * two; // S = 4*qy
+                           res[3] = (mat[2][0] - mat[0][2]) / S;
+                           res[0] = (mat[1][0] + mat[0][1]) / S;
+                           res[1] = one_fourth * S;
+                           res[2] = (mat[2][1] + mat[1][2]) / S;
                        }
                        else {
-                           T S = sqrt(one + mat.c_33 - mat.c_11 - mat.c_22) * two; // S = 4*qz
-                           res.w = (mat.c_21 - mat.c_12) / S;
-                           res.x = (mat.c_13 + mat.c_31) / S;
-                           res.y = (mat.c_23 + mat.c_32) / S;
-                           res.z = one_fourth * S;
+                           T S = cx::sqrt(one + mat[2][2] - mat[0][0] - mat[1][1]) * two; // S = 4*qz
+                           res[3] = (mat[0][1] - mat[1][0]) / S;
+                           res[0] = (mat[2][0] + mat[0][2]) / S;
+                           res[1] = (mat[2][1] + mat[1][2]) / S;
+                           res[2] = one_fourth * S;
                        }
                        return res;
         }
 
         // Create various 4x4 transformation matrices
-        template<typename T>
-        void create_transform_rotation(Matrix<T, 4, 4>& mat, T yaw, T pitch, T roll) {
-            T C1, C2, C3, S1, S2, S3;
-            C1 = cosf(yaw * constants::deg2rad<T>);
-            C2 = cosf(pitch * constants::deg2rad<T>);
-            C3 = cosf(roll * constants::deg2rad<T>);
-            S1 = sinf(yaw * constants::deg2rad<T>);
-            S2 = sinf(pitch * constants::deg2rad<T>);
-            S3 = sinf(roll * constants::deg2rad<T>);
+        template<typename T, typename Math = math::default_policy>
+        constexpr void create_transform_rotation(Matrix<T, 4, 4>& mat, T yaw, T pitch, T roll, Math = Math()) {
+            T S1 = 0, S2 = 0, S3 = 0, C1 = 0, C2 = 0, C3 = 0;
+            Math::sincos(yaw * constants::deg2rad<T>, S1, C1);
+            Math::sincos(pitch * constants::deg2rad<T>, S2, C2);
+            Math::sincos(roll * constants::deg2rad<T>, S3, C3);
 
             mat = Matrix<T, 4, 4>(constants::one<T>); // create identity matrix
             mat[0][0] = C1 * C3 - S1 * S2 * S3;
@@ -143,15 +231,12 @@ namespace laml {
             mat[2][1] = -S2;
             mat[2][2] = C1 * C2;
         }
-        template<typename T>
-        void create_transform_rotation(Matrix<T, 3, 3>& mat, T yaw, T pitch, T roll) {
-            T C1, C2, C3, S1, S2, S3;
-            C1 = cos(yaw * constants::deg2rad<T>);
-            C2 = cos(pitch * constants::deg2rad<T>);
-            C3 = cos(roll * constants::deg2rad<T>);
-            S1 = sin(yaw * constants::deg2rad<T>);
-            S2 = sin(pitch * constants::deg2rad<T>);
-            S3 = sin(roll * constants::deg2rad<T>);
+        template<typename T, typename Math = math::default_policy>
+        constexpr void create_transform_rotation(Matrix<T, 3, 3>& mat, T yaw, T pitch, T roll, Math = Math()) {
+            T S1 = 0, S2 = 0, S3 = 0, C1 = 0, C2 = 0, C3 = 0;
+            Math::sincos(yaw * constants::deg2rad<T>, S1, C1);
+            Math::sincos(pitch * constants::deg2rad<T>, S2, C2);
+            Math::sincos(roll * constants::deg2rad<T>, S3, C3);
 
             mat = Matrix<T, 3, 3>(constants::one<T>); // create identity matrix
             mat[0][0] = C1 * C3 - S1 * S2 * S3;
@@ -167,14 +252,13 @@ namespace laml {
             mat[2][2] = C1 * C2;
         }
         template<typename T>
-        void create_ZXZ_rotation(Matrix<T, 3, 3>& mat, T alpha, T beta, T gamma) {
-            T C1, C2, C3, S1, S2, S3;
-            C1 = cosd(alpha);
-            C2 = cosd(beta);
-            C3 = cosd(gamma);
-            S1 = sind(alpha);
-            S2 = sind(beta);
-            S3 = sind(gamma);
+        constexpr void create_ZXZ_rotation(Matrix<T, 3, 3>& mat, T alpha, T beta, T gamma) {
+            const T C1 = cx::cos(alpha * constants::deg2rad<T>);
+            const T C2 = cx::cos(beta * constants::deg2rad<T>);
+            const T C3 = cx::cos(gamma * constants::deg2rad<T>);
+            const T S1 = cx::sin(alpha * constants::deg2rad<T>);
+            const T S2 = cx::sin(beta * constants::deg2rad<T>);
+            const T S3 = cx::sin(gamma * constants::deg2rad<T>);
 
             // mat[j][i] = c_ij (zero-indexed)
             mat = Matrix<T, 3, 3>(constants::one<T>); // create identity matrix
@@ -191,153 +275,290 @@ namespace laml {
             mat[2][2] = C2;
         }
         template<typename T>
-        void create_transform_rotation(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat) {
+        constexpr void create_transform_rotation(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat) {
             mat = Matrix<T, 4, 4>(constants::one<T>);
-            mat[0][0] = 1 - 2 * (rot_quat.y * rot_quat.y) - 2 * (rot_quat.z * rot_quat.z);
-            mat[0][1] = 2 * (rot_quat.x * rot_quat.y + rot_quat.z * rot_quat.w);
-            mat[0][2] = 2 * (rot_quat.z * rot_quat.x - rot_quat.y * rot_quat.w);
-            mat[1][0] = 2 * (rot_quat.x * rot_quat.y - rot_quat.z * rot_quat.w);
-            mat[1][1] = 1 - 2 * (rot_quat.z * rot_quat.z) - 2 * (rot_quat.x * rot_quat.x);
-            mat[1][2] = 2 * (rot_quat.y * rot_quat.z + rot_quat.x * rot_quat.w);
-            mat[2][0] = 2 * (rot_quat.z * rot_quat.x + rot_quat.y * rot_quat.w);
-            mat[2][1] = 2 * (rot_quat.y * rot_quat.z - rot_quat.x * rot_quat.w);
-            mat[2][2] = 1 - 2 * (rot_quat.x * rot_quat.x) - 2 * (rot_quat.y * rot_quat.y);
-        }
-        template<typename T>
-        void create_transform_rotation(Matrix<T, 3, 3>& mat, const Quaternion<T>& rot_quat) {
+            mat[0][0] = 1 - 2 * (rot_quat[1] * rot_quat[1]) - 2 * (rot_quat[2] * rot_quat[2]);
+            mat[0][1] = 2 * (rot_quat[0] * rot_quat[1] + rot_quat[2] * rot_quat[3]);
+            mat[0][2] = 2 * (rot_quat[2] * rot_quat[0] - rot_quat[1] * rot_quat[3]);
+            mat[1][0] = 2 * (rot_quat[0] * rot_quat[1] - rot_quat[2] * rot_quat[3]);
+            mat[1][1] = 1 - 2 * (rot_quat[2] * rot_quat[2]) - 2 * (rot_quat[0] * rot_quat[0]);
+            mat[1][2] = 2 * (rot_quat[1] * rot_quat[2] + rot_quat[0] * rot_quat[3]);
+            mat[2][0] = 2 * (rot_quat[2] * rot_quat[0] + rot_quat[1] * rot_quat[3]);
+            mat[2][1] = 2 * (rot_quat[1] * rot_quat[2] - rot_quat[0] * rot_quat[3]);
+            mat[2][2] = 1 - 2 * (rot_quat[0] * rot_quat[0]) - 2 * (rot_quat[1] * rot_quat[1]);
+        }
+        template<typename T>
+        constexpr void create_transform_rotation(Matrix<T, 3, 3>& mat, const Quaternion<T>& rot_quat) {
             mat = Matrix<T, 3, 3>(constants::one<T>);
-            mat[0][0] = 1 - 2 * (rot_quat.y * rot_quat.y) - 2 * (rot_quat.z * rot_quat.z);
-            mat[0][1] = 2 * (rot_quat.x * rot_quat.y + rot_quat.z * rot_quat.w);
-            mat[0][2] = 2 * (rot_quat.z * rot_quat.x - rot_quat.y * rot_quat.w);
-            mat[1][0] = 2 * (rot_quat.x * rot_quat.y - rot_quat.z * rot_quat.w);
-            mat[1][1] = 1 - 2 * (rot_quat.z * rot_quat.z) - 2 * (rot_quat.x * rot_quat.x);
-            mat[1][2] = 2 * (rot_quat.y * rot_quat.z + rot_quat.x * rot_quat.w);
-            mat[2][0] = 2 * (rot_quat.z * rot_quat.x + rot_quat.y * rot_quat.w);
-            mat[2][1] = 2 * (rot_quat.y * rot_quat.z - rot_quat.x * rot_quat.w);
-            mat[2][2] = 1 - 2 * (rot_quat.x * rot_quat.x) - 2 * (rot_quat.y * rot_quat.y);
+            mat[0][0] = 1 - 2 * (rot_quat[1] * rot_quat[1]) - 2 * (rot_quat[2] * rot_quat[2]);
+            mat[0][1] = 2 * (rot_quat[0] * rot_quat[1] + rot_quat[2] * rot_quat[3]);
+            mat[0][2] = 2 * (rot_quat[2] * rot_quat[0] - rot_quat[1] * rot_quat[3]);
+            mat[1][0] = 2 * (rot_quat[0] * rot_quat[1] - rot_quat[2] * rot_quat[3]);
+            mat[1][1] = 1 - 2 * (rot_quat[2] * rot_quat[2]) - 2 * (rot_quat[0] * rot_quat[0]);
+            mat[1][2] = 2 * (rot_quat[1] * rot_quat[2] + rot_quat[0] * rot_quat[3]);
+            mat[2][0] = 2 * (rot_quat[2] * rot_quat[0] + rot_quat[1] * rot_quat[3]);
+            mat[2][1] = 2 * (rot_quat[1] * rot_quat[2] - rot_quat[0] * rot_quat[3]);
+            mat[2][2] = 1 - 2 * (rot_quat[0] * rot_quat[0]) - 2 * (rot_quat[1] * rot_quat[1]);
         }
 
         template<typename T>
-        void create_transform_scale(Matrix<T, 4, 4>& mat, T x_scale, T y_scale, T z_scale) {
+        constexpr void create_transform_scale(Matrix<T, 4, 4>& mat, T x_scale, T y_scale, T z_scale) {
             mat = Matrix<T, 4, 4>(x_scale, y_scale, z_scale, constants::one<T>);
         }
         template<typename T>
-        void create_transform_scale(Matrix<T, 4, 4>& mat, const Vector<T, 3>& scale_vec) {
-            mat = Matrix<T, 4, 4>(scale_vec.x, scale_vec.y, scale_vec.z, constants::one<T>);
+        constexpr void create_transform_scale(Matrix<T, 4, 4>& mat, const Vector<T, 3>& scale_vec) {
+            mat = Matrix<T, 4, 4>(scale_vec[0], scale_vec[1], scale_vec[2], constants::one<T>);
         }
 
         template<typename T>
-        void create_transform_translate(Matrix<T, 4, 4>& mat, T x_trans, T y_trans, T z_trans) {
+        constexpr void create_transform_translate(Matrix<T, 4, 4>& mat, T x_trans, T y_trans, T z_trans) {
             mat = Matrix<T, 4, 4>(constants::one<T>);
-            mat.c_14 = x_trans;
-            mat.c_24 = y_trans;
-            mat.c_34 = z_trans;
+            mat[3][0] = x_trans;
+            mat[3][1] = y_trans;
+            mat[3][2] = z_trans;
         }
         template<typename T>
-        void create_transform_translate(Matrix<T, 4, 4>& mat, const Vector<T, 3>& trans_vec) {
+        constexpr void create_transform_translate(Matrix<T, 4, 4>& mat, const Vector<T, 3>& trans_vec) {
             mat = Matrix<T, 4, 4>(constants::one<T>);
-            mat.c_14 = trans_vec.x;
-            mat.c_24 = trans_vec.y;
-            mat.c_34 = trans_vec.z;
+            mat[3][0] = trans_vec[0];
+            mat[3][1] = trans_vec[1];
+            mat[3][2] = trans_vec[2];
         }
 
         // Basic order of arguments is always rotation,translation,scale
         // If any component is missed, it is assumed "identity"
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 4, 4>& rot_mat, const Matrix<T, 4, 4>& trans_mat, const Matrix<T, 4, 4>& scale_mat) {
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 4, 4>& rot_mat, const Matrix<T, 4, 4>& trans_mat, const Matrix<T, 4, 4>& scale_mat) {
             mat = mul(mul(trans_mat, rot_mat), scale_mat);
         }
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 4, 4>& rot_mat, const Matrix<T, 4, 4>& trans_mat) {
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 4, 4>& rot_mat, const Matrix<T, 4, 4>& trans_mat) {
             mat = mul(trans_mat, rot_mat);
         }
 
+        // The overloads below write T * R * S straight into mat: R's columns scaled by S, then T in the last column.
+        // Same values as the matrix products above, without the temporaries and the multiplies by 0 and 1.
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, T rot_yaw, T rot_pitch, T rot_roll, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
-            Matrix<T, 4, 4> rot_mat, trans_mat, scale_mat;
-
-            create_transform_rotation(rot_mat, rot_yaw, rot_pitch, rot_roll);
-            create_transform_translate(trans_mat, trans_vec);
-            create_transform_scale(scale_mat, scale_vec);
-
-            create_transform(mat, rot_mat, trans_mat, scale_mat);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, T rot_yaw, T rot_pitch, T rot_roll, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
+            create_transform_rotation(mat, rot_yaw, rot_pitch, rot_roll);
+            for (size_t n = 0; n < 3; n++) {
+                mat[0][n] = mat[0][n] * scale_vec[0];
+                mat[1][n] = mat[1][n] * scale_vec[1];
+                mat[2][n] = mat[2][n] * scale_vec[2];
+            }
+            mat[3][0] = trans_vec[0];
+            mat[3][1] = trans_vec[1];
+            mat[3][2] = trans_vec[2];
         }
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 3, 3>& rot_mat3, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
-            Matrix<T, 4, 4> trans_mat, scale_mat;
-
-            Matrix<T, 4, 4> rot_mat(rot_mat3);
-            create_transform_translate(trans_mat, trans_vec);
-            create_transform_scale(scale_mat, scale_vec);
-
-            create_transform(mat, rot_mat, trans_mat, scale_mat);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 3, 3>& rot_mat3, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
+            const T zero = constants::zero<T>;
+            mat = Matrix<T, 4, 4>(
+                rot_mat3[0][0] * scale_vec[0], rot_mat3[0][1] * scale_vec[0], rot_mat3[0][2] * scale_vec[0], zero,
+                rot_mat3[1][0] * scale_vec[1], rot_mat3[1][1] * scale_vec[1], rot_mat3[1][2] * scale_vec[1], zero,
+                rot_mat3[2][0] * scale_vec[2], rot_mat3[2][1] * scale_vec[2], rot_mat3[2][2] * scale_vec[2], zero,
+                trans_vec[0], trans_vec[1], trans_vec[2], constants::one<T>);
         }
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
-            Matrix<T, 4, 4> rot_mat, trans_mat, scale_mat;
-
-            create_transform_rotation(rot_mat, rot_quat);
-            create_transform_translate(trans_mat, trans_vec);
-            create_transform_scale(scale_mat, scale_vec);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat, const Vector<T, 3>& trans_vec, const Vector<T, 3>& scale_vec) {
+            const T one = constants::one<T>;
+            const T two = constants::two<T>;
+            const T zero = constants::zero<T>;
+            const T xx = rot_quat[0] * rot_quat[0], yy = rot_quat[1] * rot_quat[1], zz = rot_quat[2] * rot_quat[2];
+            const T xy = rot_quat[0] * rot_quat[1], yz = rot_quat[1] * rot_quat[2], zx = rot_quat[2] * rot_quat[0];
+            const T xw = rot_quat[0] * rot_quat[3], yw = rot_quat[1] * rot_quat[3], zw = rot_quat[2] * rot_quat[3];
 
-            create_transform(mat, rot_mat, trans_mat, scale_mat);
+            // same expressions as create_transform_rotation
+            mat = Matrix<T, 4, 4>(
+                (one - two * yy - two * zz) * scale_vec[0], two * (xy + zw) * scale_vec[0], two * (zx - yw) * scale_vec[0], zero,
+                two * (xy - zw) * scale_vec[1], (one - two * zz - two * xx) * scale_vec[1], two * (yz + xw) * scale_vec[1], zero,
+                two * (zx + yw) * scale_vec[2], two * (yz - xw) * scale_vec[2], (one - two * xx - two * yy) * scale_vec[2], zero,
+                trans_vec[0], trans_vec[1], trans_vec[2], one);
         }
 
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, T rot_yaw, T rot_pitch, T rot_roll, const Vector<T, 3>& trans_vec) {
-            Matrix<T, 4, 4> rot_mat, trans_mat;
-
-            create_transform_rotation(rot_mat, rot_yaw, rot_pitch, rot_roll);
-            create_transform_translate(trans_mat, trans_vec);
-
-            create_transform(mat, rot_mat, trans_mat);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, T rot_yaw, T rot_pitch, T rot_roll, const Vector<T, 3>& trans_vec) {
+            create_transform_rotation(mat, rot_yaw, rot_pitch, rot_roll);
+            mat[3][0] = trans_vec[0];
+            mat[3][1] = trans_vec[1];
+            mat[3][2] = trans_vec[2];
         }
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 3, 3>& rot_mat3, const Vector<T, 3>& trans_vec) {
-            Matrix<T, 4, 4> trans_mat;
-
-            Matrix<T, 4, 4> rot_mat(rot_mat3);
-            create_transform_translate(trans_mat, trans_vec);
-
-            create_transform(mat, rot_mat, trans_mat);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Matrix<T, 3, 3>& rot_mat3, const Vector<T, 3>& trans_vec) {
+            mat = Matrix<T, 4, 4>(rot_mat3);
+            mat[3][0] = trans_vec[0];
+            mat[3][1] = trans_vec[1];
+            mat[3][2] = trans_vec[2];
         }
         template<typename T>
-        void create_transform(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat, const Vector<T, 3>& trans_vec) {
-            Matrix<T, 4, 4> rot_mat, trans_mat;
-
-            create_transform_rotation(rot_mat, rot_quat);
-            create_transform_translate(trans_mat, trans_vec);
+        constexpr void create_transform(Matrix<T, 4, 4>& mat, const Quaternion<T>& rot_quat, const Vector<T, 3>& trans_vec) {
+            create_transform_rotation(mat, rot_quat);
+            mat[3][0] = trans_vec[0];
+            mat[3][1] = trans_vec[1];
+            mat[3][2] = trans_vec[2];
+        }
 
-            create_transform(mat, rot_mat, trans_mat);
+        // Batched create_transform(mat, rot_quat, trans_vec, scale_vec) over arrays of TRS
+        template<typename T>
+        void create_transforms(Matrix<T, 4, 4>* mats, const Quaternion<T>* rot_quats, const Vector<T, 3>* trans_vecs, const Vector<T, 3>* scale_vecs, size_t count) {
+            for (size_t n = 0; n < count; n++) {
+                create_transform(mats[n], rot_quats[n], trans_vecs[n], scale_vecs[n]);
+            }
         }
 
 
         template<typename T>
-        laml::Quat quat_from_axis_angle(const laml::Vec3& axis, T angle) {
+        constexpr laml::Quat quat_from_axis_angle(const laml::Vec3& axis, T angle) {
             // angle in degrees
             T half_angle = angle * static_cast<T>(0.5);
-            T c = laml::cosd(half_angle);
-            T s = laml::sind(half_angle);
+            T c = cx::cos(half_angle * constants::deg2rad<T>);
+            T s = cx::sin(half_angle * constants::deg2rad<T>);
 
-            laml::Quat ret(s*axis.x, s*axis.y, s*axis.z, c);
+            laml::Quat ret(s*axis[0], s*axis[1], s*axis[2], c);
 
             return laml::normalize(ret);
         }
 
-        template<typename T>
-        laml::Quat quat_from_ypr(T yaw, T pitch, T roll) {
+        template<typename T, typename Math = math::default_policy>
+        constexpr laml::Quat quat_from_ypr(T yaw, T pitch, T roll, Math = Math()) {
             // angles in degrees
+            // Product of the three half-angle rotations, the same rotation create_transform_rotation builds.
+            // q and -q are the same rotation; the sign here follows the angles continuously.
+            const T half = constants::deg2rad<T> * static_cast<T>(0.5);
+            T sy = 0, sp = 0, sr = 0, cy = 0, cp = 0, cr = 0;
+            Math::sincos(yaw * half, sy, cy);
+            Math::sincos(pitch * half, sp, cp);
+            Math::sincos(roll * half, sr, cr);
+
+            return laml::Quat(cy * sp * cr - sy * cp * sr,
+                              cy * sp * sr + sy * cp * cr,
+                              -cy * cp * sr - sy * sp * cr,
+                              cy * cp * cr - sy * sp * sr);
+        }
+
+        namespace detail {
+            // create_transform_rotation(mat, yaw, pitch, roll) for a packet of entities: a[] holds yaw, pitch, roll
+            // in degrees, r[] gets the 9 entries column by column, same expressions as the single version
+            template<typename T>
+            inline void ypr_rotation(const simd::packet<T>* a, simd::packet<T>* r) {
+                typedef simd::packet<T> P;
+                const P to_rad = simd::set1(constants::deg2rad<T>);
+                P S1, S2, S3, C1, C2, C3;
+                laml::fast::sincos(a[0] * to_rad, S1, C1);
+                laml::fast::sincos(a[1] * to_rad, S2, C2);
+                laml::fast::sincos(a[2] * to_rad, S3, C3);
+
+                r[0] = C1 * C3 - S1 * S2 * S3;
+                r[1] = -C2 * S3;
+                r[2] = -S1 * C3 - C1 * S2 * S3;
+                r[3] = C1 * S3 + S1 * S2 * C3;
+                r[4] = C2 * C3;
+                r[5] = -S1 * S3 + C1 * S2 * C3;
+                r[6] = S1 * C2;
+                r[7] = -S2;
+                r[8] = C1 * C2;
+            }
 
-            laml::Mat3 rot_mat;
-            laml::transform::create_transform_rotation(rot_mat, yaw, pitch, roll);
-
-            laml::Quat ret = laml::transform::quat_from_mat(rot_mat);
+            // quat_from_ypr for a packet of entities, x, y, z, w into r[]
+            template<typename T>
+            inline void ypr_quat(const simd::packet<T>* a, simd::packet<T>* r) {
+                typedef simd::packet<T> P;
+                const P half = simd::set1(constants::deg2rad<T> * static_cast<T>(0.5));
+                P sy, sp, sr, cy, cp, cr;
+                laml::fast::sincos(a[0] * half, sy, cy);
+                laml::fast::sincos(a[1] * half, sp, cp);
+                laml::fast::sincos(a[2] * half, sr, cr);
+
+                r[0] = cy * sp * cr - sy * cp * sr;
+                r[1] = cy * sp * sr + sy * cp * cr;
+                r[2] = -cy * cp * sr - sy * sp * cr;
+                r[3] = cy * cp * cr - sy * sp * sr;
+            }
+        }
 
-            return laml::normalize(ret);
+        /* Batched Euler-angle builders, one rotation per entity from arrays of yaw, pitch and roll in degrees.
+        * With math::fast the sines and cosines are computed simd::packet<T>::width entities at a time
+        * and written straight into the output array; math::precise calls the single versions in a loop.
+        * The precise trig has no packet form (it is the library sincos, lane by lane), and feeding it through
+        * SoA arrays into the packet assembly measured slower than the plain loop, so that stays as is.
+        * */
+        template<typename T, typename Math = math::default_policy>
+        void create_transform_rotations(Matrix<T, 3, 3>* mats, const T* yaws, const T* pitches, const T* rolls, size_t count, Math = Math()) {
+            if constexpr (Math::approximate) {
+                if (count == 0) return;
+                const T* const in[3] = { yaws, pitches, rolls };
+                const size_t in_stride[3] = { 1, 1, 1 };
+                T* res[9];
+                size_t res_stride[9];
+                for (size_t k = 0; k < 9; k++) {
+                    res[k] = mats->_data + k;  res_stride[k] = sizeof(Matrix<T, 3, 3>) / sizeof(T);
+                }
+                soa::detail::for_each_packet(count, in, in_stride, res, res_stride,
+                    [](const simd::packet<T>* a, simd::packet<T>* r) {
+                        detail::ypr_rotation<T>(a, r);
+                    });
+            } else {
+                for (size_t n = 0; n < count; n++) {
+                    create_transform_rotation(mats[n], yaws[n], pitches[n], rolls[n], Math());
+                }
+            }
+        }
+        template<typename T, typename Math = math::default_policy>
+        void create_transform_rotations(Matrix<T, 4, 4>* mats, const T* yaws, const T* pitches, const T* rolls, size_t count, Math = Math()) {
+            if constexpr (Math::approximate) {
+                if (count == 0) return;
+                const T* const in[3] = { yaws, pitches, rolls };
+                const size_t in_stride[3] = { 1, 1, 1 };
+                T* res[16];
+                size_t res_stride[16];
+                for (size_t k = 0; k < 16; k++) {
+                    res[k] = mats->_data + k;  res_stride[k] = sizeof(Matrix<T, 4, 4>) / sizeof(T);
+                }
+                // the identity around the 3x3 block is written in the same pass
+                soa::detail::for_each_packet(count, in, in_stride, res, res_stride,
+                    [](const simd::packet<T>* a, simd::packet<T>* r) {
+                        simd::packet<T> rot[9];
+                        detail::ypr_rotation<T>(a, rot);
+                        const simd::packet<T> zero = simd::set1(constants::zero<T>);
+                        for (size_t c = 0; c < 3; c++) {
+                            r[4 * c + 0] = rot[3 * c + 0];
+                            r[4 * c + 1] = rot[3 * c + 1];
+                            r[4 * c + 2] = rot[3 * c + 2];
+                            r[4 * c + 3] = zero;
+                        }
+                        r[12] = zero;
+                        r[13] = zero;
+                        r[14] = zero;
+                        r[15] = simd::set1(constants::one<T>);
+                    });
+            } else {
+                for (size_t n = 0; n < count; n++) {
+                    create_transform_rotation(mats[n], yaws[n], pitches[n], rolls[n], Math());
+                }
+            }
+        }
+        template<typename T, typename Math = math::default_policy>
+        void quats_from_ypr(Quaternion<T>* quats, const T* yaws, const T* pitches, const T* rolls, size_t count, Math = Math()) {
+            if constexpr (Math::approximate) {
+                if (count == 0) return;
+                const T* const in[3] = { yaws, pitches, rolls };
+                const size_t in_stride[3] = { 1, 1, 1 };
+                soa::VectorView<T, 4> out = soa::view(quats, count);
+                T* const res[4] = { out.lane(0), out.lane(1), out.lane(2), out.lane(3) };
+                const size_t res_stride[4] = { out.stride(), out.stride(), out.stride(), out.stride() };
+                soa::detail::for_each_packet(count, in, in_stride, res, res_stride,
+                    [](const simd::packet<T>* a, simd::packet<T>* r) {
+                        detail::ypr_quat<T>(a, r);
+                    });
+            } else {
+                for (size_t n = 0; n < count; n++) {
+                    quats[n] = quat_from_ypr(yaws[n], pitches[n], rolls[n], Math());
+                }
+            }
         }
 
         template<typename T>
-        laml::Vec3 dir_from_yp(T yaw, T pitch) {
+        constexpr laml::Vec3 dir_from_yp(T yaw, T pitch) {
             // angles in degrees
 
             laml::Mat3 rot_mat;
@@ -523,27 +744,27 @@ namespace laml {
         // note: this returns a transformation matrix, not a view matrix.
         //       use create_view_matrix_from_transform() if you need that
         template<typename T>
-        void lookAt(Matrix<T,4,4>& transform, const Vector<T,3>& start, const Vector<T,3>& target, const Vector<T,3>& ref_up) {
+        constexpr void lookAt(Matrix<T,4,4>& transform, const Vector<T,3>& start, const Vector<T,3>& target, const Vector<T,3>& ref_up) {
             Vector<T,3> forward = laml::normalize(target - start);
             Vector<T,3> right   = laml::normalize(laml::cross(forward, ref_up));
             Vector<T,3> up      = laml::normalize(laml::cross(right, forward));
 
             laml::identity(transform);
-            transform.c_11 = right.x;
-            transform.c_21 = right.y;
-            transform.c_31 = right.z;
+            transform[0][0] = right[0];
+            transform[0][1] = right[1];
+            transform[0][2] = right[2];
 
-            transform.c_12 = up.x;
-            transform.c_22 = up.y;
-            transform.c_32 = up.z;
+            transform[1][0] = up[0];
+            transform[1][1] = up[1];
+            transform[1][2] = up[2];
 
-            transform.c_13 = -forward.x;
-            transform.c_23 = -forward.y;
-            transform.c_33 = -forward.z;
+            transform[2][0] = -forward[0];
+            transform[2][1] = -forward[1];
+            transform[2][2] = -forward[2];
 
-            transform.c_14 = start.x;
-            transform.c_24 = start.y;
-            transform.c_34 = start.z;
+            transform[3][0] = start[0];
+            transform[3][1] = start[1];
+            transform[3][2] = start[2];
 
             /* glm::lookAt() -> returns a view matrix
             Vector<T,3> f = laml::normalize(center - eye);
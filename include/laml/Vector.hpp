@@ -9,6 +9,8 @@
 
 #include <laml/Data_types.hpp>
 #include <laml/Constants.hpp>
+#include <laml/Constexpr.hpp>
+#include <laml/FastMath.hpp>
 #include <math.h>
 
 namespace laml {
@@ -25,7 +27,7 @@ namespace laml {
         constexpr Vector() : _data { 0 } {}
 
         // Construct with float array
-        Vector(const float* in_data) {
+        constexpr Vector(const float* in_data) : _data{} {
             for (size_t n = 0; n < size; n++) {
                 _data[n] = static_cast<T>(in_data[n]);
             }
@@ -37,7 +39,7 @@ namespace laml {
 
         // Initialize with a Vector<> of a different type
         template<typename T_other>
-        Vector(const Vector<T_other, size>& other) {
+        constexpr Vector(const Vector<T_other, size>& other) : _data{} {
             for (size_t n = 0; n < size; n++) {
                 _data[n] = static_cast<T>(other[n]);
             }
@@ -45,22 +47,22 @@ namespace laml {
 
         // Initialize with single value for all
         template<class V = typename std::enable_if<size != 1, T>::type>
-        Vector(T value) {
+        constexpr Vector(T value) : _data{} {
             for (size_t n = 0; n < size; n++) {
                 _data[n] = value;
             }
         }
 
         //// access like an array
-        T& operator[](size_t idx) {
+        constexpr T& operator[](size_t idx) {
             return _data[idx];
         }
-        const T& operator[](size_t idx) const {
+        constexpr const T& operator[](size_t idx) const {
             return _data[idx];
         }
 
-        const T* data() const { return _data; }
-        T* data() { return _data; }
+        constexpr const T* data() const { return _data; }
+        constexpr T* data() { return _data; }
 
         T _data[size];
     };
@@ -70,7 +72,7 @@ namespace laml {
 * These are all component-wise operations
 * */
     template<typename T, size_t size>
-    Vector<T, size> operator+(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<T, size> operator+(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] + other[n];
@@ -79,7 +81,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator-(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<T, size> operator-(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] - other[n];
@@ -88,7 +90,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator*(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<T, size> operator*(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] * other[n];
@@ -97,7 +99,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator/(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<T, size> operator/(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] / other[n];
@@ -109,7 +111,7 @@ namespace laml {
 * Unary operators
 */
     template<typename T, size_t size>
-    Vector<T, size> operator-(const Vector<T, size>& vec) {
+    constexpr Vector<T, size> operator-(const Vector<T, size>& vec) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = -vec[n];
@@ -122,7 +124,7 @@ namespace laml {
 * These are all component-wise operations
 * */
     template<typename T, size_t size>
-    Vector<T, size> operator*(const Vector<T, size>& vec, const T& factor) {
+    constexpr Vector<T, size> operator*(const Vector<T, size>& vec, const T& factor) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] * factor;
@@ -131,7 +133,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator/(const Vector<T, size>& vec, const T& factor) {
+    constexpr Vector<T, size> operator/(const Vector<T, size>& vec, const T& factor) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] / factor;
@@ -140,7 +142,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator*(const T& factor, const Vector<T, size>& vec) {
+    constexpr Vector<T, size> operator*(const T& factor, const Vector<T, size>& vec) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] * factor;
@@ -149,7 +151,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> operator/(const T& factor, const Vector<T, size>& vec) {
+    constexpr Vector<T, size> operator/(const T& factor, const Vector<T, size>& vec) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] / factor;
@@ -162,7 +164,7 @@ namespace laml {
 * These are all component-wise operations that return arrays of booleans
 * */
     template<typename T, size_t size>
-    Vector<bool, size> operator>(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<bool, size> operator>(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<bool, size> res; // fill with falses?
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] > other[n];
@@ -171,7 +173,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<bool, size> operator<(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<bool, size> operator<(const Vector<T, size>& vec, const Vector<T, size>& other) {
         Vector<bool, size> res; // fill with falses?
         for (size_t n = 0; n < size; n++) {
             res[n] = vec[n] < other[n];
@@ -180,7 +182,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<bool, size> operator>=(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<bool, size> operator>=(const Vector<T, size>& vec, const Vector<T, size>& other) {
                                 Vector<bool, size> res; // fill with falses?
                                 for (size_t n = 0; n < size; n++) {
                                     res[n] = vec[n] >= other[n];
@@ -189,7 +191,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<bool, size> operator<=(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr Vector<bool, size> operator<=(const Vector<T, size>& vec, const Vector<T, size>& other) {
                                 Vector<bool, size> res; // fill with falses?
                                 for (size_t n = 0; n < size; n++) {
                                     res[n] = vec[n] <= other[n];
@@ -207,7 +209,7 @@ namespace laml {
     //	return res;
     //}
     template<typename T, size_t size>
-    bool operator==(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr bool operator==(const Vector<T, size>& vec, const Vector<T, size>& other) {
                 for (size_t n = 0; n < size; n++) {
                 if (vec[n] != other[n])
                 return false;
@@ -215,7 +217,7 @@ namespace laml {
                 return true;
     }
     template<typename T, size_t size>
-    bool operator!=(const Vector<T, size>& vec, const Vector<T, size>& other) {
+    constexpr bool operator!=(const Vector<T, size>& vec, const Vector<T, size>& other) {
                 for (size_t n = 0; n < size; n++) {
                 if (vec[n] == other[n])
                 return false;
@@ -261,7 +263,7 @@ namespace laml {
 
     // Free functions
     template<typename T, size_t size>
-    T dot(const Vector<T, size>& v1, const Vector<T, size>& v2) {
+    constexpr T dot(const Vector<T, size>& v1, const Vector<T, size>& v2) {
         T res = 0;
         for (size_t n = 0; n < size; n++) {
             res = res + (v1[n] * v2[n]);
@@ -270,7 +272,7 @@ namespace laml {
     }
 
     template<typename T>
-    Vector<T, 3> cross(const Vector<T, 3>& v1, const Vector<T, 3>& v2) {
+    constexpr Vector<T, 3> cross(const Vector<T, 3>& v1, const Vector<T, 3>& v2) {
         Vector<T, 3> res;
         res[0] = v1[1] * v2[2] - v1[2] * v2[1];
         res[1] = v1[2] * v2[0] - v1[0] * v2[2];
@@ -279,7 +281,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    T length_sq(const Vector<T, size>& v) {
+    constexpr T length_sq(const Vector<T, size>& v) {
         T res = 0;
         for (size_t n = 0; n < size; n++) {
             res = res + (v[n] * v[n]);
@@ -288,21 +290,31 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    T length(const Vector<T, size>& v) {
-        return static_cast<T>(sqrt(length_sq(v)));
+    constexpr T length(const Vector<T, size>& v) {
+        return cx::sqrt(length_sq(v));
     }
 
-    template<typename T, size_t size>
-    Vector<T, size> normalize(const Vector<T, size>& v) {
-        T mag = length(v);
-        if (laml::abs(mag) < laml::eps<T>) {
-            return Vector<T, size>(static_cast<T>(0.0));
+    template<typename T, size_t size, typename Math = math::default_policy>
+    constexpr Vector<T, size> normalize(const Vector<T, size>& v, Math = Math()) {
+        if constexpr (Math::approximate) {
+            // one reciprocal square root and a multiply
+            const T mag_sq = length_sq(v);
+            if (mag_sq < laml::eps<T> * laml::eps<T>) {
+                return Vector<T, size>(static_cast<T>(0.0));
+            }
+            return v * Math::rsqrt(mag_sq);
+        }
+        else {
+            T mag = length(v);
+            if (mag < laml::eps<T>) {
+                return Vector<T, size>(static_cast<T>(0.0));
+            }
+            return (v / mag);
         }
-        return (v / mag);
     }
 
     template<typename T, size_t size>
-    T min(const Vector<T, size>& v) {
+    constexpr T min(const Vector<T, size>& v) {
         T min_val = v[0];
         for (size_t n = 1; n < size; n++) {
             if (v[n] < min_val) min_val = v[n];
@@ -311,7 +323,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    T max(const Vector<T, size>& v) {
+    constexpr T max(const Vector<T, size>& v) {
         T max_val = v[0];
         for (size_t n = 1; n < size; n++) {
             if (v[n] > max_val) max_val = v[n];
@@ -320,7 +332,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> abs(const Vector<T, size>& v) {
+    constexpr Vector<T, size> abs(const Vector<T, size>& v) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = v[n] > static_cast<T>(0.0) ? v[n] : -v[n];
@@ -329,7 +341,7 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> clamp(const Vector<T, size>& v, T min_val, T max_val) {
+    constexpr Vector<T, size> clamp(const Vector<T, size>& v, T min_val, T max_val) {
         Vector<T, size> res;
         for (size_t n = 0; n < size; n++) {
             res[n] = v[n] > max_val ? max_val : (v[n] < min_val ? min_val : v[n]);
@@ -338,19 +350,19 @@ namespace laml {
     }
 
     template<typename T, size_t size>
-    Vector<T, size> lerp(const Vector<T, size>& v1, const Vector<T, size>& v2, T factor) {
+    constexpr Vector<T, size> lerp(const Vector<T, size>& v1, const Vector<T, size>& v2, T factor) {
         return v2 * factor + v1 * (static_cast<T>(1.0) - factor);
     }
 
     template<size_t size>
-    bool any(const Vector<bool, size>& v) {
+    constexpr bool any(const Vector<bool, size>& v) {
         for (size_t n = 0; n < size; n++) {
             if (v[n]) return true;
         }
         return false;
     }
     template<size_t size>
-    bool all(const Vector<bool, size>& v) {
+    constexpr bool all(const Vector<bool, size>& v) {
         for (size_t n = 0; n < size; n++) {
             if (!v[n]) return false;
         }
@@ -363,20 +375,20 @@ namespace laml {
         constexpr Vector() : _data { 0, 0 } {}
         constexpr Vector(T _x, T _y) : _data { _x, _y } {}
         constexpr Vector(T _x) : _data { _x, _x } {}
-        Vector(const float* in_data) : _data { in_data[0], in_data[1] } {}
+        constexpr Vector(const float* in_data) : _data { in_data[0], in_data[1] } {}
 
         template<typename T_other>
-        Vector(const Vector<T_other, 2>& other) : _data {static_cast<T>(other.x), static_cast<T>(other.y)} {}
+        constexpr Vector(const Vector<T_other, 2>& other) : _data {static_cast<T>(other[0]), static_cast<T>(other[1])} {}
 
         union {
             T _data[2];
             struct { T x, y; };
         };
 
-        T& operator[](size_t idx) {
+        constexpr T& operator[](size_t idx) {
             return _data[idx];
         }
-        const T& operator[](size_t idx) const {
+        constexpr const T& operator[](size_t idx) const {
             return _data[idx];
         }
     };
@@ -385,20 +397,20 @@ namespace laml {
         constexpr Vector() : _data { 0, 0, 0 } {}
         constexpr Vector(T _x, T _y, T _z) : _data { _x, _y, _z } {}
         constexpr Vector(T _x) : _data { _x, _x, _x } {}
-        Vector(const float* in_data) : _data { in_data[0], in_data[1], in_data[2] } {}
+        constexpr Vector(const float* in_data) : _data { in_data[0], in_data[1], in_data[2] } {}
 
         template<typename T_other>
-        Vector(const Vector<T_other, 3>& other) : _data {static_cast<T>(other.x), static_cast<T>(other.y), static_cast<T>(other.z)} {}
+        constexpr Vector(const Vector<T_other, 3>& other) : _data {static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2])} {}
 
         union {
             T _data[3];
             struct { T x, y, z; };
         };
 
-        T& operator[](size_t idx) {
+        constexpr T& operator[](size_t idx) {
             return _data[idx];
         }
-        const T& operator[](size_t idx) const {
+        constexpr const T& operator[](size_t idx) const {
             return _data[idx];
         }
     };
@@ -407,21 +419,21 @@ namespace laml {
         constexpr Vector() : _data { 0, 0, 0, 0 } {}
         constexpr Vector(T _x, T _y, T _z, T _w) : _data { _x, _y, _z, _w } {}
         constexpr Vector(T _x) : _data { _x, _x, _x, _x } {}
-        Vector(const float* in_data) : _data { in_data[0], in_data[1], in_data[2], in_data[3] } {}
-        constexpr Vector(const Vector<T, 3>& v, T w) : _data { v.x, v.y, v.z, w } {}
+        constexpr Vector(const float* in_data) : _data { in_data[0], in_data[1], in_data[2], in_data[3] } {}
+        constexpr Vector(const Vector<T, 3>& v, T w) : _data { v[0], v[1], v[2], w } {}
 
         template<typename T_other>
-        Vector(const Vector<T_other, 4>& other) : _data {static_cast<T>(other.x), static_cast<T>(other.y), static_cast<T>(other.z), static_cast<T>(other.w)} {}
+        constexpr Vector(const Vector<T_other, 4>& other) : _data {static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]), static_cast<T>(other[3])} {}
 
         union {
             T _data[4];
             struct { T x, y, z, w; };
         };
 
-        T& operator[](size_t idx) {
+        constexpr T& operator[](size_t idx) {
             return _data[idx];
         }
-        const T& operator[](size_t idx) const {
+        constexpr const T& operator[](size_t idx) const {
             return _data[idx];
         }
     };
@@ -7,8 +7,12 @@
 #endif
 
 #include <laml/Data_types.hpp>
+#include <laml/Simd.hpp>
+#include <laml/Constexpr.hpp>
+#include <laml/FastMath.hpp>
 
 #include <laml/Vector.hpp>
+#include <laml/Functions.hpp>
 
 #include <laml/Matrix_base.hpp>
 #include <laml/Matrix2.hpp>
@@ -16,10 +20,10 @@
 #include <laml/Matrix4.hpp>
 
 #include <laml/Quaternion.hpp>
+#include <laml/Aligned.hpp>
 
 #include <laml/Constants.hpp>
 #include <laml/Transform.hpp>
-
-#include <laml/Functions.hpp>
+#include <laml/Affine.hpp>
 
 #endif //__LAML_H
\ No newline at end of file
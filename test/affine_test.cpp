@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <random>
+
+#include "test_config.h"
+
+static void expect_equal(const laml::Affine3& aff, const laml::Mat4& ref) {
+	const laml::Mat4 mat = laml::to_matrix(aff);
+	for (size_t k = 0; k < 16; k++) {
+		EXPECT_EQ(mat._data[k], ref._data[k]);
+	}
+}
+
+static laml::Mat4 random_affine(std::mt19937& gen, std::uniform_real_distribution<float>& dis) {
+	laml::Mat4 mat;
+	for (size_t n = 0; n < 16; n++) {
+		mat._data[n] = dis(gen);
+	}
+	mat.c_41 = 0.0f; mat.c_42 = 0.0f; mat.c_43 = 0.0f; mat.c_44 = 1.0f;
+	return mat;
+}
+
+TEST(Affine, conversion) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	expect_equal(laml::Affine3(), laml::Mat4(1.0f));
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Mat4 mat = random_affine(gen, dis);
+		laml::Affine3 aff(mat);
+		expect_equal(aff, mat);
+		EXPECT_TRUE(laml::Affine3(laml::to_matrix(aff)) == aff);
+	}
+}
+
+TEST(Affine, mul_inverse) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Mat4 m1 = random_affine(gen, dis);
+		laml::Mat4 m2 = random_affine(gen, dis);
+		laml::Affine3 a1(m1), a2(m2);
+
+		expect_equal(laml::mul(a1, a2), laml::mul_affine(m1, m2));
+		expect_equal(laml::inverse(a1), laml::inverse_affine(m1));
+		// terms are up to 1e6, so compare against a double-precision determinant
+		laml::Mat3_highp m1_highp;
+		for (size_t k = 0; k < 9; k++) {
+			m1_highp._data[k] = laml::minor(m1, 3, 3)._data[k];
+		}
+		const double det_ref = laml::det(m1_highp);
+		EXPECT_NEAR(laml::det(a1), det_ref, 1.0);
+
+		laml::Mat4 rigid;
+		laml::Quat rot = laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+		laml::transform::create_transform(rigid, rot, laml::Vec3(dis(gen), dis(gen), dis(gen)));
+		expect_equal(laml::inverse_rigid(laml::Affine3(rigid)), laml::inverse_rigid(rigid));
+
+		const laml::Vec3 point(dis(gen), dis(gen), dis(gen));
+		const laml::Vec3 p = laml::transform::transform_point(a1, point);
+		const laml::Vec3 d = laml::transform::transform_direction(a1, point);
+		const laml::Vec3 p_ref = laml::transform::transform_point(m1, point, 1.0f);
+		const laml::Vec3 d_ref = laml::transform::transform_point(m1, point, 0.0f);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(p[k], p_ref[k]);
+			EXPECT_FLOAT_EQ(d[k], d_ref[k]);
+		}
+	}
+
+	// singular transforms come back unchanged
+	laml::Affine3 flat(1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3);
+	EXPECT_TRUE(laml::inverse(flat) == flat);
+}
+
+TEST(Affine, create_transform) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const laml::Quat rot = laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+		const laml::Vec3 trans(dis(gen), dis(gen), dis(gen));
+		const laml::Vec3 scale(dis(gen), dis(gen), dis(gen));
+		const float yaw = dis(gen), pitch = dis(gen), roll = dis(gen);
+		laml::Mat3 rot_mat3;
+		laml::transform::create_transform_rotation(rot_mat3, rot);
+
+		laml::Affine3 aff;
+		laml::Mat4 ref;
+		laml::transform::create_transform(aff, rot, trans, scale);
+		laml::transform::create_transform(ref, rot, trans, scale);
+		expect_equal(aff, ref);
+		laml::transform::create_transform(aff, rot, trans);
+		laml::transform::create_transform(ref, rot, trans);
+		expect_equal(aff, ref);
+		laml::transform::create_transform(aff, rot_mat3, trans, scale);
+		laml::transform::create_transform(ref, rot_mat3, trans, scale);
+		expect_equal(aff, ref);
+		laml::transform::create_transform(aff, rot_mat3, trans);
+		laml::transform::create_transform(ref, rot_mat3, trans);
+		expect_equal(aff, ref);
+		laml::transform::create_transform(aff, yaw, pitch, roll, trans, scale);
+		laml::transform::create_transform(ref, yaw, pitch, roll, trans, scale);
+		expect_equal(aff, ref);
+		laml::transform::create_transform(aff, yaw, pitch, roll, trans);
+		laml::transform::create_transform(ref, yaw, pitch, roll, trans);
+		expect_equal(aff, ref);
+
+		// decompose agrees with the 4x4 version
+		laml::transform::create_transform(aff, rot, trans, scale);
+		laml::transform::create_transform(ref, rot, trans, scale);
+		laml::Mat3 r, r_ref;
+		laml::Vec3 t, t_ref, s, s_ref;
+		EXPECT_TRUE(laml::transform::decompose(aff, r, t, s));
+		laml::transform::decompose(ref, r_ref, t_ref, s_ref);
+		for (size_t k = 0; k < 9; k++) {
+			EXPECT_EQ(r._data[k], r_ref._data[k]);
+		}
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_EQ(t[k], t_ref[k]);
+			EXPECT_EQ(s[k], s_ref[k]);
+		}
+	}
+}
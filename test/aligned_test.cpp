@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+static_assert(sizeof(laml::Vec3A) == 16 && alignof(laml::Vec3A) == 16, "Vec3A is one 128-bit lane");
+static_assert(sizeof(laml::Vec4A) == 16 && alignof(laml::Vec4A) == 16, "Vec4A");
+static_assert(sizeof(laml::QuatA) == 16 && alignof(laml::QuatA) == 16, "QuatA");
+static_assert(sizeof(laml::Mat4A) == 64 && alignof(laml::Mat4A) == 64, "Mat4A is one cache line");
+static_assert(sizeof(laml::Vec3A_highp) == 32 && alignof(laml::Vec3A_highp) == 32, "Vec3A_highp is one 256-bit lane");
+static_assert(sizeof(laml::Mat4A_highp) == 128 && alignof(laml::Mat4A_highp) == 64, "Mat4A_highp");
+
+// the padded types are usable at compile time too
+static_assert(laml::dot(laml::Vec3A(1.0f, 2.0f, 3.0f), laml::Vec3A(4.0f, 5.0f, 6.0f)) == 32.0f, "dot");
+static_assert(laml::cross(laml::Vec3A(1.0f, 0.0f, 0.0f), laml::Vec3A(0.0f, 1.0f, 0.0f)) == laml::Vec3(0.0f, 0.0f, 1.0f), "cross");
+
+template<typename T>
+static bool is_aligned(const T* p, size_t align) {
+	return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+TEST(Aligned, api) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		// every free function takes the padded types as they are and gives the same results
+		const laml::Vec3 a(dis(gen), dis(gen), dis(gen)), b(dis(gen), dis(gen), dis(gen));
+		const laml::Vec3A a_al(a), b_al = b;
+		EXPECT_TRUE(laml::Vec3(a_al + b_al) == a + b);
+		EXPECT_TRUE(laml::cross(a_al, b_al) == laml::cross(a, b));
+		EXPECT_EQ(laml::dot(a_al, b_al), laml::dot(a, b));
+		const laml::Vec3A c_al = laml::normalize(a_al);
+		EXPECT_TRUE(laml::Vec3(c_al) == laml::normalize(a));
+
+		const laml::Quat q = laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+		const laml::QuatA q_al(q);
+		EXPECT_TRUE(laml::rotate(q_al, a_al) == laml::rotate(q, a));
+		const laml::QuatA qq = laml::mul(q_al, q_al);
+		const laml::Quat qq_ref = laml::mul(q, q);
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_EQ(qq[k], qq_ref[k]);
+		}
+
+		// builders write through the base class
+		laml::Mat4 m;
+		laml::Mat4A m_al;
+		laml::transform::create_transform(m, q, a, b);
+		laml::transform::create_transform(m_al, q_al, a_al, b_al);
+		EXPECT_TRUE(m_al == m);
+		EXPECT_TRUE(laml::mul(m_al, m_al) == laml::mul(m, m));
+		const laml::Mat4A inv = laml::inverse(m_al);
+		EXPECT_TRUE(inv == laml::inverse(m));
+		EXPECT_TRUE(laml::transform::transform_point(m_al, a_al, 1.0f) == laml::transform::transform_point(m, a, 1.0f));
+	}
+
+	// binding to the plain type is a reference, not a copy
+	laml::Vec3A v(1.0f, 2.0f, 3.0f);
+	laml::Vec3& plain = v;
+	plain.y = 5.0f;
+	EXPECT_EQ(v[1], 5.0f);
+
+	// containers keep every element aligned
+	std::vector<laml::Vec3A> vecs(37);
+	std::vector<laml::Mat4A> mats(5);
+	for (size_t n = 0; n < vecs.size(); n++) {
+		EXPECT_TRUE(is_aligned(&vecs[n], 16));
+	}
+	for (size_t n = 0; n < mats.size(); n++) {
+		EXPECT_TRUE(is_aligned(&mats[n], 64));
+	}
+}
+
+TEST(Aligned, batch) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	laml::Mat4 mat, proj;
+	laml::transform::create_transform(mat, dis(gen), dis(gen), dis(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(2.0f, 3.0f, 4.0f));
+	laml::transform::create_projection_perspective(proj, 60.0f, 1.5f, 0.1f, 1000.0f);
+
+	const size_t count = NUM_LOOPS + 3;
+	std::vector<laml::Vec3> points(count), out(count);
+	std::vector<laml::Vec3A> points_al(count), out_al(count);
+	for (size_t n = 0; n < count; n++) {
+		points[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		points_al[n] = points[n];
+	}
+
+	// the padded overload against the plain AoS one
+	laml::transform::transform_points(mat, points.data(), out.data(), count, 1.0f);
+	laml::transform::transform_points(mat, points_al.data(), out_al.data(), count, 1.0f);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(out_al[n][k], out[n][k]);
+		}
+	}
+	laml::transform::transform_points(proj, points.data(), out.data(), count, 1.0f, true);
+	laml::transform::transform_points(proj, points_al.data(), out_al.data(), count, 1.0f, true);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(out_al[n][k], out[n][k]);
+		}
+	}
+	laml::parallel::transform_points(mat, points_al.data(), out_al.data(), count, 0.0f, false, 1024);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 ref = laml::transform::transform_point(mat, points[n], 0.0f);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(out_al[n][k], ref[k]);
+		}
+	}
+
+	// soa views step over the padding
+	const laml::soa::Vec3View view = laml::soa::view(points_al.data(), count);
+	EXPECT_EQ(view.stride(), 4u);
+	laml::soa::Vec3Array soa_out(count);
+	laml::transform::transform_points(mat, view, soa_out, 1.0f);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 ref = laml::transform::transform_point(mat, points[n], 1.0f);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(soa_out.get(n)[k], ref[k]);
+		}
+	}
+
+	std::vector<laml::QuatA> quats(count);
+	EXPECT_EQ(laml::soa::view(quats.data(), count).stride(), 4u);
+	std::vector<laml::Vec4A_highp> wide(count);
+	EXPECT_EQ(laml::soa::view(wide.data(), count).stride(), 4u);
+}
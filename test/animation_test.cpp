@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Animation.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+#include "test_random.h"
+
+// angle between two rotations, in radians (in double, acos is too coarse near 1 in float)
+template<typename T>
+static double angle_between(const laml::Quaternion<T>& q1, const laml::Quaternion<T>& q2) {
+	laml::Quat_highp a = laml::normalize(laml::Quat_highp(q1));
+	laml::Quat_highp b = laml::normalize(laml::Quat_highp(q2));
+	double d = laml::abs(laml::dot(a, b));
+	return 2.0 * acos(d > 1.0 ? 1.0 : d);
+}
+
+TEST(Quaternion, slerp_fast) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(0.0, 1.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Quat_highp q1 = random_unit_quat<double>(gen);
+		laml::Quat_highp q2 = random_unit_quat<double>(gen);
+		double t = dis(gen);
+
+		// slerp itself does not take the shortest path
+		laml::Quat_highp q2_near = laml::dot(q1, q2) < 0.0 ? q2 * -1.0 : q2;
+		laml::Quat_highp ref = laml::slerp(q1, q2_near, t);
+
+		EXPECT_LT(angle_between(laml::slerp_fast(q1, q2, t), ref), 1e-3);
+		EXPECT_LT(angle_between(laml::nlerp(q1, q2, t), ref), 0.15);
+		EXPECT_NEAR(laml::length(laml::slerp_fast(q1, q2, t)), 1.0, 1e-12);
+	}
+
+	// end points are exact
+	laml::Quat_highp q1 = random_unit_quat<double>(gen);
+	laml::Quat_highp q2 = random_unit_quat<double>(gen);
+	EXPECT_LT(angle_between(laml::slerp_fast(q1, q2, 0.0), q1), 1e-7);
+	EXPECT_LT(angle_between(laml::slerp_fast(q1, q2, 1.0), q2), 1e-7);
+}
+
+TEST(Animation, blend) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+
+	const size_t num_joints = 203; // not a whole number of packets
+	std::vector<laml::anim::JointPose<float>> ja(num_joints), jb(num_joints), jc(num_joints), ref(num_joints);
+	for (size_t n = 0; n < num_joints; n++) {
+		ja[n] = laml::anim::JointPose<float>(random_unit_quat<float>(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(dis(gen), dis(gen), dis(gen)));
+		jb[n] = laml::anim::JointPose<float>(random_unit_quat<float>(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(dis(gen), dis(gen), dis(gen)));
+		jc[n] = laml::anim::JointPose<float>(random_unit_quat<float>(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(dis(gen), dis(gen), dis(gen)));
+	}
+	laml::anim::Pose<float> a(ja.data(), num_joints), b(jb.data(), num_joints), c(jc.data(), num_joints), out;
+
+	// two poses: SoA matches the per-joint version
+	const float t = 0.3f;
+	laml::anim::blend(a, b, t, out);
+	laml::anim::blend(ja.data(), jb.data(), t, ref.data(), num_joints);
+	ASSERT_EQ(out.size(), num_joints);
+	for (size_t n = 0; n < num_joints; n++) {
+		laml::anim::JointPose<float> j = out.get(n);
+		EXPECT_LT(angle_between(j.rotation, ref[n].rotation), 1e-3);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_NEAR(j.translation[k], ref[n].translation[k], 1e-5f);
+			EXPECT_NEAR(j.scale[k], ref[n].scale[k], 1e-5f);
+		}
+	}
+
+	// N poses: a single non-zero weight gives that pose back, weights are normalized
+	const laml::anim::Pose<float>* poses[3] = { &a, &b, &c };
+	const float only_b[3] = { 0.0f, 2.0f, 0.0f };
+	laml::anim::blend(poses, only_b, 3, out);
+	for (size_t n = 0; n < num_joints; n++) {
+		laml::anim::JointPose<float> j = out.get(n);
+		EXPECT_LT(angle_between(j.rotation, jb[n].rotation), 1e-3);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_NEAR(j.translation[k], jb[n].translation[k], 1e-5f);
+			EXPECT_NEAR(j.scale[k], jb[n].scale[k], 1e-5f);
+		}
+	}
+
+	// shortest path: blending q with -q (the same rotation) must not collapse
+	std::vector<laml::anim::JointPose<float>> flipped(ja);
+	for (size_t n = 0; n < num_joints; n++) {
+		flipped[n].rotation = ja[n].rotation * -1.0f;
+	}
+	laml::anim::Pose<float> a_flipped(flipped.data(), num_joints);
+	const laml::anim::Pose<float>* same[2] = { &a, &a_flipped };
+	const float halves[2] = { 0.5f, 0.5f };
+	laml::anim::blend(same, halves, 2, out);
+	for (size_t n = 0; n < num_joints; n++) {
+		EXPECT_LT(angle_between(out.get(n).rotation, ja[n].rotation), 1e-3);
+	}
+	laml::anim::blend(a, a_flipped, 0.5f, out);
+	for (size_t n = 0; n < num_joints; n++) {
+		EXPECT_LT(angle_between(out.get(n).rotation, ja[n].rotation), 1e-3);
+	}
+}
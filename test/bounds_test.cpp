@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Bounds.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+TEST(Bounds, aabb) {
+	laml::Aabb3 empty;
+	EXPECT_TRUE(laml::is_empty(empty));
+	EXPECT_FALSE(laml::contains(empty, laml::Vec3(0.0f)));
+
+	laml::Aabb3 a(laml::Vec3(0.0f), laml::Vec3(2.0f));
+	laml::Aabb3 b(laml::Vec3(1.0f, -1.0f, 1.0f), laml::Vec3(3.0f, 1.0f, 4.0f));
+	EXPECT_TRUE(laml::merge(empty, a).min == a.min);
+	EXPECT_TRUE(laml::merge(empty, a).max == a.max);
+
+	laml::Aabb3 u = laml::merge(a, b);
+	EXPECT_TRUE(u.min == laml::Vec3(0.0f, -1.0f, 0.0f));
+	EXPECT_TRUE(u.max == laml::Vec3(3.0f, 2.0f, 4.0f));
+	EXPECT_TRUE(laml::contains(u, a));
+	EXPECT_TRUE(laml::contains(u, b));
+	EXPECT_FALSE(laml::contains(a, u));
+
+	laml::Aabb3 i = laml::intersection(a, b);
+	EXPECT_TRUE(i.min == laml::Vec3(1.0f, 0.0f, 1.0f));
+	EXPECT_TRUE(i.max == laml::Vec3(2.0f, 1.0f, 2.0f));
+	EXPECT_TRUE(laml::intersects(a, b));
+	EXPECT_FALSE(laml::is_empty(i));
+	laml::Aabb3 far_box(laml::Vec3(5.0f), laml::Vec3(6.0f));
+	EXPECT_FALSE(laml::intersects(a, far_box));
+	EXPECT_TRUE(laml::is_empty(laml::intersection(a, far_box)));
+
+	EXPECT_FLOAT_EQ(laml::surface_area(a), 24.0f);
+	EXPECT_FLOAT_EQ(laml::volume(a), 8.0f);
+	EXPECT_TRUE(laml::center(a) == laml::Vec3(1.0f));
+	EXPECT_TRUE(laml::extents(a) == laml::Vec3(1.0f));
+}
+
+TEST(Bounds, sphere_obb) {
+	laml::Sphere3 s1(laml::Vec3(0.0f), 1.0f);
+	laml::Sphere3 s2(laml::Vec3(3.0f, 0.0f, 0.0f), 1.0f);
+	EXPECT_FALSE(laml::intersects(s1, s2));
+	laml::Sphere3 m = laml::merge(s1, s2);
+	EXPECT_FLOAT_EQ(m.radius, 2.5f);
+	EXPECT_FLOAT_EQ(m.center.x, 1.5f);
+	EXPECT_TRUE(laml::contains(m, laml::Sphere3(s1.center, 0.999f)));
+	EXPECT_TRUE(laml::contains(m, laml::Sphere3(s2.center, 0.999f)));
+	EXPECT_TRUE(laml::merge(m, s1).radius == m.radius);
+	EXPECT_TRUE(laml::intersects(laml::Aabb3(laml::Vec3(0.5f), laml::Vec3(2.0f)), s1));
+	EXPECT_FALSE(laml::intersects(laml::Aabb3(laml::Vec3(0.6f), laml::Vec3(2.0f)), s1));
+
+	// a unit cube rotated 45 degrees about z reaches out to sqrt(2) along x
+	laml::Mat3 rot;
+	laml::transform::create_transform_rotation(rot, laml::transform::quat_from_axis_angle(laml::Vec3(0.0f, 0.0f, 1.0f), 45.0f));
+	laml::Obb3 obb(laml::Vec3(0.0f), rot, laml::Vec3(1.0f));
+	EXPECT_TRUE(laml::contains(obb, laml::Vec3(1.4f, 0.0f, 0.0f)));
+	EXPECT_FALSE(laml::contains(obb, laml::Vec3(1.0f, 1.0f, 0.0f)));
+	EXPECT_NEAR(laml::bounding_box(obb).max.x, 1.41421356f, 1e-5f);
+
+	laml::Obb3 box(laml::Aabb3(laml::Vec3(1.3f, -0.5f, -0.5f), laml::Vec3(2.3f, 0.5f, 0.5f)));
+	EXPECT_TRUE(laml::intersects(obb, box));
+	box.center.x = 1.5f + 0.5f;
+	EXPECT_FALSE(laml::intersects(obb, box));
+	EXPECT_TRUE(laml::intersects(obb, obb));
+
+	// axis-aligned OBBs agree with the AABB test
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> size(0.1, 5.0);
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const laml::Vec3 c1(dis(gen), dis(gen), dis(gen)), e1(size(gen), size(gen), size(gen));
+		const laml::Vec3 c2(dis(gen), dis(gen), dis(gen)), e2(size(gen), size(gen), size(gen));
+		laml::Aabb3 a1(c1 - e1, c1 + e1), a2(c2 - e2, c2 + e2);
+		laml::Vec3 gap = laml::abs(c2 - c1) - e1 - e2;
+		if (laml::abs(laml::max(gap)) > 1e-3f) {
+			EXPECT_EQ(laml::intersects(laml::Obb3(a1), laml::Obb3(a2)), laml::intersects(a1, a2));
+		}
+	}
+}
+
+TEST(Bounds, transform) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> size(0.0, 10.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<laml::Aabb3> boxes(count), out(count);
+	laml::soa::Vec3Array mins(count), maxs(count), soa_min(count), soa_max(count);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen)), e(size(gen), size(gen), size(gen));
+		boxes[n] = laml::Aabb3(c - e, c + e);
+		mins.set(n, boxes[n].min);
+		maxs.set(n, boxes[n].max);
+	}
+
+	laml::Mat4 mat;
+	laml::transform::create_transform(mat, laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen))),
+		laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(2.0f, 0.5f, 3.0f));
+
+	laml::transform::transform_aabbs(mat, boxes.data(), out.data(), count);
+	laml::transform::transform_aabbs(mat, mins, maxs, soa_min, soa_max);
+	for (size_t n = 0; n < count; n++) {
+		// Arvo's box is the exact box around the 8 transformed corners
+		laml::Aabb3 ref;
+		for (size_t k = 0; k < 8; k++) {
+			laml::Vec3 corner((k & 1) ? boxes[n].max.x : boxes[n].min.x, (k & 2) ? boxes[n].max.y : boxes[n].min.y, (k & 4) ? boxes[n].max.z : boxes[n].min.z);
+			ref = laml::merge(ref, laml::transform::transform_point(mat, corner, 1.0f));
+		}
+		const laml::Aabb3 box = laml::transform::transform_aabb(mat, boxes[n]);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_NEAR(box.min[k], ref.min[k], 1e-3f);
+			EXPECT_NEAR(box.max[k], ref.max[k], 1e-3f);
+		}
+		EXPECT_TRUE(out[n].min == box.min);
+		EXPECT_TRUE(out[n].max == box.max);
+		EXPECT_TRUE(soa_min.get(n) == box.min);
+		EXPECT_TRUE(soa_max.get(n) == box.max);
+
+		// spheres and OBBs still contain the transformed points
+		const laml::Sphere3 sphere = laml::transform::transform_sphere(mat, laml::bounding_sphere(boxes[n]));
+		const laml::Obb3 obb = laml::transform::transform_obb(mat, laml::Obb3(boxes[n]));
+		const laml::Vec3 p = laml::transform::transform_point(mat, boxes[n].max, 1.0f);
+		EXPECT_LE(laml::length(p - sphere.center), sphere.radius * 1.0001f);
+		EXPECT_TRUE(laml::contains(laml::Obb3(obb.center, obb.axes, obb.extents + laml::Vec3(1e-3f)), p));
+	}
+
+	// batched merges
+	laml::Aabb3 all = laml::merge(boxes.data(), count);
+	laml::Aabb3 ref;
+	for (size_t n = 0; n < count; n++) {
+		ref = laml::merge(ref, boxes[n]);
+	}
+	EXPECT_TRUE(all.min == ref.min);
+	EXPECT_TRUE(all.max == ref.max);
+	laml::merge(boxes.data(), out.data(), out.data(), count);
+	EXPECT_TRUE(out[7].min == laml::merge(boxes[7], laml::transform::transform_aabb(mat, boxes[7])).min);
+
+	const laml::Aabb3 points = laml::soa::bounds(mins);
+	const laml::soa::Vec3View strided{ { &boxes[0].min.x, &boxes[0].min.y, &boxes[0].min.z }, count, sizeof(laml::Aabb3) / sizeof(float) };
+	const laml::Aabb3 aos_points = laml::soa::bounds(strided);
+	laml::Aabb3 points_ref;
+	for (size_t n = 0; n < count; n++) {
+		points_ref = laml::merge(points_ref, boxes[n].min);
+	}
+	EXPECT_TRUE(points.min == points_ref.min);
+	EXPECT_TRUE(points.max == points_ref.max);
+	EXPECT_TRUE(aos_points.min == points_ref.min);
+	EXPECT_TRUE(aos_points.max == points_ref.max);
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Bvh.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+static_assert(sizeof(laml::BvhNode<float>) == 32, "BVH nodes should be 32 bytes");
+
+static std::vector<laml::Aabb3> random_boxes(std::mt19937& gen, size_t count) {
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> size(0.0, 3.0);
+	std::vector<laml::Aabb3> boxes(count);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen)), e(size(gen), size(gen), size(gen));
+		boxes[n] = laml::Aabb3(c - e, c + e);
+	}
+	return boxes;
+}
+
+// every primitive sits in exactly one leaf, and every node's box holds its children
+static void expect_valid(const laml::Bvh<float>& bvh, const std::vector<laml::Aabb3>& boxes) {
+	ASSERT_EQ(bvh.size(), boxes.size());
+	std::vector<size_t> seen(boxes.size(), 0);
+	const std::vector<laml::BvhNode<float>>& nodes = bvh.nodes();
+	for (size_t n = 0; n < nodes.size(); n++) {
+		if (nodes[n].is_leaf()) {
+			for (size_t slot = nodes[n].first; slot < nodes[n].first + nodes[n].count; slot++) {
+				seen[bvh.primitive(slot)]++;
+				EXPECT_TRUE(laml::contains(nodes[n].bounds, boxes[bvh.primitive(slot)]));
+			}
+		}
+		else {
+			EXPECT_GT(nodes[n].first, n + 1);
+			EXPECT_TRUE(laml::contains(nodes[n].bounds, nodes[n + 1].bounds));
+			EXPECT_TRUE(laml::contains(nodes[n].bounds, nodes[nodes[n].first].bounds));
+		}
+	}
+	for (size_t n = 0; n < boxes.size(); n++) {
+		EXPECT_EQ(seen[n], 1u);
+	}
+}
+
+TEST(Ray, aabb) {
+	const laml::Aabb3 box(laml::Vec3(-1.0f), laml::Vec3(1.0f));
+	float t;
+	EXPECT_TRUE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, 0.0f, 0.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), box, 100.0f, t));
+	EXPECT_FLOAT_EQ(t, 4.0f);
+	EXPECT_TRUE(laml::intersects(laml::Ray3(laml::Vec3(5.0f, 0.5f, 0.5f), laml::Vec3(-2.0f, 0.0f, 0.0f)), box, 100.0f, t));
+	EXPECT_FLOAT_EQ(t, 2.0f);
+	EXPECT_FALSE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, 0.0f, 0.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), box, 3.0f));
+	EXPECT_FALSE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, 0.0f, 0.0f), laml::Vec3(-1.0f, 0.0f, 0.0f)), box, 100.0f));
+	EXPECT_FALSE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, 2.0f, 0.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), box, 100.0f));
+
+	// starting inside enters at 0
+	EXPECT_TRUE(laml::intersects(laml::Ray3(laml::Vec3(0.0f), laml::Vec3(0.0f, 1.0f, 0.0f)), box, 100.0f, t));
+	EXPECT_FLOAT_EQ(t, 0.0f);
+
+	// rays lying in a face plane
+	EXPECT_TRUE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, 1.0f, 0.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), box, 100.0f, t));
+	EXPECT_FLOAT_EQ(t, 4.0f);
+	EXPECT_TRUE(laml::intersects(laml::Ray3(laml::Vec3(-5.0f, -1.0f, 1.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), box, 100.0f));
+
+	const laml::Ray3 diagonal(laml::Vec3(-3.0f), laml::Vec3(1.0f));
+	EXPECT_TRUE(diagonal.sign[0] == 0 && diagonal.sign[1] == 0 && diagonal.sign[2] == 0);
+	EXPECT_TRUE(laml::intersects(diagonal, box, 100.0f, t));
+	EXPECT_TRUE(laml::point_at(diagonal, t) == laml::Vec3(-1.0f));
+}
+
+TEST(Bvh, build) {
+	std::mt19937 gen(1234);
+
+	laml::Bvh<float> bvh;
+	bvh.build(nullptr, 0);
+	EXPECT_EQ(bvh.num_nodes(), 0u);
+	EXPECT_TRUE(laml::is_empty(bvh.bounds()));
+
+	std::vector<laml::Aabb3> one = random_boxes(gen, 1);
+	bvh.build(one.data(), one.size());
+	EXPECT_EQ(bvh.num_nodes(), 1u);
+	expect_valid(bvh, one);
+
+	std::vector<laml::Aabb3> boxes = random_boxes(gen, NUM_LOOPS);
+	bvh.build(boxes.data(), boxes.size());
+	expect_valid(bvh, boxes);
+	for (const laml::BvhNode<float>& node : bvh.nodes()) {
+		EXPECT_LE(node.count, 4u);
+	}
+
+	// the parallel build makes the same tree
+	laml::Bvh<float> threaded;
+	threaded.build_parallel(boxes.data(), boxes.size(), 4, 256);
+	ASSERT_EQ(threaded.num_nodes(), bvh.num_nodes());
+	for (size_t n = 0; n < bvh.num_nodes(); n++) {
+		EXPECT_EQ(threaded.nodes()[n].first, bvh.nodes()[n].first);
+		EXPECT_EQ(threaded.nodes()[n].count, bvh.nodes()[n].count);
+		EXPECT_TRUE(threaded.nodes()[n].bounds.min == bvh.nodes()[n].bounds.min);
+		EXPECT_TRUE(threaded.nodes()[n].bounds.max == bvh.nodes()[n].bounds.max);
+	}
+	for (size_t slot = 0; slot < bvh.size(); slot++) {
+		EXPECT_EQ(threaded.primitive(slot), bvh.primitive(slot));
+	}
+
+	// coincident boxes can't be separated, but leaves still stay small
+	std::vector<laml::Aabb3> same(100, boxes[0]);
+	bvh.build(same.data(), same.size(), 8);
+	expect_valid(bvh, same);
+	for (const laml::BvhNode<float>& node : bvh.nodes()) {
+		EXPECT_LE(node.count, 8u);
+	}
+
+	// a long run of ever smaller nested boxes still builds within the traversal depth
+	std::vector<laml::Aabb3> nested(NUM_LOOPS);
+	for (size_t n = 0; n < nested.size(); n++) {
+		const float e = std::ldexp(1.0f, -static_cast<int>(n % 100));
+		nested[n] = laml::Aabb3(laml::Vec3(e), laml::Vec3(2.0f * e));
+	}
+	bvh.build(nested.data(), nested.size());
+	expect_valid(bvh, nested);
+}
+
+TEST(Bvh, queries) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	std::vector<laml::Aabb3> boxes = random_boxes(gen, 2000);
+	laml::Bvh<float> bvh;
+	bvh.build(boxes.data(), boxes.size());
+
+	for (size_t pass = 0; pass < 2; pass++) {
+		for (size_t n = 0; n < 200; n++) {
+			const laml::Ray3 ray(laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(unit(gen), unit(gen), unit(gen)));
+			auto hit_box = [&](size_t prim, float t_max) {
+				float t;
+				return laml::intersects(ray, boxes[prim], t_max, t) ? t : t_max;
+			};
+
+			// brute force reference
+			float ref_t = 1000.0f;
+			size_t ref = laml::Bvh<float>::npos;
+			for (size_t k = 0; k < boxes.size(); k++) {
+				const float t = hit_box(k, ref_t);
+				if (t < ref_t) {
+					ref_t = t;
+					ref = k;
+				}
+			}
+
+			float t = 1000.0f;
+			const size_t prim = bvh.closest_hit(ray, t, hit_box);
+			EXPECT_EQ(t, ref_t);
+			if (prim != ref) {
+				// ties between boxes entered at the same distance
+				ASSERT_NE(prim, laml::Bvh<float>::npos);
+				EXPECT_EQ(hit_box(prim, 1000.0f), ref_t);
+			}
+			EXPECT_EQ(bvh.any_hit(ray, 1000.0f, hit_box), ref != laml::Bvh<float>::npos);
+
+			const laml::Vec3 c(dis(gen), dis(gen), dis(gen));
+			const laml::Aabb3 query(c - laml::Vec3(10.0f), c + laml::Vec3(10.0f));
+			std::vector<size_t> found, expected;
+			bvh.overlap(query, [&](size_t k) { found.push_back(k); });
+			for (size_t k = 0; k < boxes.size(); k++) {
+				if (laml::intersects(boxes[k], query)) {
+					expected.push_back(k);
+				}
+			}
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(found, expected);
+		}
+
+		// animate the boxes and refit; queries must still see the moved boxes
+		const laml::Vec3 offset(dis(gen), dis(gen), dis(gen));
+		for (laml::Aabb3& box : boxes) {
+			box = laml::Aabb3(box.min + offset * 0.1f, box.max + offset * 0.1f);
+		}
+		bvh.refit(boxes.data());
+		expect_valid(bvh, boxes);
+	}
+}
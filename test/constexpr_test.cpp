@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <cmath>
+#include <random>
+
+#include "test_config.h"
+
+template<typename T>
+constexpr bool near(T a, T b, T tol) {
+	return (a - b) < tol && (b - a) < tol;
+}
+
+template<typename T, size_t size>
+constexpr bool near(const laml::Vector<T, size>& a, const laml::Vector<T, size>& b, T tol) {
+	for (size_t n = 0; n < size; n++) {
+		if (!near(a[n], b[n], tol)) return false;
+	}
+	return true;
+}
+
+template<typename T, size_t size>
+constexpr bool near(const laml::Matrix<T, size, size>& a, const laml::Matrix<T, size, size>& b, T tol) {
+	for (size_t n = 0; n < size; n++) {
+		if (!near(a[n], b[n], tol)) return false;
+	}
+	return true;
+}
+
+// the builders take out-params, so compile-time matrices come out of constexpr functions like these
+constexpr laml::Mat4 model_matrix() {
+	laml::Mat4 rot, trans, scale, res;
+	laml::transform::create_transform_rotation(rot, 90.0f, 0.0f, 0.0f);
+	laml::transform::create_transform_translate(trans, 1.0f, 2.0f, 3.0f);
+	laml::transform::create_transform_scale(scale, 2.0f, 2.0f, 2.0f);
+	laml::transform::create_transform(res, rot, trans, scale);
+	return res;
+}
+
+constexpr laml::Mat4 projection_matrix() {
+	laml::Mat4 res;
+	laml::transform::create_projection_perspective(res, 90.0f, 1.0f, 0.1f, 100.0f);
+	return res;
+}
+
+constexpr double sin_table_entry(size_t n) {
+	return laml::cx::sin(-10.0 + 0.25 * static_cast<double>(n));
+}
+
+struct SinTable {
+	double values[81];
+};
+
+constexpr SinTable sin_table() {
+	SinTable res{};
+	for (size_t n = 0; n < 81; n++) {
+		res.values[n] = sin_table_entry(n);
+	}
+	return res;
+}
+
+TEST(Constexpr, math) {
+	static_assert(laml::cx::sqrt(0.0) == 0.0, "sqrt(0)");
+	static_assert(laml::cx::sqrt(16.0) == 4.0, "sqrt of a square");
+	static_assert(near(laml::cx::sqrt(2.0), 1.4142135623730951, 1e-15), "sqrt(2)");
+	static_assert(near(laml::cx::sqrt(1e-300), 1e-150, 1e-164), "sqrt of a tiny value");
+	static_assert(near(laml::cx::sin(laml::constants::pi<double> / 6.0), 0.5, 1e-15), "sin(30 deg)");
+	static_assert(near(laml::cx::cos(laml::constants::pi<double> / 3.0), 0.5, 1e-15), "cos(60 deg)");
+	static_assert(near(laml::cx::tan(laml::constants::pi<double> / 4.0), 1.0, 1e-15), "tan(45 deg)");
+	static_assert(near(laml::sind(90.0f), 1.0f, 1e-7f), "sind");
+	static_assert(laml::abs(-2) == 2 && laml::sign(-3.0) == -1 && laml::clamp(5, 0, 3) == 3, "helpers");
+
+	// the compile-time series against the library at run time
+	constexpr SinTable table = sin_table();
+	for (size_t n = 0; n < 81; n++) {
+		const double x = -10.0 + 0.25 * static_cast<double>(n);
+		EXPECT_NEAR(table.values[n], std::sin(x), 1e-15);
+	}
+
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(0.0, 1000.0);
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		// the run time path is the plain library call
+		const double x = dis(gen);
+		EXPECT_EQ(laml::cx::sqrt(x), std::sqrt(x));
+		EXPECT_EQ(laml::cx::cos(x), std::cos(x));
+	}
+}
+
+TEST(Constexpr, vector) {
+	constexpr laml::Vec3 a(1.0f, 2.0f, 3.0f);
+	constexpr laml::Vec3 b(4.0f, 5.0f, 6.0f);
+	static_assert(a + b == laml::Vec3(5.0f, 7.0f, 9.0f), "add");
+	static_assert(b - a == laml::Vec3(3.0f), "subtract");
+	static_assert(a * 2.0f == laml::Vec3(2.0f, 4.0f, 6.0f), "scale");
+	static_assert(laml::dot(a, b) == 32.0f, "dot");
+	static_assert(laml::cross(a, b) == laml::Vec3(-3.0f, 6.0f, -3.0f), "cross");
+	static_assert(laml::length(laml::Vec2(3.0f, 4.0f)) == 5.0f, "length");
+	static_assert(near(laml::normalize(laml::Vec3(0.0f, 3.0f, 4.0f)), laml::Vec3(0.0f, 0.6f, 0.8f), 1e-7f), "normalize");
+	static_assert(laml::Vec4(a, 1.0f)[3] == 1.0f, "Vec4 from Vec3");
+	static_assert(laml::Vec3_highp(a)[2] == 3.0, "conversion");
+	static_assert(laml::all(a < b) && !laml::any(a > b), "comparisons");
+
+	constexpr laml::Vector<double, 5> v(1.0, 2.0, 3.0, 4.0, 5.0);
+	static_assert(laml::length_sq(v) == 55.0 && laml::max(v) == 5.0, "generic vector");
+
+	EXPECT_FLOAT_EQ(laml::length(laml::normalize(a)), 1.0f);
+}
+
+TEST(Constexpr, matrix) {
+	constexpr laml::Mat3 m(2.0f, 0.0f, 0.0f, 1.0f, 3.0f, 0.0f, 0.0f, 0.0f, 4.0f);
+	static_assert(laml::det(m) == 24.0f, "det 3x3");
+	static_assert(laml::transpose(m)[0][1] == 1.0f, "transpose");
+	static_assert(near(laml::mul(m, laml::inverse(m)), laml::Mat3(1.0f), 1e-7f), "inverse 3x3");
+	static_assert(laml::Mat4(m)[2][2] == 4.0f && laml::Mat4(m)[3][3] == 1.0f, "Mat4 from Mat3");
+
+	constexpr laml::Matrix<double, 5, 5> eye = []() {
+		laml::Matrix<double, 5, 5> res;
+		laml::identity(res);
+		return res;
+	}();
+	static_assert(laml::trace(eye) == 5.0, "identity");
+	static_assert(laml::mul(eye, eye) == eye, "generic mul");
+
+	constexpr laml::Mat4 model = model_matrix();
+	static_assert(near(laml::transform::transform_point(model, laml::Vec3(1.0f, 0.0f, 0.0f), 1.0f), laml::Vec3(1.0f, 2.0f, 1.0f), 1e-6f),
+		"rotate, scale and translate a point");
+	static_assert(near(laml::mul(laml::inverse(model), model), laml::Mat4(1.0f), 1e-6f), "inverse 4x4");
+	static_assert(near(laml::mul_affine(laml::inverse_affine(model), model), laml::Mat4(1.0f), 1e-6f), "inverse_affine");
+	static_assert(near(laml::det(model), 8.0f, 1e-5f), "det 4x4");
+
+	// the same calls at run time agree with the baked values
+	laml::Mat4 rot, trans, scale, res;
+	laml::transform::create_transform_rotation(rot, 90.0f, 0.0f, 0.0f);
+	laml::transform::create_transform_translate(trans, 1.0f, 2.0f, 3.0f);
+	laml::transform::create_transform_scale(scale, 2.0f, 2.0f, 2.0f);
+	laml::transform::create_transform(res, rot, trans, scale);
+	for (size_t c = 0; c < 4; c++) {
+		for (size_t r = 0; r < 4; r++) {
+			EXPECT_NEAR(res[c][r], model[c][r], 1e-6f);
+		}
+	}
+
+	constexpr laml::Mat4 proj = projection_matrix();
+	laml::Mat4 proj_rt;
+	laml::transform::create_projection_perspective(proj_rt, 90.0f, 1.0f, 0.1f, 100.0f);
+	EXPECT_NEAR(proj[0][0], proj_rt[0][0], 1e-6f);
+	EXPECT_NEAR(proj[1][1], proj_rt[1][1], 1e-6f);
+	EXPECT_EQ(proj[3][2], proj_rt[3][2]);
+}
+
+TEST(Constexpr, quaternion) {
+	constexpr laml::Quat q = laml::transform::quat_from_axis_angle(laml::Vec3(0.0f, 0.0f, 1.0f), 90.0f);
+	static_assert(near(laml::length(q), 1.0f, 1e-7f), "unit quaternion");
+	static_assert(near(laml::rotate(q, laml::Vec3(1.0f, 0.0f, 0.0f)), laml::Vec3(0.0f, 1.0f, 0.0f), 1e-6f), "rotate");
+
+	constexpr laml::Quat qq = laml::mul(q, q);
+	static_assert(near(laml::rotate(qq, laml::Vec3(1.0f, 0.0f, 0.0f)), laml::Vec3(-1.0f, 0.0f, 0.0f), 1e-6f), "mul");
+	static_assert(laml::mul(q, laml::conjugate(q))[3] > 0.9999999f, "conjugate");
+
+	constexpr laml::Mat3 r = []() {
+		laml::Mat3 res;
+		laml::transform::create_transform_rotation(res, laml::transform::quat_from_axis_angle(laml::Vec3(0.0f, 0.0f, 1.0f), 90.0f));
+		return res;
+	}();
+	static_assert(near(r[0], laml::Vec3(0.0f, 1.0f, 0.0f), 1e-6f), "rotation matrix from a quaternion");
+
+	const laml::Quat q_rt = laml::transform::quat_from_axis_angle(laml::Vec3(0.0f, 0.0f, 1.0f), 90.0f);
+	for (size_t n = 0; n < 4; n++) {
+		EXPECT_NEAR(q_rt[n], q[n], 1e-7f);
+	}
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/DualQuaternion.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+#include "test_random.h"
+
+static_assert(sizeof(laml::DualQuat) == 8 * sizeof(float), "8 values per bone");
+
+// compile-time evaluation works the same way
+constexpr laml::Vec3 moved() {
+	const laml::DualQuat dq(laml::Quat(0.0f, 0.0f, 1.0f, 0.0f), laml::Vec3(1.0f, 2.0f, 3.0f)); // 180 degrees about z
+	return laml::transform::transform_point(dq, laml::Vec3(1.0f, 0.0f, 0.0f));
+}
+static_assert(moved() == laml::Vec3(0.0f, 2.0f, 3.0f), "constexpr transform_point");
+
+// absolute tolerances: float rounding scales with the size of the inputs, not of the result
+static void expect_near(const laml::Vec3& a, const laml::Vec3& b, float tol) {
+	for (size_t k = 0; k < 3; k++) {
+		EXPECT_NEAR(a[k], b[k], tol);
+	}
+}
+
+TEST(DualQuaternion, api) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const laml::Quat q1 = random_unit_quat(gen), q2 = random_unit_quat(gen);
+		const laml::Vec3 t1(dis(gen), dis(gen), dis(gen)), t2(dis(gen), dis(gen), dis(gen));
+		const laml::Vec3 p(dis(gen), dis(gen), dis(gen));
+		const laml::DualQuat a(q1, t1), b(q2, t2);
+
+		// same transform as the matrix from the same rotation and translation
+		laml::Mat4 ma, mb;
+		laml::transform::create_transform(ma, q1, t1);
+		laml::transform::create_transform(mb, q2, t2);
+		expect_near(laml::translation(a), t1, 1e-3f);
+		expect_near(laml::transform::transform_point(a, p), laml::transform::transform_point(ma, p, 1.0f), 1e-3f);
+		expect_near(laml::transform::transform_vector(a, p), laml::transform::transform_point(ma, p, 0.0f), 1e-3f);
+
+		// composition follows matrix order
+		const laml::DualQuat ab = laml::mul(a, b);
+		expect_near(laml::transform::transform_point(ab, p), laml::transform::transform_point(laml::mul(ma, mb), p, 1.0f), 2e-3f);
+
+		// conjugate undoes a unit dual quaternion
+		expect_near(laml::transform::transform_point(laml::conjugate(a), laml::transform::transform_point(a, p)), p, 2e-3f);
+
+		// back to a matrix, and from one
+		laml::Mat4 m;
+		laml::transform::create_transform(m, a);
+		for (size_t k = 0; k < 16; k++) {
+			EXPECT_NEAR(m._data[k], ma._data[k], 1e-3f);
+		}
+		const laml::DualQuat from_mat = laml::transform::dual_quat_from_mat(ma);
+		expect_near(laml::transform::transform_point(from_mat, p), laml::transform::transform_point(a, p), 2e-3f);
+
+		// scaling does not change the transform once normalized, and q, -q are the same rotation
+		const laml::DualQuat scaled = laml::normalize(a * 3.0f);
+		expect_near(laml::transform::transform_point(scaled, p), laml::transform::transform_point(a, p), 1e-3f);
+		const laml::DualQuat flipped = a * -1.0f;
+		expect_near(laml::transform::transform_point(flipped, p), laml::transform::transform_point(a, p), 1e-3f);
+
+		// blending across hemispheres
+		const laml::DualQuat pair[2] = { a, flipped };
+		const float weights[2] = { 0.3f, 0.7f };
+		expect_near(laml::transform::transform_point(laml::blend(pair, weights, 2), p), laml::transform::transform_point(a, p), 1e-3f);
+	}
+
+	// nothing to blend is the identity, not a division by zero
+	const laml::DualQuat bone(laml::Quat(0.0f, 0.0f, 1.0f, 0.0f), laml::Vec3(1.0f, 2.0f, 3.0f));
+	const laml::DualQuat bones[2] = { bone, bone };
+	const float no_weights[2] = { 0.0f, 0.0f };
+	const laml::Vec3 p(1.0f, 2.0f, 3.0f);
+	EXPECT_EQ(laml::transform::transform_point(laml::blend<float>(nullptr, nullptr, 0), p), p);
+	EXPECT_EQ(laml::transform::transform_point(laml::blend(bones, no_weights, 2), p), p);
+
+	// element access
+	laml::DualQuat dq;
+	EXPECT_EQ(dq[3], 1.0f);
+	EXPECT_EQ(dq[7], 0.0f);
+	dq[5] = 2.0f;
+	EXPECT_EQ(dq.dual.y, 2.0f);
+}
+
+TEST(DualQuaternion, skin) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> weight(0.0, 1.0);
+
+	const size_t num_bones = 37;
+	std::vector<laml::DualQuat> bones(num_bones);
+	for (size_t n = 0; n < num_bones; n++) {
+		// every other bone in the opposite hemisphere
+		bones[n] = laml::DualQuat(random_unit_quat(gen), laml::Vec3(dis(gen), dis(gen), dis(gen))) * ((n % 2) ? -1.0f : 1.0f);
+	}
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<uint16> joints(4 * count);
+	std::vector<float> weights(4 * count);
+	std::vector<laml::Vec3> positions(count), normals(count);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < 4; k++) {
+			joints[4 * n + k] = static_cast<uint16>(gen() % num_bones);
+			weights[4 * n + k] = weight(gen);
+		}
+		weights[4 * n + 3] = 0.0f; // an unused influence
+		positions[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		normals[n] = laml::normalize(laml::Vec3(dis(gen), dis(gen), dis(gen)));
+	}
+
+	// against blend() and transform_point() per vertex, SoA and AoS, positions only and with normals
+	laml::soa::Vec3Array soa_pos(positions.data(), count), soa_nrm(normals.data(), count), soa_out_pos(count), soa_out_nrm(count);
+	std::vector<laml::Vec3> out_pos(count);
+	laml::skin_dq(bones.data(), joints.data(), weights.data(), soa_pos, soa_nrm, soa_out_pos, soa_out_nrm);
+	laml::skin_dq(bones.data(), joints.data(), weights.data(), laml::soa::view(positions.data(), count), laml::soa::view(out_pos.data(), count));
+	for (size_t n = 0; n < count; n++) {
+		laml::DualQuat influences[4];
+		for (size_t k = 0; k < 4; k++) {
+			influences[k] = bones[joints[4 * n + k]];
+		}
+		const laml::DualQuat dq = laml::blend(influences, &weights[4 * n], 4);
+		const laml::Vec3 ref_pos = laml::transform::transform_point(dq, positions[n]);
+		const laml::Vec3 ref_nrm = laml::transform::transform_vector(dq, normals[n]);
+		expect_near(soa_out_pos.get(n), ref_pos, 1e-4f);
+		expect_near(soa_out_nrm.get(n), ref_nrm, 1e-4f);
+		expect_near(out_pos[n], ref_pos, 1e-4f);
+	}
+
+	// one bone with full weight is that bone's transform, in place
+	for (size_t n = 0; n < count; n++) {
+		weights[4 * n] = 1.0f;
+		weights[4 * n + 1] = weights[4 * n + 2] = weights[4 * n + 3] = 0.0f;
+	}
+	laml::skin_dq(bones.data(), joints.data(), weights.data(), soa_pos, soa_pos);
+	for (size_t n = 0; n < count; n++) {
+		expect_near(soa_pos.get(n), laml::transform::transform_point(bones[joints[4 * n]], positions[n]), 1e-4f);
+	}
+}
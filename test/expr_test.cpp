@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Expr.hpp>
+#include <laml/MatrixX.hpp>
+#include <random>
+#include <type_traits>
+
+#include "test_config.h"
+
+using laml::expr::lazy;
+
+// compile-time evaluation works the same way
+constexpr laml::Vec3 fused() {
+	const laml::Vec3 a(1.0f, 2.0f, 3.0f), b(4.0f, 5.0f, 6.0f);
+	return lazy(a) * 2.0f + b - lazy(a) / b;
+}
+static_assert(fused() == laml::Vec3(5.75f, 8.6f, 11.5f), "constexpr expression");
+static_assert(std::is_same<decltype(laml::expr::eval(lazy(laml::Vec3()) + laml::Vec3())), laml::Vec3>::value, "result type");
+
+template<typename T, size_t size>
+static laml::Vector<T, size> random_vector(std::mt19937& gen) {
+	std::uniform_real_distribution<T> dis(-100.0, 100.0);
+	laml::Vector<T, size> res;
+	for (size_t n = 0; n < size; n++) {
+		res[n] = dis(gen);
+	}
+	return res;
+}
+
+template<typename T, size_t size>
+static void expect_equal(const laml::Vector<T, size>& a, const laml::Vector<T, size>& b) {
+	for (size_t n = 0; n < size; n++) {
+		EXPECT_FLOAT_EQ(a[n], b[n]);
+	}
+}
+
+template<size_t size>
+static void check(std::mt19937& gen) {
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> factor(0.0, 1.0);
+	const laml::Vector<float, size> a = random_vector<float, size>(gen);
+	const laml::Vector<float, size> b = random_vector<float, size>(gen);
+	const laml::Vector<float, size> c = random_vector<float, size>(gen);
+	const float s = dis(gen), t = dis(gen), f = factor(gen);
+
+	// same values as the plain operators
+	const laml::Vector<float, size> r = lazy(a) * s + lazy(b) * t - c;
+	expect_equal(r, a * s + b * t - c);
+	expect_equal<float, size>(laml::expr::lerp(a, b, f), laml::lerp(a, b, f));
+	expect_equal<float, size>(c - lazy(a) * b, c - a * b);
+	expect_equal<float, size>(-lazy(a) / 4.0f, -a / 4.0f);
+	expect_equal<float, size>(s * lazy(a) / (lazy(b) + c), s * a / (b + c));
+
+	// in place, the destination is also an operand
+	laml::Vector<float, size> d = a;
+	laml::expr::assign(d, laml::expr::lerp(d, b, f));
+	expect_equal(d, laml::lerp(a, b, f));
+	laml::expr::assign(d, lazy(d) * 2.0f - d);
+	expect_equal(d, laml::lerp(a, b, f) * 2.0f - laml::lerp(a, b, f));
+}
+
+TEST(Expr, vector) {
+	std::mt19937 gen(1234);
+
+	for (size_t n = 0; n < NUM_LOOPS / 10; n++) {
+		check<3>(gen);
+		check<4>(gen);
+		check<37>(gen);
+		check<256>(gen);
+	}
+
+	// double, and mixed scalar types
+	const laml::Vec3_highp a(1.0, 2.0, 3.0), b(0.5, 0.25, 0.125);
+	const laml::Vec3_highp r = lazy(a) * 2 + lazy(b) * 0.5f;
+	EXPECT_TRUE(r == a * 2.0 + b * 0.5);
+}
+
+TEST(Expr, vectorx) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-100.0, 100.0);
+
+	const size_t size = 1000;
+	laml::VectorX<double> a(size), b(size), c(size);
+	for (size_t n = 0; n < size; n++) {
+		a[n] = dis(gen);
+		b[n] = dis(gen);
+		c[n] = dis(gen);
+	}
+	const laml::VectorX<double> ref = a * 3.0 + b * 0.5 - c;
+	const laml::VectorX<double> r = lazy(a) * 3.0 + lazy(b) * 0.5 - c;
+	ASSERT_EQ(r.size(), size);
+	for (size_t n = 0; n < size; n++) {
+		EXPECT_DOUBLE_EQ(r[n], ref[n]);
+	}
+
+	laml::VectorX<double> d(a);
+	laml::expr::assign(d, laml::expr::lerp(d, b, 0.25));
+	for (size_t n = 0; n < size; n++) {
+		EXPECT_DOUBLE_EQ(d[n], b[n] * 0.25 + a[n] * 0.75);
+	}
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+// largest |out[n] - ref(in[n])|, relative to |ref| if asked, with the reference in double
+template<typename F>
+static double max_error(const std::vector<float>& in, const std::vector<float>& out, F ref, bool relative) {
+	double res = 0.0;
+	for (size_t n = 0; n < in.size(); n++) {
+		const double exact = ref(static_cast<double>(in[n]));
+		double err = std::fabs(static_cast<double>(out[n]) - exact);
+		if (relative) {
+			err = err / std::fabs(exact);
+		}
+		res = std::max(res, err);
+	}
+	return res;
+}
+
+static std::vector<float> random_values(size_t count, double lo, double hi, std::mt19937& gen) {
+	std::uniform_real_distribution<double> dis(lo, hi);
+	std::vector<float> res(count);
+	for (float& v : res) {
+		v = static_cast<float>(dis(gen));
+	}
+	return res;
+}
+
+TEST(FastMath, scalar) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> angle(-8192.0f, 8192.0f);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> expo(-87.3f, 88.3f);
+	std::uniform_real_distribution<float> positive(1e-30f, 1e30f);
+
+	// the bounds documented in FastMath.hpp
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const float a = angle(gen);
+		EXPECT_NEAR(laml::fast::sin(a), std::sin(static_cast<double>(a)), 1e-7);
+		EXPECT_NEAR(laml::fast::cos(a), std::cos(static_cast<double>(a)), 1e-7);
+		float s, c;
+		laml::fast::sincos(a, s, c);
+		EXPECT_EQ(s, laml::fast::sin(a));
+		EXPECT_EQ(c, laml::fast::cos(a));
+
+		const float y = coord(gen), x = coord(gen);
+		EXPECT_NEAR(laml::fast::atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x)), 3e-7);
+		const float u = unit(gen);
+		EXPECT_NEAR(laml::fast::acos(u), std::acos(static_cast<double>(u)), 4e-7);
+
+		const float e = expo(gen);
+		const double exp_ref = std::exp(static_cast<double>(e));
+		EXPECT_NEAR(laml::fast::exp(e) / exp_ref, 1.0, 1.2e-7);
+		const float p = positive(gen);
+		const double rsqrt_ref = 1.0 / std::sqrt(static_cast<double>(p));
+		EXPECT_NEAR(laml::fast::rsqrt(p) / rsqrt_ref, 1.0, 3e-7);
+	}
+
+	// double takes the same polynomials
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const double a = static_cast<double>(angle(gen));
+		EXPECT_NEAR(laml::fast::sin(a), std::sin(a), 1e-7);
+		const double e = static_cast<double>(expo(gen));
+		EXPECT_NEAR(laml::fast::exp(e) / std::exp(e), 1.0, 1.2e-7);
+	}
+
+	// edges
+	EXPECT_EQ(laml::fast::sin(0.0f), 0.0f);
+	EXPECT_EQ(laml::fast::cos(0.0f), 1.0f);
+	EXPECT_EQ(laml::fast::atan2(0.0f, 0.0f), 0.0f);
+	EXPECT_NEAR(laml::fast::atan2(0.0f, -1.0f), laml::constants::pi<float>, 1e-7f);
+	EXPECT_NEAR(laml::fast::atan2(-1.0f, 0.0f), -0.5f * laml::constants::pi<float>, 1e-7f);
+	EXPECT_EQ(laml::fast::acos(1.0f), 0.0f);
+	EXPECT_NEAR(laml::fast::acos(-1.0f), laml::constants::pi<float>, 2e-7f);
+	EXPECT_EQ(laml::fast::acos(1.5f), 0.0f);
+	EXPECT_EQ(laml::fast::exp(0.0f), 1.0f);
+	EXPECT_GT(laml::fast::exp(100.0f), 1e38f);
+	EXPECT_GT(laml::fast::exp(-100.0f), 0.0f);
+}
+
+TEST(FastMath, batch) {
+	std::mt19937 gen(1234);
+
+	// not a multiple of any packet width, so the tail is covered too
+	const size_t count = 4099;
+	std::vector<float> out(count), out2(count);
+
+	const std::vector<float> angles = random_values(count, -8192.0, 8192.0, gen);
+	laml::fast::sin(angles.data(), out.data(), count);
+	EXPECT_LT(max_error(angles, out, [](double x) { return std::sin(x); }, false), 1e-7);
+	laml::fast::cos(angles.data(), out.data(), count);
+	EXPECT_LT(max_error(angles, out, [](double x) { return std::cos(x); }, false), 1e-7);
+	laml::fast::sincos(angles.data(), out.data(), out2.data(), count);
+	EXPECT_LT(max_error(angles, out, [](double x) { return std::sin(x); }, false), 1e-7);
+	EXPECT_LT(max_error(angles, out2, [](double x) { return std::cos(x); }, false), 1e-7);
+
+	const std::vector<float> units = random_values(count, -1.0, 1.0, gen);
+	laml::fast::acos(units.data(), out.data(), count);
+	EXPECT_LT(max_error(units, out, [](double x) { return std::acos(x); }, false), 4e-7);
+
+	const std::vector<float> exponents = random_values(count, -87.3, 88.3, gen);
+	laml::fast::exp(exponents.data(), out.data(), count);
+	EXPECT_LT(max_error(exponents, out, [](double x) { return std::exp(x); }, true), 1.2e-7);
+
+	const std::vector<float> positives = random_values(count, 1e-6, 1e6, gen);
+	laml::fast::rsqrt(positives.data(), out.data(), count);
+	EXPECT_LT(max_error(positives, out, [](double x) { return 1.0 / std::sqrt(x); }, true), 3e-7);
+
+	const std::vector<float> ys = random_values(count, -100.0, 100.0, gen);
+	const std::vector<float> xs = random_values(count, -100.0, 100.0, gen);
+	laml::fast::atan2(ys.data(), xs.data(), out.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_NEAR(out[n], std::atan2(static_cast<double>(ys[n]), static_cast<double>(xs[n])), 3e-7);
+	}
+
+	// in place, and in double
+	std::vector<float> inplace(angles);
+	laml::fast::sin(inplace.data(), inplace.data(), count);
+	laml::fast::sin(angles.data(), out.data(), count);
+	EXPECT_EQ(inplace, out);
+	std::vector<double> d_in(angles.begin(), angles.end()), d_out(count);
+	laml::fast::cos(d_in.data(), d_out.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_NEAR(d_out[n], std::cos(d_in[n]), 1e-7);
+	}
+}
+
+TEST(FastMath, policy) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> deg(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> factor(0.0f, 1.0f);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const laml::Vec3 v(dis(gen), dis(gen), dis(gen));
+		const laml::Vec3 precise = laml::normalize(v, laml::math::precise());
+		const laml::Vec3 fast = laml::normalize(v, laml::math::fast());
+		for (size_t i = 0; i < 3; i++) {
+			EXPECT_NEAR(fast[i], precise[i], 1e-6f);
+		}
+
+		const float yaw = deg(gen), pitch = deg(gen), roll = deg(gen);
+		laml::Mat3 rot_precise, rot_fast;
+		laml::transform::create_transform_rotation(rot_precise, yaw, pitch, roll, laml::math::precise());
+		laml::transform::create_transform_rotation(rot_fast, yaw, pitch, roll, laml::math::fast());
+		for (size_t c = 0; c < 3; c++) {
+			for (size_t r = 0; r < 3; r++) {
+				EXPECT_NEAR(rot_fast[c][r], rot_precise[c][r], 1e-6f);
+			}
+		}
+
+		// q and -q are the same rotation
+		const laml::Quat q1 = laml::transform::quat_from_ypr(yaw, pitch, roll, laml::math::fast());
+		const laml::Quat q2 = laml::transform::quat_from_ypr(roll, yaw, pitch, laml::math::precise());
+		const laml::Quat q1_precise = laml::transform::quat_from_ypr(yaw, pitch, roll, laml::math::precise());
+		EXPECT_NEAR(std::fabs(laml::dot(q1, q1_precise)), 1.0f, 1e-5f);
+
+		const float t = factor(gen);
+		const laml::Quat s_precise = laml::slerp(q1_precise, q2, t, laml::math::precise());
+		const laml::Quat s_fast = laml::slerp(q1_precise, q2, t, laml::math::fast());
+		for (size_t i = 0; i < 4; i++) {
+			EXPECT_NEAR(s_fast[i], s_precise[i], 1e-4f);
+		}
+	}
+
+	// precise is what the functions did all along
+#if !defined(LAML_FAST_MATH)
+	const laml::Vec3 v(1.0f, 2.0f, 3.0f);
+	EXPECT_TRUE(laml::normalize(v) == laml::normalize(v, laml::math::precise()));
+	laml::Mat4 a, b;
+	laml::transform::create_transform_rotation(a, 10.0f, 20.0f, 30.0f);
+	laml::transform::create_transform_rotation(b, 10.0f, 20.0f, 30.0f, laml::math::precise());
+	EXPECT_TRUE(a == b);
+#endif
+
+	// the zero vector stays zero either way
+	EXPECT_TRUE(laml::normalize(laml::Vec3(0.0f), laml::math::fast()) == laml::Vec3(0.0f));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Frustum.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+static bool is_set(const std::vector<uint32>& mask, size_t n) {
+	return (mask[n / 32] >> (n % 32)) & 1u;
+}
+
+TEST(Frustum, planes) {
+	// camera at the origin looking down -Z
+	laml::Mat4 proj;
+	laml::transform::create_projection_perspective(proj, 90.0f, 1.0f, 1.0f, 100.0f);
+	laml::Frustum<float> frustum(proj);
+
+	EXPECT_TRUE(laml::contains(frustum, laml::Vec3(0.0f, 0.0f, -10.0f)));
+	EXPECT_TRUE(laml::contains(frustum, laml::Vec3(9.0f, -9.0f, -10.0f)));
+	EXPECT_FALSE(laml::contains(frustum, laml::Vec3(11.0f, 0.0f, -10.0f)));
+	EXPECT_FALSE(laml::contains(frustum, laml::Vec3(0.0f, 0.0f, 10.0f)));
+	EXPECT_FALSE(laml::contains(frustum, laml::Vec3(0.0f, 0.0f, -0.5f)));
+	EXPECT_FALSE(laml::contains(frustum, laml::Vec3(0.0f, 0.0f, -101.0f)));
+
+	// planes are normalized, so the sphere tests work in world units
+	EXPECT_NEAR(frustum.planes[laml::Frustum<float>::plane_far].w, 100.0f, 1e-3f);
+	EXPECT_TRUE(laml::intersects_sphere(frustum, laml::Vec3(0.0f, 0.0f, -101.0f), 1.5f));
+	EXPECT_FALSE(laml::intersects_sphere(frustum, laml::Vec3(0.0f, 0.0f, -101.0f), 0.5f));
+	EXPECT_TRUE(laml::intersects_aabb(frustum, laml::Vec3(12.0f, 0.0f, -10.0f), laml::Vec3(2.5f, 1.0f, 1.0f)));
+	EXPECT_FALSE(laml::intersects_aabb(frustum, laml::Vec3(14.0f, 0.0f, -10.0f), laml::Vec3(1.0f, 1.0f, 1.0f)));
+
+	// any view-projection: points agree with the clip-space test away from the boundary
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	laml::Mat4 camera, view, view_proj;
+	laml::transform::create_transform(camera, 30.0f, 20.0f, 10.0f, laml::Vec3(5.0f, -3.0f, 2.0f));
+	laml::transform::create_view_matrix_from_transform(view, camera);
+	view_proj = laml::mul(proj, view);
+	laml::Frustum<float> moved(view_proj);
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		const laml::Vec3 point(dis(gen), dis(gen), dis(gen));
+		const laml::Vec4 clip = laml::transform::transform_point(view_proj, laml::Vec4(point, 1.0f));
+		float margin = clip.w - laml::abs(clip.x);
+		margin = std::min(margin, clip.w - laml::abs(clip.y));
+		margin = std::min(margin, clip.w - laml::abs(clip.z));
+		if (laml::abs(margin) > 1e-3f * (1.0f + laml::abs(clip.w))) {
+			EXPECT_EQ(laml::contains(moved, point), margin > 0.0f);
+		}
+	}
+}
+
+TEST(Frustum, cull) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-200.0, 200.0);
+	std::uniform_real_distribution<float> size(0.0, 20.0);
+
+	laml::Mat4 proj, camera, view;
+	laml::transform::create_projection_perspective(proj, 60.0f, 1.5f, 0.1f, 150.0f);
+	laml::transform::create_transform(camera, 10.0f, -20.0f, 0.0f, laml::Vec3(1.0f, 2.0f, 3.0f));
+	laml::transform::create_view_matrix_from_transform(view, camera);
+	laml::Frustum<float> frustum(laml::mul(proj, view));
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets or words
+	std::vector<laml::Vec3> centers(count), extents(count);
+	std::vector<float> radii(count);
+	for (size_t n = 0; n < count; n++) {
+		centers[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		extents[n] = laml::Vec3(size(gen), size(gen), size(gen));
+		radii[n] = size(gen);
+	}
+	laml::soa::Vec3Array soa_centers(centers.data(), count), soa_extents(extents.data(), count);
+
+	const size_t words = laml::cull_mask_words(count);
+	std::vector<uint32> spheres(words, ~0u), aos_spheres(words, ~0u), threaded_spheres(words, ~0u);
+	std::vector<uint32> boxes(words, ~0u), aos_boxes(words, ~0u), threaded_boxes(words, ~0u);
+	laml::cull_spheres(frustum, soa_centers, radii.data(), spheres.data());
+	laml::cull_spheres(frustum, laml::soa::view(centers.data(), count), radii.data(), aos_spheres.data());
+	laml::parallel::cull_spheres(frustum, soa_centers, radii.data(), threaded_spheres.data(), 256);
+	laml::cull_aabbs(frustum, soa_centers, soa_extents, boxes.data());
+	laml::cull_aabbs(frustum, laml::soa::view(centers.data(), count), laml::soa::view(extents.data(), count), aos_boxes.data());
+	laml::parallel::cull_aabbs(frustum, soa_centers, soa_extents, threaded_boxes.data(), 256);
+
+	size_t num_visible = 0;
+	for (size_t n = 0; n < count; n++) {
+		const bool sphere = laml::intersects_sphere(frustum, centers[n], radii[n]);
+		EXPECT_EQ(is_set(spheres, n), sphere);
+		EXPECT_EQ(is_set(aos_spheres, n), sphere);
+		EXPECT_EQ(is_set(threaded_spheres, n), sphere);
+
+		const bool box = laml::intersects_aabb(frustum, centers[n], extents[n]);
+		EXPECT_EQ(is_set(boxes, n), box);
+		EXPECT_EQ(is_set(aos_boxes, n), box);
+		EXPECT_EQ(is_set(threaded_boxes, n), box);
+		num_visible += sphere ? 1 : 0;
+	}
+	EXPECT_GT(num_visible, 0u);
+	EXPECT_LT(num_visible, count);
+
+	// bits past the last object are cleared
+	for (size_t n = count; n < words * 32; n++) {
+		EXPECT_FALSE(is_set(spheres, n));
+		EXPECT_FALSE(is_set(boxes, n));
+	}
+}
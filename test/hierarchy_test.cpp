@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Hierarchy.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+#include "test_random.h"
+
+// world matrices straight from the definition: world = world[parent] * T * R * S
+static std::vector<laml::Mat4> reference_worlds(const laml::TransformHierarchy<float>& h) {
+	std::vector<laml::Mat4> worlds(h.size());
+	for (size_t n = 0; n < h.size(); n++) {
+		laml::Mat4 local;
+		laml::transform::create_transform(local, h.rotation(n), h.translation(n), h.scale(n));
+		worlds[n] = (h.parent(n) == h.npos) ? local : laml::mul(worlds[h.parent(n)], local);
+	}
+	return worlds;
+}
+
+static void expect_worlds(const laml::TransformHierarchy<float>& h, const std::vector<laml::Mat4>& ref) {
+	for (size_t n = 0; n < h.size(); n++) {
+		for (size_t k = 0; k < 16; k++) {
+			EXPECT_NEAR(h.world(n)._data[k], ref[n]._data[k], 1e-3f * (1.0f + laml::abs(ref[n]._data[k])));
+		}
+	}
+}
+
+TEST(Multiply, Matrix4_affine) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Mat4 m1(1.0f), m2(1.0f);
+		for (size_t c = 0; c < 4; c++) {
+			for (size_t r = 0; r < 3; r++) {
+				m1[c][r] = dis(gen);
+				m2[c][r] = dis(gen);
+			}
+		}
+		laml::Mat4 full = laml::mul(m1, m2);
+		laml::Mat4 affine = laml::mul_affine(m1, m2);
+		laml::Mat4 generic = laml::mul_affine<float>(m1, m2);
+		for (size_t k = 0; k < 16; k++) {
+			EXPECT_EQ(affine._data[k], generic._data[k]);
+			EXPECT_NEAR(affine._data[k], full._data[k], 1e-2f);
+		}
+	}
+}
+
+TEST(Hierarchy, update) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> scale(0.5, 1.5);
+
+	// random forest: every node's parent is an earlier node, or none
+	laml::TransformHierarchy<float> h;
+	const size_t num_nodes = 5000;
+	for (size_t n = 0; n < num_nodes; n++) {
+		size_t parent = (n == 0 || n % 97 == 0) ? h.npos : std::uniform_int_distribution<size_t>(n > 8 ? n - 8 : 0, n - 1)(gen);
+		EXPECT_EQ(h.add_node(parent, random_unit_quat(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)),
+			laml::Vec3(scale(gen), scale(gen), scale(gen))), n);
+	}
+	EXPECT_EQ(h.add_node(num_nodes + 10), h.npos); // parent must come first
+	EXPECT_TRUE(h.dirty());
+
+	h.update();
+	EXPECT_FALSE(h.dirty());
+	expect_worlds(h, reference_worlds(h));
+
+	// change a node in the middle: only it and its descendants may move
+	std::vector<laml::Mat4> before(h.worlds(), h.worlds() + h.size());
+	const size_t changed = num_nodes / 2;
+	h.set_translation(changed, laml::Vec3(100.0f, 0.0f, 0.0f));
+	h.update();
+	std::vector<laml::Mat4> ref = reference_worlds(h);
+	expect_worlds(h, ref);
+	for (size_t n = 0; n < changed; n++) {
+		for (size_t k = 0; k < 16; k++) {
+			EXPECT_EQ(h.world(n)._data[k], before[n]._data[k]);
+		}
+	}
+
+	// the threaded update gives the same result
+	laml::TransformHierarchy<float> copy(h);
+	for (size_t n = 0; n < num_nodes; n += 13) {
+		laml::Quat q = random_unit_quat(gen);
+		h.set_rotation(n, q);
+		copy.set_rotation(n, q);
+	}
+	h.update();
+	copy.update_parallel(16);
+	for (size_t n = 0; n < num_nodes; n++) {
+		for (size_t k = 0; k < 16; k++) {
+			EXPECT_EQ(copy.world(n)._data[k], h.world(n)._data[k]);
+		}
+	}
+	expect_worlds(copy, reference_worlds(copy));
+}
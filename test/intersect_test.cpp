@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Intersect.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+static bool is_set(const std::vector<uint32>& mask, size_t n) {
+	return (mask[n / 32] >> (n % 32)) & 1u;
+}
+
+TEST(Intersect, triangle) {
+	const laml::Vec3 v0(0.0f, 0.0f, 0.0f), v1(2.0f, 0.0f, 0.0f), v2(0.0f, 2.0f, 0.0f);
+	float t = 100.0f, u = -1.0f, v = -1.0f;
+	EXPECT_TRUE(laml::intersects_triangle(laml::Ray3(laml::Vec3(0.5f, 0.5f, 5.0f), laml::Vec3(0.0f, 0.0f, -1.0f)), v0, v1, v2, t, u, v));
+	EXPECT_FLOAT_EQ(t, 5.0f);
+	EXPECT_FLOAT_EQ(u, 0.25f);
+	EXPECT_FLOAT_EQ(v, 0.25f);
+
+	// two-sided, and t is in units of the direction's length
+	t = 100.0f;
+	EXPECT_TRUE(laml::intersects_triangle(laml::Ray3(laml::Vec3(0.5f, 0.5f, -5.0f), laml::Vec3(0.0f, 0.0f, 2.0f)), v0, v1, v2, t));
+	EXPECT_FLOAT_EQ(t, 2.5f);
+
+	// misses leave t alone
+	t = 100.0f;
+	EXPECT_FALSE(laml::intersects_triangle(laml::Ray3(laml::Vec3(1.5f, 1.5f, 5.0f), laml::Vec3(0.0f, 0.0f, -1.0f)), v0, v1, v2, t));
+	EXPECT_FALSE(laml::intersects_triangle(laml::Ray3(laml::Vec3(0.5f, 0.5f, 5.0f), laml::Vec3(0.0f, 0.0f, 1.0f)), v0, v1, v2, t));
+	EXPECT_FALSE(laml::intersects_triangle(laml::Ray3(laml::Vec3(0.5f, 0.5f, 1.0f), laml::Vec3(1.0f, 0.0f, 0.0f)), v0, v1, v2, t));
+	EXPECT_EQ(t, 100.0f);
+	t = 4.0f;
+	EXPECT_FALSE(laml::intersects_triangle(laml::Ray3(laml::Vec3(0.5f, 0.5f, 5.0f), laml::Vec3(0.0f, 0.0f, -1.0f)), v0, v1, v2, t));
+	EXPECT_EQ(t, 4.0f);
+}
+
+TEST(Intersect, packet) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+	typedef laml::RayPacket<float> Packet;
+	typedef laml::simd::packet<float> P;
+
+	size_t num_hits = 0;
+	for (size_t n = 0; n < NUM_LOOPS / Packet::width; n++) {
+		std::vector<laml::Ray3> rays(Packet::width);
+		for (size_t k = 0; k < Packet::width; k++) {
+			// some rays run exactly along an axis, to hit the infinite inverse directions
+			laml::Vec3 dir(unit(gen), unit(gen), unit(gen));
+			dir[k % 3] = (k % 4 == 0) ? 0.0f : dir[k % 3];
+			rays[k] = laml::Ray3(laml::Vec3(dis(gen), dis(gen), dis(gen)), dir);
+		}
+		const Packet packet(rays.data(), rays.size());
+		const laml::Vec3 c(dis(gen), dis(gen), dis(gen)), e(laml::abs(dis(gen)), laml::abs(dis(gen)), laml::abs(dis(gen)));
+		const laml::Aabb3 box(c - e, c + e);
+		const laml::Vec3 v0(dis(gen), dis(gen), dis(gen)), v1(dis(gen), dis(gen), dis(gen)), v2(dis(gen), dis(gen), dis(gen));
+
+		P t_enter;
+		const uint32 box_hits = laml::intersects_aabb(packet, box, laml::simd::set1(15.0f), t_enter);
+		P t = laml::simd::set1(30.0f), u = laml::simd::set1(0.0f), v = laml::simd::set1(0.0f);
+		const uint32 tri_hits = laml::intersects_triangle(packet, v0, v1, v2, t, u, v);
+		float enter[Packet::width], ts[Packet::width], us[Packet::width], vs[Packet::width];
+		laml::simd::storeu(enter, t_enter);
+		laml::simd::storeu(ts, t);
+		laml::simd::storeu(us, u);
+		laml::simd::storeu(vs, v);
+
+		for (size_t k = 0; k < Packet::width; k++) {
+			float ref_enter;
+			const bool box_hit = laml::intersects(rays[k], box, 15.0f, ref_enter);
+			EXPECT_EQ(((box_hits >> k) & 1u) != 0, box_hit);
+			if (box_hit) {
+				EXPECT_EQ(enter[k], ref_enter);
+			}
+
+			float ref_t = 30.0f, ref_u = 0.0f, ref_v = 0.0f;
+			const bool tri_hit = laml::intersects_triangle(rays[k], v0, v1, v2, ref_t, ref_u, ref_v);
+			EXPECT_EQ(((tri_hits >> k) & 1u) != 0, tri_hit);
+			EXPECT_EQ(ts[k], ref_t);
+			EXPECT_EQ(us[k], ref_u);
+			EXPECT_EQ(vs[k], ref_v);
+			num_hits += tri_hit ? 1 : 0;
+		}
+	}
+	EXPECT_GT(num_hits, 0u);
+
+	// the interval is closed: a box entered exactly at t_max is hit, as in the scalar test
+	const laml::Ray3 ray(laml::Vec3(0.0f, 0.5f, 0.5f), laml::Vec3(1.0f, 0.0f, 0.0f));
+	const laml::Aabb3 box(laml::Vec3(4.0f, 0.0f, 0.0f), laml::Vec3(5.0f, 1.0f, 1.0f));
+	const std::vector<laml::Ray3> rays(Packet::width, ray);
+	const Packet packet(rays.data(), rays.size());
+	const uint32 all = (Packet::width == 32) ? ~0u : ((1u << Packet::width) - 1u);
+	float ref_enter;
+	P t_enter;
+	EXPECT_TRUE(laml::intersects(ray, box, 4.0f, ref_enter));
+	EXPECT_EQ(laml::intersects_aabb(packet, box, laml::simd::set1(4.0f), t_enter), all);
+	EXPECT_FALSE(laml::intersects(ray, box, std::nextafter(4.0f, 0.0f), ref_enter));
+	EXPECT_EQ(laml::intersects_aabb(packet, box, laml::simd::set1(std::nextafter(4.0f, 0.0f)), t_enter), 0u);
+}
+
+TEST(Intersect, stream) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	const size_t count = 1000 + 3; // not a whole number of packets or words
+	const size_t num_triangles = 100;
+	std::vector<laml::Ray3> rays(count);
+	laml::soa::Vec3Array origins(count), directions(count), inv_directions(count);
+	for (size_t n = 0; n < count; n++) {
+		rays[n] = laml::Ray3(laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(unit(gen), unit(gen), unit(gen)));
+		origins.set(n, rays[n].origin);
+		directions.set(n, rays[n].direction);
+		inv_directions.set(n, rays[n].inv_direction);
+	}
+	std::vector<laml::Vec3> soup(3 * num_triangles);
+	for (size_t n = 0; n < soup.size(); n++) {
+		soup[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	const laml::RayStream<float> aos = laml::soa::view(rays.data(), count);
+	const laml::RayStream<float> soa{ origins, directions, inv_directions };
+
+	// slab test against one box
+	const laml::Aabb3 box(laml::Vec3(-3.0f), laml::Vec3(4.0f));
+	std::vector<float> t_max(count, 8.0f);
+	std::vector<uint32> aos_hits(laml::hit_mask_words(count), ~0u), soa_hits(laml::hit_mask_words(count), ~0u);
+	laml::intersects_aabb(aos, box, t_max.data(), aos_hits.data());
+	laml::intersects_aabb(soa, box, t_max.data(), soa_hits.data());
+	for (size_t n = 0; n < count; n++) {
+		const bool hit = laml::intersects(rays[n], box, 8.0f);
+		EXPECT_EQ(is_set(aos_hits, n), hit);
+		EXPECT_EQ(is_set(soa_hits, n), hit);
+	}
+	for (size_t n = count; n < aos_hits.size() * 32; n++) {
+		EXPECT_FALSE(is_set(aos_hits, n));
+	}
+
+	// closest triangle of the soup, against the scalar loop
+	std::vector<float> ref_t(count, 50.0f), ref_u(count, 0.0f), ref_v(count, 0.0f);
+	std::vector<uint32> ref_tri(count, ~0u);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t i = 0; i < num_triangles; i++) {
+			if (laml::intersects_triangle(rays[n], soup[3 * i], soup[3 * i + 1], soup[3 * i + 2], ref_t[n], ref_u[n], ref_v[n])) {
+				ref_tri[n] = static_cast<uint32>(i);
+			}
+		}
+	}
+	for (size_t pass = 0; pass < 3; pass++) {
+		std::vector<float> t(count, 50.0f), u(count, 0.0f), v(count, 0.0f);
+		std::vector<uint32> tri(count, ~0u);
+		if (pass == 0) {
+			laml::intersect_triangles(aos, soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data());
+		}
+		else if (pass == 1) {
+			laml::intersect_triangles(soa, soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data());
+		}
+		else {
+			laml::parallel::intersect_triangles(soa, soup.data(), num_triangles, t.data(), u.data(), v.data(), tri.data(), 64);
+		}
+		size_t num_hits = 0;
+		for (size_t n = 0; n < count; n++) {
+			EXPECT_EQ(t[n], ref_t[n]);
+			EXPECT_EQ(u[n], ref_u[n]);
+			EXPECT_EQ(v[n], ref_v[n]);
+			EXPECT_EQ(tri[n], ref_tri[n]);
+			num_hits += (tri[n] != ~0u) ? 1 : 0;
+		}
+		EXPECT_GT(num_hits, 0u);
+	}
+}
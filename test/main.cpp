@@ -1,3 +1,4 @@
+#define LAML_STD_INCLUDE // operator<< for the types
 #include <laml/laml.hpp>
 
 #include<iostream>
@@ -5,11 +6,9 @@
 #include <random>
 
 #ifndef UNREFERENCED_PARAMETER
-#define UNREFERENCED_PARAMETER(x) x
+#define UNREFERENCED_PARAMETER(x) (void)(x)
 #endif
 
-using namespace rh;
-
 int main(int argc, char** argv) {
 	UNREFERENCED_PARAMETER(argc);
 	UNREFERENCED_PARAMETER(argv);
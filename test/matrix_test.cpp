@@ -24,19 +24,19 @@ TEST(Constructors, Matrix2) {
 		float f7 = dis(gen);
 		float f8 = dis(gen);
 
-		rh::laml::Matrix<float, 2, 2> mat1;
+		laml::Matrix<float, 2, 2> mat1;
 		mat1[0][0] = f1;
 		mat1[0][1] = f2;
 		mat1[1][0] = f3;
 		mat1[1][1] = f4;
 
-		rh::laml::Matrix<float, 2, 2> mat2;
+		laml::Matrix<float, 2, 2> mat2;
 		mat2[0][0] = f5;
 		mat2[0][1] = f6;
 		mat2[1][0] = f7;
 		mat2[1][1] = f8;
 
-		rh::laml::Matrix<float, 2, 2> mat3 = rh::laml::mul(mat1, mat2);
+		laml::Matrix<float, 2, 2> mat3 = laml::mul(mat1, mat2);
 		
 		EXPECT_FLOAT_EQ(mat3[0][0], mat1[0][0] * mat2[0][0] + mat1[1][0] * mat2[0][1]);
 		EXPECT_FLOAT_EQ(mat3[0][1], mat1[0][1] * mat2[0][0] + mat1[1][1] * mat2[0][1]);
@@ -76,7 +76,7 @@ TEST(Constructors, Matrix3) {
 		float g8 = dis(gen);
 		float g9 = dis(gen);
 
-		rh::laml::Matrix<float, 3, 3> mat1;
+		laml::Matrix<float, 3, 3> mat1;
 		mat1[0][0] = f1;
 		mat1[0][1] = f2;
 		mat1[0][2] = f3;
@@ -87,7 +87,7 @@ TEST(Constructors, Matrix3) {
 		mat1[2][1] = f8;
 		mat1[2][2] = f9;
 
-		rh::laml::Matrix<float, 3, 3> mat2;
+		laml::Matrix<float, 3, 3> mat2;
 		mat2[0][0] = g1;
 		mat2[0][1] = g2;
 		mat2[0][2] = g3;
@@ -98,7 +98,7 @@ TEST(Constructors, Matrix3) {
 		mat2[2][1] = g8;
 		mat2[2][2] = g9;
 
-		rh::laml::Matrix<float, 3, 3> mat3 = rh::laml::mul(mat1, mat2);
+		laml::Matrix<float, 3, 3> mat3 = laml::mul(mat1, mat2);
 
 		EXPECT_FLOAT_EQ(mat3[0][0], mat1[0][0] * mat2[0][0] + mat1[1][0] * mat2[0][1] + mat1[2][0] * mat2[0][2]); // col 1
 		EXPECT_FLOAT_EQ(mat3[0][1], mat1[0][1] * mat2[0][0] + mat1[1][1] * mat2[0][1] + mat1[2][1] * mat2[0][2]);
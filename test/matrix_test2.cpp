@@ -24,11 +24,11 @@ TEST(Constructors, Matrix2_specialization) {
 		float f7 = dis(gen);
 		float f8 = dis(gen);
 
-		rh::laml::Matrix<float, 2, 2> mat1(f1, f2, f3, f4);
+		laml::Matrix<float, 2, 2> mat1(f1, f2, f3, f4);
 
-		rh::laml::Matrix<float, 2, 2> mat2(f5, f6, f7, f8);
+		laml::Matrix<float, 2, 2> mat2(f5, f6, f7, f8);
 
-		rh::laml::Matrix<float, 2, 2> mat3 = rh::laml::mul(mat1, mat2);
+		laml::Matrix<float, 2, 2> mat3 = laml::mul(mat1, mat2);
 
 		EXPECT_FLOAT_EQ(mat3[0][0], mat1[0][0] * mat2[0][0] + mat1[1][0] * mat2[0][1]);
 		EXPECT_FLOAT_EQ(mat3[0][1], mat1[0][1] * mat2[0][0] + mat1[1][1] * mat2[0][1]);
@@ -68,11 +68,11 @@ TEST(Constructors, Matrix3_specialization) {
 		float g8 = dis(gen);
 		float g9 = dis(gen);
 
-		rh::laml::Matrix<float, 3, 3> mat1(f1, f2, f3, f4, f5, f6, f7, f8, f9);
+		laml::Matrix<float, 3, 3> mat1(f1, f2, f3, f4, f5, f6, f7, f8, f9);
 
-		rh::laml::Matrix<float, 3, 3> mat2(g1, g2, g3, g4, g5, g6, g7, g8, g9);
+		laml::Matrix<float, 3, 3> mat2(g1, g2, g3, g4, g5, g6, g7, g8, g9);
 
-		rh::laml::Matrix<float, 3, 3> mat3 = rh::laml::mul(mat1, mat2);
+		laml::Matrix<float, 3, 3> mat3 = laml::mul(mat1, mat2);
 
 		EXPECT_FLOAT_EQ(mat3[0][0], mat1[0][0] * mat2[0][0] + mat1[1][0] * mat2[0][1] + mat1[2][0] * mat2[0][2]); // col 1
 		EXPECT_FLOAT_EQ(mat3[0][1], mat1[0][1] * mat2[0][0] + mat1[1][1] * mat2[0][1] + mat1[2][1] * mat2[0][2]);
@@ -86,4 +86,163 @@ TEST(Constructors, Matrix3_specialization) {
 		EXPECT_FLOAT_EQ(mat3[2][1], mat1[0][1] * mat2[2][0] + mat1[1][1] * mat2[2][1] + mat1[2][1] * mat2[2][2]);
 		EXPECT_FLOAT_EQ(mat3[2][2], mat1[0][2] * mat2[2][0] + mat1[1][2] * mat2[2][1] + mat1[2][2] * mat2[2][2]);
 	}
-}
\ No newline at end of file
+}
+
+TEST(Multiply, Matrix4_specialization) {
+	// The 4x4 specialization (SIMD or unrolled) must match the generic triple-loop exactly
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
+	for (size_t N = 0; N < NUM_LOOPS; N++) {
+		laml::Matrix<float, 4, 4> mat1, mat2;
+		for (size_t n = 0; n < 16; n++) {
+			mat1._data[n] = dis(gen);
+			mat2._data[n] = dis(gen);
+		}
+
+		laml::Matrix<float, 4, 4> fast = laml::mul(mat1, mat2);
+		laml::Matrix<float, 4, 4> slow = laml::mul<float, 4, 4, 4, 4>(mat1, mat2);
+		for (size_t n = 0; n < 16; n++) {
+			EXPECT_EQ(fast._data[n], slow._data[n]);
+		}
+	}
+}
+
+TEST(Multiply, Matrix4_highp_specialization) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-100000.0, 100000.0);
+	for (size_t N = 0; N < NUM_LOOPS; N++) {
+		laml::Matrix<double, 4, 4> mat1, mat2;
+		for (size_t n = 0; n < 16; n++) {
+			mat1._data[n] = dis(gen);
+			mat2._data[n] = dis(gen);
+		}
+
+		laml::Matrix<double, 4, 4> fast = laml::mul(mat1, mat2);
+		laml::Matrix<double, 4, 4> slow = laml::mul<double, 4, 4, 4, 4>(mat1, mat2);
+		for (size_t n = 0; n < 16; n++) {
+			EXPECT_EQ(fast._data[n], slow._data[n]);
+		}
+	}
+}
+
+TEST(Inverse, Matrix4_specialization) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-1.0, 1.0);
+	for (size_t N = 0; N < NUM_LOOPS; N++) {
+		// diagonally dominant, so always well conditioned
+		laml::Matrix<double, 4, 4> mat(4.0);
+		for (size_t n = 0; n < 16; n++) {
+			mat._data[n] += dis(gen);
+		}
+
+		double det_generic = laml::det<double, 4>(mat);
+		EXPECT_NEAR(laml::det(mat), det_generic, 1e-10);
+
+		laml::Matrix<double, 4, 4> inv = laml::inverse(mat);
+		laml::Matrix<double, 4, 4> inv_generic = laml::inverse<double, 4, 4>(mat);
+		laml::Matrix<double, 4, 4> ident = laml::mul(mat, inv);
+		for (size_t col = 0; col < 4; col++) {
+			for (size_t row = 0; row < 4; row++) {
+				EXPECT_NEAR(inv[col][row], inv_generic[col][row], 1e-12);
+				EXPECT_NEAR(ident[col][row], col == row ? 1.0 : 0.0, 1e-12);
+			}
+		}
+	}
+}
+
+TEST(Inverse, Matrix4_affine) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+	for (size_t N = 0; N < NUM_LOOPS; N++) {
+		laml::Vec3 trans(dis(gen), dis(gen), dis(gen));
+
+		laml::Mat4 rigid;
+		laml::transform::create_transform(rigid, angle(gen), angle(gen), angle(gen), trans);
+		laml::Mat4 affine;
+		laml::transform::create_transform(affine, angle(gen), angle(gen), angle(gen), trans, laml::Vec3(scale(gen), scale(gen), scale(gen)));
+
+		laml::Mat4 rigid_inv = laml::inverse_rigid(rigid);
+		laml::Mat4 rigid_ref = laml::inverse(rigid);
+		laml::Mat4 affine_inv = laml::inverse_affine(affine);
+		laml::Mat4 affine_ref = laml::inverse(affine);
+		for (size_t n = 0; n < 16; n++) {
+			EXPECT_NEAR(rigid_inv._data[n], rigid_ref._data[n], 1e-3f);
+			EXPECT_NEAR(affine_inv._data[n], affine_ref._data[n], 1e-3f);
+		}
+		EXPECT_EQ(affine_inv.c_41, 0.0f);
+		EXPECT_EQ(affine_inv.c_44, 1.0f);
+	}
+}
+
+TEST(Inverse, generic_lu) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-1.0, 1.0);
+	for (size_t N = 0; N < NUM_LOOPS / 10; N++) {
+		laml::Matrix<double, 7, 7> mat, other;
+		laml::Vector<double, 7> b;
+		for (size_t col = 0; col < 7; col++) {
+			b[col] = dis(gen);
+			for (size_t row = 0; row < 7; row++) {
+				mat[col][row] = dis(gen);
+				other[col][row] = dis(gen);
+			}
+		}
+
+		const laml::Lu<double, 7> f = laml::lu(mat);
+		ASSERT_FALSE(f.singular);
+		EXPECT_GT(f.rcond, 0.0);
+		EXPECT_LE(f.rcond, 1.0);
+		EXPECT_NEAR(laml::det(laml::mul(mat, other)), laml::det(mat) * laml::det(other), 1e-9);
+
+		laml::Matrix<double, 7, 7> ident = laml::mul(mat, laml::inverse(mat));
+		laml::Vector<double, 7> x = laml::solve(f, b);
+		laml::Vector<double, 7> ax = laml::solve(mat, b);
+		for (size_t col = 0; col < 7; col++) {
+			double sum = 0.0;
+			for (size_t row = 0; row < 7; row++) {
+				EXPECT_NEAR(ident[col][row], col == row ? 1.0 : 0.0, 1e-8 / f.rcond);
+				sum += mat[row][col] * x[row];
+			}
+			EXPECT_NEAR(sum, b[col], 1e-10 / f.rcond);
+			EXPECT_EQ(x[col], ax[col]);
+		}
+	}
+
+	// the generic path agrees with the closed forms
+	laml::Matrix<double, 3, 3> m3(2.0);
+	m3[2][0] = 1.0;
+	m3[0][1] = -3.0;
+	EXPECT_NEAR((laml::det<double, 3>(m3)), laml::det(m3), 1e-12);
+
+	// a well scaled matrix is well conditioned, a badly scaled one is not
+	laml::Matrix<double, 5, 5> scaled(1000.0);
+	EXPECT_DOUBLE_EQ(laml::lu(scaled).rcond, 1.0);
+	EXPECT_DOUBLE_EQ(laml::det(scaled), 1e15);
+	scaled[4][4] = 1e-6;
+	EXPECT_FALSE(laml::lu(scaled).singular);
+	EXPECT_NEAR(laml::lu(scaled).rcond, 1e-9, 1e-15);
+
+	// singular: reported by lu(), and inverse() hands the matrix back
+	laml::Matrix<double, 5, 5> singular(1.0);
+	singular[3] = singular[1] * 2.0 + singular[0];
+	const laml::Lu<double, 5> f = laml::lu(singular);
+	EXPECT_TRUE(f.singular);
+	EXPECT_EQ(f.rcond, 0.0);
+	EXPECT_EQ(laml::det(singular), 0.0);
+	laml::Matrix<double, 5, 5> inv = laml::inverse(singular);
+	EXPECT_TRUE(inv == singular);
+
+	// singular to working precision: a rounded row combination, caught by the condition estimate when the pivots miss it
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Matrix<double, 6, 6> rounded;
+		for (size_t col = 0; col < 6; col++) {
+			for (size_t row = 0; row < 6; row++) {
+				rounded[col][row] = dis(gen);
+			}
+			rounded[col][4] = 2.0 * rounded[col][1] - rounded[col][3];
+		}
+		EXPECT_TRUE(laml::lu(rounded).singular);
+	}
+}
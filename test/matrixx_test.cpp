@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/MatrixX.hpp>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+#include "test_config.h"
+
+template<typename T>
+static laml::MatrixX<T> random_matrix(size_t rows, size_t cols, std::mt19937& gen) {
+	std::uniform_real_distribution<T> dis(static_cast<T>(-1.0), static_cast<T>(1.0));
+	laml::MatrixX<T> res(rows, cols);
+	for (size_t c = 0; c < cols; c++) {
+		for (size_t r = 0; r < rows; r++) {
+			res(r, c) = dis(gen);
+		}
+	}
+	return res;
+}
+
+template<typename T>
+static T max_diff(const laml::ConstMatrixView<T>& a, const laml::ConstMatrixView<T>& b) {
+	T res = static_cast<T>(0.0);
+	for (size_t c = 0; c < a.cols(); c++) {
+		for (size_t r = 0; r < a.rows(); r++) {
+			res = std::max(res, std::abs(a(r, c) - b(r, c)));
+		}
+	}
+	return res;
+}
+
+TEST(MatrixX, storage) {
+	laml::MatX m(5, 3);
+	for (size_t c = 0; c < m.cols(); c++) {
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.col(c)) % laml::simd::alignment, 0u);
+		for (size_t r = 0; r < m.rows(); r++) {
+			EXPECT_EQ(m(r, c), 0.0f);
+			m(r, c) = static_cast<float>(10 * r + c);
+		}
+	}
+
+	// resize keeps what fits
+	m.resize(7, 2);
+	EXPECT_EQ(m(4, 1), 41.0f);
+	EXPECT_EQ(m(6, 1), 0.0f);
+	laml::MatX copy(m);
+	m(0, 0) = -1.0f;
+	EXPECT_EQ(copy(0, 0), 0.0f);
+	EXPECT_EQ(copy(4, 1), 41.0f);
+
+	// views over the fixed-size types read and write in place
+	laml::Mat4 fixed(1.0f);
+	fixed[3] = laml::Vec4(1.0f, 2.0f, 3.0f, 1.0f);
+	laml::MatrixView<float> fv = laml::view(fixed);
+	EXPECT_EQ(fv(1, 3), 2.0f);
+	EXPECT_EQ(fv(3, 3), 1.0f);
+	fv(0, 1) = 5.0f;
+	EXPECT_EQ(fixed[1][0], 5.0f);
+	// and const ones are read-only
+	const laml::Mat4& const_fixed = fixed;
+	static_assert(std::is_same<decltype(laml::view(const_fixed)), laml::ConstMatrixView<float>>::value, "read-only view of const data");
+	EXPECT_EQ(laml::view(const_fixed)(0, 1), 5.0f);
+
+	laml::VecX v(laml::Vec3(1.0f, 2.0f, 3.0f));
+	EXPECT_EQ(v.size(), 3u);
+	EXPECT_FLOAT_EQ(laml::dot(v, v), 14.0f);
+	laml::Vec3 back;
+	laml::copy(v * 2.0f, laml::view(back));
+	EXPECT_TRUE(back == laml::Vec3(2.0f, 4.0f, 6.0f));
+
+	laml::MatX t = laml::transpose(copy);
+	EXPECT_EQ(t.rows(), 2u);
+	EXPECT_EQ(t(1, 4), 41.0f);
+}
+
+TEST(MatrixX, gemm) {
+	std::mt19937 gen(1234);
+	std::uniform_int_distribution<size_t> size(1, 300);
+
+	for (size_t n = 0; n < 20; n++) {
+		// odd sizes on every side, to hit the partial packets and blocks
+		const size_t m = size(gen), k = size(gen), cols = size(gen) % 40 + 1;
+		const laml::MatX a = random_matrix<float>(m, k, gen);
+		const laml::MatX b = random_matrix<float>(k, cols, gen);
+		const laml::MatX c0 = random_matrix<float>(m, cols, gen);
+
+		laml::MatX ab(m, cols), ref(m, cols);
+		for (size_t j = 0; j < cols; j++) {
+			for (size_t i = 0; i < m; i++) {
+				double sum = 0.0;
+				for (size_t p = 0; p < k; p++) {
+					sum += static_cast<double>(a(i, p)) * b(p, j);
+				}
+				ab(i, j) = static_cast<float>(sum);
+				ref(i, j) = static_cast<float>(2.0 * sum - 0.5 * c0(i, j));
+			}
+		}
+		const float tolerance = 1e-6f * static_cast<float>(k);
+		EXPECT_LT(max_diff<float>(laml::mul(a, b), ab), tolerance);
+		laml::MatX c(c0);
+		laml::gemm(a, b, c, 2.0f, -0.5f);
+		EXPECT_LT(max_diff<float>(c, ref), 2.0f * tolerance);
+	}
+
+	// agrees with the fixed-size product
+	std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+	laml::Mat4 x, y;
+	for (size_t c = 0; c < 4; c++) {
+		for (size_t r = 0; r < 4; r++) {
+			x[c][r] = dis(gen);
+			y[c][r] = dis(gen);
+		}
+	}
+	const laml::MatX xy = laml::mul(laml::view(x), laml::view(y));
+	EXPECT_LT(max_diff(laml::view(laml::mul(x, y)), xy), 1e-6f);
+}
+
+TEST(MatrixX, lu) {
+	std::mt19937 gen(1234);
+
+	for (size_t n : { 1, 2, 7, 40, 129 }) {
+		const laml::MatX_highp a = random_matrix<double>(n, n, gen);
+		const laml::VecX_highp b(random_matrix<double>(n, 1, gen));
+		const laml::LuX<double> f = laml::lu(a);
+		EXPECT_FALSE(f.singular);
+		EXPECT_GT(f.rcond, 0.0);
+
+		const laml::VecX_highp x = laml::solve(f, b);
+		EXPECT_LT(max_diff<double>(laml::mul(a, x), b), 1e-9);
+		laml::MatX_highp eye(n, n);
+		laml::identity(eye);
+		EXPECT_LT(max_diff<double>(laml::mul(a, laml::inverse(f)), eye), 1e-9);
+	}
+
+	// det against the closed form of the fixed-size matrix
+	laml::Mat4_highp m;
+	std::uniform_real_distribution<double> dis(-1.0, 1.0);
+	for (size_t c = 0; c < 4; c++) {
+		for (size_t r = 0; r < 4; r++) {
+			m[c][r] = dis(gen);
+		}
+	}
+	EXPECT_NEAR(laml::det(laml::lu(laml::view(m))), laml::det(m), 1e-12);
+
+	// one row a combination of two others, rounded: a few of these keep every pivot above the tolerance
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::MatX_highp s = random_matrix<double>(6, 6, gen);
+		for (size_t c = 0; c < 6; c++) {
+			s(4, c) = 2.0 * s(1, c) - s(3, c);
+		}
+		EXPECT_TRUE(laml::lu(s).singular);
+	}
+	EXPECT_TRUE(laml::lu(laml::MatX(3, 3)).singular);
+}
+
+TEST(MatrixX, cholesky) {
+	std::mt19937 gen(1234);
+
+	for (size_t n : { 1, 3, 17, 100 }) {
+		// B B^T + n I is symmetric positive definite
+		const laml::MatX_highp m = random_matrix<double>(n, n, gen);
+		laml::MatX_highp a(n, n);
+		identity(a);
+		laml::gemm(m, laml::transpose(m), a, 1.0, static_cast<double>(n));
+		const laml::VecX_highp b(random_matrix<double>(n, 1, gen));
+
+		const laml::CholeskyX<double> f = laml::cholesky(a);
+		ASSERT_TRUE(f.positive_definite);
+		EXPECT_LT(max_diff<double>(laml::mul(f.l, laml::transpose(f.l)), a), 1e-10 * n);
+		EXPECT_LT(max_diff<double>(laml::mul(a, laml::solve(f, b)), b), 1e-10 * n);
+	}
+
+	laml::MatX_highp indefinite(2, 2);
+	identity(indefinite);
+	indefinite(1, 1) = -1.0;
+	EXPECT_FALSE(laml::cholesky(indefinite).positive_definite);
+}
+
+TEST(MatrixX, qr) {
+	std::mt19937 gen(1234);
+
+	for (size_t n : { 1, 4, 30, 80 }) {
+		const size_t rows = n + n / 2 + 1;
+		const laml::MatX_highp a = random_matrix<double>(rows, n, gen);
+		const laml::QrX<double> f = laml::qr(a);
+		EXPECT_TRUE(f.full_rank);
+
+		const laml::MatX_highp q = f.q();
+		laml::MatX_highp eye(n, n);
+		identity(eye);
+		EXPECT_LT(max_diff<double>(laml::mul(laml::transpose(q), q), eye), 1e-12 * rows);
+		EXPECT_LT(max_diff<double>(laml::mul(q, f.r()), a), 1e-12 * rows);
+
+		// least squares against the normal equations A^T A x = A^T b
+		const laml::VecX_highp b(random_matrix<double>(rows, 1, gen));
+		const laml::MatX_highp at = laml::transpose(a);
+		const laml::VecX_highp normal = laml::solve(laml::cholesky(laml::mul(at, a)), laml::mul(at, b));
+		EXPECT_LT(max_diff<double>(laml::solve(f, b), normal), 1e-9);
+	}
+
+	// two equal columns
+	laml::MatX_highp d = random_matrix<double>(8, 4, gen);
+	for (size_t r = 0; r < 8; r++) {
+		d(r, 2) = d(r, 0);
+	}
+	EXPECT_FALSE(laml::qr(d).full_rank);
+}
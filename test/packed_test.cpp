@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Packed.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+#include "test_random.h"
+
+static_assert(sizeof(laml::packed::Vec3_half) == 6, "2 bytes per component");
+static_assert(sizeof(laml::packed::Vec4_unorm8) == 4, "1 byte per component");
+static_assert(sizeof(laml::packed::Vec3_oct) == 4, "2 snorm16 per normal");
+static_assert(sizeof(laml::packed::Quat_smallest3) == 6, "48 bits per quaternion");
+
+static float half_roundtrip(float f) {
+	return static_cast<float>(laml::packed::half(f));
+}
+
+TEST(Packed, half) {
+	// exact values, the limits, and rounding to nearest even
+	EXPECT_EQ(laml::packed::half(1.0f).bits, 0x3c00);
+	EXPECT_EQ(laml::packed::half(-2.0f).bits, 0xc000);
+	EXPECT_EQ(laml::packed::half(65504.0f).bits, 0x7bff);
+	EXPECT_EQ(laml::packed::half(65519.0f).bits, 0x7bff);
+	EXPECT_EQ(laml::packed::half(65520.0f).bits, 0x7c00);
+	EXPECT_EQ(laml::packed::half(std::numeric_limits<float>::infinity()).bits, 0x7c00);
+	EXPECT_EQ(laml::packed::half(-0.0f).bits, 0x8000);
+	EXPECT_EQ(laml::packed::half(1.0f + 1.0f / 2048.0f).bits, 0x3c00);                 // tie, to even
+	EXPECT_EQ(laml::packed::half(1.0f + 3.0f / 2048.0f).bits, 0x3c02);                 // tie, to even
+	EXPECT_EQ(laml::packed::half(std::ldexp(1.0f, -24)).bits, 0x0001);                 // smallest subnormal
+	EXPECT_EQ(laml::packed::half(std::ldexp(1.0f, -25)).bits, 0x0000);                 // tie, to even
+	EXPECT_EQ(laml::packed::half(std::ldexp(3.0f, -25)).bits, 0x0002);                 // tie, to even
+	EXPECT_EQ(laml::packed::half(std::ldexp(1023.0f, -24)).bits, 0x03ff);              // largest subnormal
+	EXPECT_TRUE(std::isnan(half_roundtrip(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(half_roundtrip(std::ldexp(1.0f, -14)), std::ldexp(1.0f, -14));
+	EXPECT_EQ(half_roundtrip(-std::numeric_limits<float>::infinity()), -std::numeric_limits<float>::infinity());
+
+	// every half goes back to itself through float, one at a time and in batches
+	std::vector<laml::packed::half> all(0x10000), all_back(0x10000);
+	std::vector<float> all_floats(0x10000);
+	for (uint32 h = 0; h < 0x10000; h++) {
+		all[h].bits = static_cast<uint16>(h);
+	}
+	laml::packed::decode(all.data(), all_floats.data(), all.size());
+	laml::packed::encode(all_floats.data(), all_back.data(), all.size());
+	for (uint32 h = 0; h < 0x10000; h++) {
+		const float f = static_cast<float>(all[h]);
+		if (std::isnan(f)) {
+			EXPECT_EQ(h & 0x7c00u, 0x7c00u);
+			EXPECT_TRUE(std::isnan(all_floats[h]));
+			EXPECT_EQ(all_back[h].bits & 0x7c00u, 0x7c00u);
+			EXPECT_NE(all_back[h].bits & 0x3ffu, 0u);
+			continue;
+		}
+		EXPECT_EQ(all_floats[h], f);
+		EXPECT_EQ(laml::packed::half(f).bits, h);
+		EXPECT_EQ(all_back[h].bits, h);
+	}
+
+	// the rounding cases above in a batch, ties between every pair of neighbouring halves
+	std::vector<float> ties(0x7c00);
+	std::vector<laml::packed::half> ties_packed(ties.size());
+	for (uint32 h = 0; h < 0x7c00; h++) {
+		ties[h] = (static_cast<float>(all[h]) + static_cast<float>(all[h + 1])) * 0.5f;
+	}
+	laml::packed::encode(ties.data(), ties_packed.data(), ties.size());
+	for (uint32 h = 0; h < 0x7c00; h++) {
+		EXPECT_EQ(ties_packed[h].bits, laml::packed::half(ties[h]).bits);
+		EXPECT_EQ(ties_packed[h].bits, (h & 1u) ? h + 1 : h);
+	}
+
+	// documented error bounds, and the batch functions agree with the scalar ones
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-65504.0, 65504.0);
+	std::uniform_real_distribution<float> expo(-30.0, 15.0);
+	const size_t count = NUM_LOOPS + 3;
+	std::vector<laml::Vec3> vecs(count), back(count);
+	std::vector<laml::packed::Vec3_half> packed(count);
+	for (size_t n = 0; n < count; n++) {
+		vecs[n] = laml::Vec3(dis(gen), std::ldexp(dis(gen), static_cast<int>(expo(gen))) / 65504.0f, dis(gen) / 65504.0f);
+	}
+	laml::packed::encode(vecs.data(), packed.data(), count);
+	laml::packed::decode(packed.data(), back.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < 3; k++) {
+			const float x = vecs[n][k];
+			EXPECT_EQ(packed[n][k].bits, laml::packed::half(x).bits);
+			EXPECT_EQ(back[n][k], half_roundtrip(x));
+			if (std::fabs(x) >= std::ldexp(1.0f, -14)) {
+				EXPECT_LE(std::fabs(back[n][k] - x), std::fabs(x) * std::ldexp(1.0f, -11));
+			} else {
+				EXPECT_LE(std::fabs(back[n][k] - x), std::ldexp(1.0f, -25));
+			}
+		}
+	}
+}
+
+TEST(Packed, snorm_unorm) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0, 1.0);
+
+	const size_t count = NUM_LOOPS + 3;
+	std::vector<laml::Vec4> vecs(count), back(count);
+	std::vector<laml::packed::Vec4_snorm16> snorm(count);
+	std::vector<laml::packed::Vec4_unorm8> unorm(count);
+	for (size_t n = 0; n < count; n++) {
+		vecs[n] = laml::Vec4(dis(gen), dis(gen), dis(gen), dis(gen));
+	}
+	// the ends of the ranges, and values past them clamp
+	vecs[0] = laml::Vec4(-1.0f, 1.0f, 0.0f, -0.0f);
+	vecs[1] = laml::Vec4(-2.0f, 3.0f, std::numeric_limits<float>::quiet_NaN(), 0.5f);
+
+	laml::packed::encode(vecs.data(), snorm.data(), count);
+	laml::packed::decode(snorm.data(), back.data(), count);
+	EXPECT_TRUE(back[0] == laml::Vec4(-1.0f, 1.0f, 0.0f, 0.0f));
+	EXPECT_TRUE(back[1] == laml::Vec4(-1.0f, 1.0f, -1.0f, back[1][3]));
+	for (size_t n = 2; n < count; n++) {
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_LE(std::fabs(back[n][k] - vecs[n][k]), 1.0f / 65534.0f + 1e-7f);
+		}
+	}
+	laml::packed::Vec2_snorm16 lowest = { { -32768, 32767 } };
+	laml::Vec2 lowest_back;
+	laml::packed::decode(&lowest, &lowest_back, 1);
+	EXPECT_TRUE(lowest_back == laml::Vec2(-1.0f, 1.0f));
+
+	for (size_t n = 2; n < count; n++) {
+		vecs[n] = vecs[n] * 0.5f + laml::Vec4(0.5f);
+	}
+	laml::packed::encode(vecs.data(), unorm.data(), count);
+	laml::packed::decode(unorm.data(), back.data(), count);
+	EXPECT_TRUE(back[0] == laml::Vec4(0.0f, 1.0f, 0.0f, 0.0f));
+	EXPECT_TRUE(back[1] == laml::Vec4(0.0f, 1.0f, 0.0f, 128.0f / 255.0f));
+	for (size_t n = 2; n < count; n++) {
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_LE(std::fabs(back[n][k] - vecs[n][k]), 1.0f / 510.0f + 1e-7f);
+		}
+	}
+}
+
+TEST(Packed, oct_normal) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1.0, 1.0);
+
+	const size_t count = NUM_LOOPS + 3;
+	std::vector<laml::Vec3> normals(count), back(count);
+	std::vector<laml::packed::Vec3_oct> packed(count);
+	for (size_t n = 0; n < count; n++) {
+		normals[n] = laml::normalize(laml::Vec3(dis(gen), dis(gen), dis(gen)));
+	}
+	// the axes, and the diagonals the lower half folds over
+	const laml::Vec3 special[] = { laml::Vec3(1.0f, 0.0f, 0.0f), laml::Vec3(0.0f, -1.0f, 0.0f), laml::Vec3(0.0f, 0.0f, 1.0f),
+								   laml::Vec3(0.0f, 0.0f, -1.0f), laml::normalize(laml::Vec3(1.0f, -1.0f, 0.0f)),
+								   laml::normalize(laml::Vec3(-1.0f, 1.0f, -1.0f)), laml::normalize(laml::Vec3(1.0f, 1.0f, -1e-3f)) };
+	for (size_t n = 0; n < sizeof(special) / sizeof(special[0]); n++) {
+		normals[n] = special[n];
+	}
+
+	laml::packed::encode(normals.data(), packed.data(), count);
+	laml::packed::decode(packed.data(), back.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_NEAR(laml::length(back[n]), 1.0f, 1e-6f);
+		// the angle from the cross product's length; the dot product's acos is too coarse near 0
+		EXPECT_LT(laml::length(laml::cross(back[n], normals[n])), 7e-5f);
+		EXPECT_GT(laml::dot(back[n], normals[n]), 0.0f);
+	}
+}
+
+TEST(Packed, smallest3) {
+	std::mt19937 gen(1234);
+
+	const size_t count = NUM_LOOPS + 3;
+	std::vector<laml::Quat> quats(count), back(count);
+	std::vector<laml::packed::Quat_smallest3> packed(count);
+	for (size_t n = 0; n < count; n++) {
+		quats[n] = random_unit_quat(gen);
+	}
+	// identity, each component largest with either sign, and a tie
+	quats[0] = laml::Quat(0.0f, 0.0f, 0.0f, 1.0f);
+	quats[1] = laml::normalize(laml::Quat(-0.9f, 0.1f, -0.2f, 0.3f));
+	quats[2] = laml::normalize(laml::Quat(0.1f, 0.9f, 0.2f, -0.3f));
+	quats[3] = laml::normalize(laml::Quat(0.1f, 0.2f, -0.9f, -0.3f));
+	quats[4] = laml::normalize(laml::Quat(0.1f, 0.2f, 0.3f, -0.9f));
+	quats[5] = laml::normalize(laml::Quat(0.5f, -0.5f, 0.5f, -0.5f));
+
+	laml::packed::encode(quats.data(), packed.data(), count);
+	laml::packed::decode(packed.data(), back.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		// the same rotation, as q or -q
+		const float s = (laml::dot(back[n], quats[n]) < 0.0f) ? -1.0f : 1.0f;
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_NEAR(back[n][k] * s, quats[n][k], 7e-5f);
+		}
+	}
+}
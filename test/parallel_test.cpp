@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <atomic>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+TEST(Parallel, thread_pool) {
+	// a pool of its own, so there are workers to steal from even on a single core
+	laml::parallel::ThreadPool pool(3);
+	EXPECT_EQ(pool.concurrency(), 4u);
+	EXPECT_EQ(pool.max_concurrency(), 4u);
+
+	// every task runs exactly once, also when the cost of the tasks is very uneven
+	const size_t num_tasks = NUM_LOOPS + 7;
+	std::vector<std::atomic<int>> runs(num_tasks);
+	for (size_t threads : { 4, 2, 3, 1 }) {
+		pool.set_concurrency(threads);
+		EXPECT_EQ(pool.concurrency(), threads);
+		for (std::atomic<int>& r : runs) {
+			r = 0;
+		}
+		std::atomic<size_t> work{ 0 };
+		pool.run(num_tasks, [&](size_t i) {
+			runs[i]++;
+			// the last block takes far longer than the others, so it gets stolen from
+			const size_t spin = (i > num_tasks - num_tasks / 8) ? 2000 : 1;
+			for (size_t k = 0; k < spin; k++) {
+				work.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+		for (size_t i = 0; i < num_tasks; i++) {
+			EXPECT_EQ(runs[i].load(), 1);
+		}
+	}
+	pool.set_concurrency(0);
+	EXPECT_EQ(pool.concurrency(), 4u);
+	pool.set_concurrency(100);
+	EXPECT_EQ(pool.concurrency(), 4u);
+
+	// fewer tasks than threads, and calls from inside a task run serially on that thread
+	std::atomic<size_t> total{ 0 };
+	pool.run(2, [&](size_t) {
+		pool.run(100, [&](size_t i) { total += i; });
+	});
+	EXPECT_EQ(total.load(), 2u * 4950u);
+	pool.run(0, [&](size_t) { total = 0; });
+	EXPECT_EQ(total.load(), 2u * 4950u);
+}
+
+TEST(Parallel, for_range) {
+	// chunks are contiguous, at least min_chunk long and cover the range exactly once
+	const size_t count = 100003;
+	for (size_t min_chunk : { 1, 64, 1000, 200000 }) {
+		std::vector<int> hits(count, 0);
+		std::atomic<size_t> chunks{ 0 };
+		laml::parallel::for_range(count, min_chunk, [&](size_t begin, size_t end) {
+			EXPECT_LT(begin, end);
+			EXPECT_TRUE(end - begin >= min_chunk || end - begin == count);
+			for (size_t n = begin; n < end; n++) {
+				hits[n]++;
+			}
+			chunks++;
+		});
+		for (size_t n = 0; n < count; n++) {
+			EXPECT_EQ(hits[n], 1);
+		}
+		EXPECT_LE(chunks.load(), laml::parallel::ThreadPool::global().concurrency() * laml::parallel::chunks_per_thread);
+	}
+}
+
+TEST(Parallel, kernels) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> scale(0.5, 4.0);
+
+	// small chunk sizes to force the split
+	const size_t count = NUM_LOOPS + 3;
+	const size_t chunk = 64;
+	std::vector<laml::Mat4> a(count), b(count), out(count);
+	std::vector<laml::Vec3> vecs(count), vecs_out(count);
+	std::vector<laml::Quat> quats(count), quats_out(count);
+	std::vector<laml::Mat3> rots(count), rots_out(count);
+	std::vector<laml::Vec3> trans_out(count), scale_out(count);
+	for (size_t n = 0; n < count; n++) {
+		for (size_t k = 0; k < 16; k++) {
+			a[n]._data[k] = dis(gen);
+		}
+		laml::transform::create_transform(b[n], dis(gen), dis(gen), dis(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)),
+										  laml::Vec3(scale(gen), scale(gen), scale(gen)));
+		laml::transform::create_transform_rotation(rots[n], dis(gen), dis(gen), dis(gen));
+		vecs[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		quats[n] = laml::Quat(dis(gen), dis(gen), dis(gen), dis(gen));
+	}
+
+	laml::parallel::mul(a.data(), b.data(), out.data(), count, chunk);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(out[n] == laml::mul(a[n], b[n]));
+	}
+	laml::parallel::mul(a[0], b.data(), out.data(), count, chunk);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(out[n] == laml::mul(a[0], b[n]));
+	}
+
+	laml::parallel::normalize(vecs.data(), vecs_out.data(), count, chunk);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(vecs_out[n] == laml::normalize(vecs[n]));
+	}
+	laml::soa::Vec3Array soa_in(vecs.data(), count), soa_out(count);
+	laml::parallel::normalize(soa_in, soa_out, chunk);
+	laml::soa::normalize(soa_in, soa_in);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(soa_out.get(n) == soa_in.get(n));
+	}
+	laml::parallel::normalize(quats.data(), quats_out.data(), count, chunk);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Quat ref = laml::normalize(quats[n]);
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_EQ(quats_out[n][k], ref[k]);
+		}
+	}
+
+	laml::parallel::quat_from_mat(rots.data(), quats_out.data(), count, chunk);
+	for (size_t n = 0; n < count; n++) {
+		const laml::Quat ref = laml::transform::quat_from_mat(rots[n]);
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_EQ(quats_out[n][k], ref[k]);
+		}
+	}
+
+	EXPECT_TRUE(laml::parallel::decompose(b.data(), rots_out.data(), trans_out.data(), scale_out.data(), count, chunk));
+	for (size_t n = 0; n < count; n++) {
+		laml::Mat3 rot;
+		laml::Vec3 trans, scl;
+		laml::transform::decompose(b[n], rot, trans, scl);
+		EXPECT_TRUE(rots_out[n] == rot);
+		EXPECT_TRUE(trans_out[n] == trans);
+		EXPECT_TRUE(scale_out[n] == scl);
+	}
+
+	// one matrix that can't be decomposed fails the whole batch, the others are still done
+	b[count / 2].c_44 = 0.0f;
+	trans_out.assign(count, laml::Vec3(0.0f));
+	EXPECT_FALSE(laml::parallel::decompose(b.data(), rots_out.data(), trans_out.data(), scale_out.data(), count, chunk));
+	EXPECT_TRUE(trans_out[count / 2] == laml::Vec3(0.0f));
+	EXPECT_TRUE(trans_out[0] == laml::Vec3(b[0].c_14, b[0].c_24, b[0].c_34));
+}
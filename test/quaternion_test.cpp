@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+#include "test_random.h"
+
+TEST(Quaternion, mul) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Quat q1(dis(gen), dis(gen), dis(gen), dis(gen));
+		laml::Quat q2(dis(gen), dis(gen), dis(gen), dis(gen));
+
+		// q1*q2 = (w1*v2 + w2*v1 + v1 x v2, w1*w2 - v1.v2)
+		laml::Vec3 v1(q1.x, q1.y, q1.z), v2(q2.x, q2.y, q2.z);
+		laml::Vec3 v = v2 * q1.w + v1 * q2.w + laml::cross(v1, v2);
+		float w = q1.w * q2.w - laml::dot(v1, v2);
+
+		// the SSE specialization must match the generic template exactly
+		laml::Quat res = laml::mul(q1, q2);
+		laml::Quat generic = laml::mul<float>(q1, q2);
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_EQ(res[k], generic[k]);
+		}
+		const float tol = 1e-5f * 4.0f * 100.0f * 100.0f;
+		EXPECT_NEAR(res.x, v.x, tol);
+		EXPECT_NEAR(res.y, v.y, tol);
+		EXPECT_NEAR(res.z, v.z, tol);
+		EXPECT_NEAR(res.w, w, tol);
+	}
+}
+
+TEST(Quaternion, rotate) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	for (size_t n = 0; n < NUM_LOOPS; n++) {
+		laml::Quat q = random_unit_quat(gen);
+		laml::Vec3 v(dis(gen), dis(gen), dis(gen));
+
+		laml::Mat3 rot;
+		laml::transform::create_transform_rotation(rot, q);
+		laml::Vec3 ref = laml::transform::transform_point(rot, v);
+
+		// q * (v,0) * conj(q)
+		laml::Quat sandwich = laml::mul(laml::mul(q, laml::Quat(v.x, v.y, v.z, 0.0f)), laml::conjugate(q));
+
+		laml::Vec3 res = laml::rotate(q, v);
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_NEAR(res[k], ref[k], 1e-3f);
+			EXPECT_NEAR(res[k], sandwich[k], 1e-3f);
+		}
+	}
+}
+
+TEST(Quaternion, batched) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<laml::Quat> q1(count), q2(count), out(count);
+	std::vector<laml::Vec3> vecs(count), rotated(count);
+	for (size_t n = 0; n < count; n++) {
+		q1[n] = random_unit_quat(gen);
+		q2[n] = random_unit_quat(gen);
+		vecs[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+
+	laml::mul(q1.data(), q2.data(), out.data(), count);
+	laml::rotate(q1.data(), vecs.data(), rotated.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		laml::Quat ref = laml::mul(q1[n], q2[n]);
+		for (size_t k = 0; k < 4; k++) EXPECT_EQ(out[n][k], ref[k]);
+		EXPECT_TRUE(rotated[n] == laml::rotate(q1[n], vecs[n]));
+	}
+
+	// SoA kernels give the same results as the scalar functions
+	laml::soa::QuatArray sq1(count), sq2(count), sout(count);
+	laml::soa::copy(laml::soa::view(q1.data(), count), sq1);
+	laml::soa::copy(laml::soa::view(q2.data(), count), sq2);
+	laml::soa::Vec3Array svecs(vecs.data(), count), srotated(count);
+
+	laml::soa::quat_mul(sq1, sq2, sout);
+	for (size_t n = 0; n < count; n++) {
+		laml::Quat ref = laml::mul(q1[n], q2[n]);
+		for (size_t k = 0; k < 4; k++) EXPECT_EQ(sout.get(n)[k], ref[k]);
+	}
+	laml::soa::rotate(sq1, svecs, srotated);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(srotated.get(n) == laml::rotate(q1[n], vecs[n]));
+	}
+	laml::soa::rotate(q2[0], laml::soa::view(vecs.data(), count), srotated);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(srotated.get(n) == laml::rotate(q2[0], vecs[n]));
+	}
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Skinning.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+// absolute tolerances: float rounding scales with the size of the inputs, not of the result
+static void expect_near(const laml::Vec3& a, const laml::Vec3& b, float tol) {
+	for (size_t k = 0; k < 3; k++) {
+		EXPECT_NEAR(a[k], b[k], tol);
+	}
+}
+
+// The hand-written loop skin() replaces: blend the matrices, then transform_point per vertex
+template<size_t Influences, typename J, typename W>
+static void check_skin(const std::vector<laml::Mat4>& skin_mats, const std::vector<J>& joints, const std::vector<W>& weights, float scale,
+					   const std::vector<laml::Vec3>& positions, const std::vector<laml::Vec3>& normals) {
+	const size_t count = positions.size();
+	laml::soa::Vec3Array soa_pos(positions.data(), count), soa_nrm(normals.data(), count), out_pos(count), out_nrm(count);
+	std::vector<laml::Vec3> aos_pos(count);
+	laml::skin<Influences>(skin_mats.data(), joints.data(), weights.data(), soa_pos, soa_nrm, out_pos, out_nrm);
+	laml::skin<Influences>(skin_mats.data(), joints.data(), weights.data(), laml::soa::view(positions.data(), count), laml::soa::view(aos_pos.data(), count));
+	for (size_t n = 0; n < count; n++) {
+		laml::Mat4 m = skin_mats[joints[Influences * n]] * (static_cast<float>(weights[Influences * n]) * scale);
+		for (size_t k = 1; k < Influences; k++) {
+			m = m + skin_mats[joints[Influences * n + k]] * (static_cast<float>(weights[Influences * n + k]) * scale);
+		}
+		const laml::Vec3 ref_pos = laml::transform::transform_point(m, positions[n], 1.0f);
+		expect_near(out_pos.get(n), ref_pos, 1e-3f);
+		expect_near(aos_pos[n], ref_pos, 1e-3f);
+		expect_near(out_nrm.get(n), laml::normalize(laml::transform::transform_point(m, normals[n], 0.0f)), 1e-4f);
+	}
+
+	// split into chunks, bit for bit the same
+	laml::soa::Vec3Array par_pos(count), par_nrm(count);
+	laml::parallel::skin<Influences>(skin_mats.data(), joints.data(), weights.data(), soa_pos, soa_nrm, par_pos, par_nrm, 64);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(par_pos.get(n) == out_pos.get(n));
+		EXPECT_TRUE(par_nrm.get(n) == out_nrm.get(n));
+	}
+}
+
+TEST(Skinning, skin) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-10.0, 10.0);
+	std::uniform_real_distribution<float> angle(-180.0, 180.0);
+	std::uniform_real_distribution<float> scale(0.5, 2.0);
+	std::uniform_real_distribution<float> weight(0.0, 1.0);
+
+	const size_t num_joints = 37;
+	std::vector<laml::Mat4> joint_mats(num_joints), inverse_bind(num_joints), skin_mats(num_joints);
+	for (size_t j = 0; j < num_joints; j++) {
+		const float s = scale(gen);
+		laml::transform::create_transform(joint_mats[j], angle(gen), angle(gen), angle(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(s));
+		laml::Mat4 bind;
+		laml::transform::create_transform(bind, angle(gen), angle(gen), angle(gen), laml::Vec3(dis(gen), dis(gen), dis(gen)), laml::Vec3(1.0f));
+		inverse_bind[j] = laml::inverse_rigid(bind);
+	}
+	laml::skinning_matrices(joint_mats.data(), inverse_bind.data(), skin_mats.data(), num_joints);
+	for (size_t j = 0; j < num_joints; j++) {
+		EXPECT_TRUE(skin_mats[j] == laml::mul(joint_mats[j], inverse_bind[j]));
+	}
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets, or of tiles
+	std::vector<laml::Vec3> positions(count), normals(count);
+	std::vector<uint16> joints4(4 * count), joints8(8 * count);
+	std::vector<uint8> joints4_u8(4 * count);
+	std::vector<float> weights4(4 * count), weights8(8 * count);
+	std::vector<uint8> weights4_u8(4 * count);
+	std::vector<uint16> weights8_u16(8 * count);
+	for (size_t n = 0; n < count; n++) {
+		positions[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		normals[n] = laml::normalize(laml::Vec3(dis(gen), dis(gen), dis(gen)));
+
+		float sum = 0.0f;
+		for (size_t k = 0; k < 4; k++) {
+			joints4[4 * n + k] = static_cast<uint16>(gen() % num_joints);
+			joints4_u8[4 * n + k] = static_cast<uint8>(joints4[4 * n + k]);
+			weights4[4 * n + k] = weight(gen);
+			sum += weights4[4 * n + k];
+		}
+		weights4[4 * n + 3] = 0.0f; // an unused influence
+		for (size_t k = 0; k < 4; k++) {
+			weights4_u8[4 * n + k] = static_cast<uint8>(weights4[4 * n + k] / sum * 255.0f + 0.5f);
+		}
+		for (size_t k = 0; k < 8; k++) {
+			joints8[8 * n + k] = static_cast<uint16>(gen() % num_joints);
+			weights8[8 * n + k] = weight(gen) / 8.0f;
+			weights8_u16[8 * n + k] = static_cast<uint16>(weights8[8 * n + k] * 65535.0f);
+		}
+	}
+
+	check_skin<4>(skin_mats, joints4, weights4, 1.0f, positions, normals);
+	check_skin<4>(skin_mats, joints4_u8, weights4_u8, 1.0f / 255.0f, positions, normals);
+	check_skin<8>(skin_mats, joints8, weights8, 1.0f, positions, normals);
+	check_skin<8>(skin_mats, joints8, weights8_u16, 1.0f / 65535.0f, positions, normals);
+
+	// one joint with full weight is that joint's transform, in place
+	for (size_t n = 0; n < count; n++) {
+		weights4_u8[4 * n] = 255;
+		weights4_u8[4 * n + 1] = weights4_u8[4 * n + 2] = weights4_u8[4 * n + 3] = 0;
+	}
+	std::vector<laml::Vec3> moved(positions);
+	laml::skin<4>(skin_mats.data(), joints4_u8.data(), weights4_u8.data(), laml::soa::view(moved.data(), count), laml::soa::view(moved.data(), count));
+	for (size_t n = 0; n < count; n++) {
+		const laml::Mat4& m = skin_mats[joints4_u8[4 * n]];
+		expect_near(moved[n], laml::transform::transform_point(m, positions[n], 1.0f), 1e-3f);
+	}
+}
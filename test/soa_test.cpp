@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Soa.hpp>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "test_config.h"
+
+// odd size so every kernel also runs its partial last packet
+const size_t NUM_VECS = 1'003;
+
+TEST(Storage, Vec3Array) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
+
+	std::vector<laml::Vec3> aos(NUM_VECS);
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		aos[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+
+	laml::soa::Vec3Array arr(aos.data(), aos.size());
+	ASSERT_EQ(arr.size(), NUM_VECS);
+	for (size_t k = 0; k < 3; k++) {
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.lane(k)) % laml::simd::alignment, 0u);
+	}
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		EXPECT_EQ(arr.x()[n], aos[n].x);
+		EXPECT_EQ(arr.y()[n], aos[n].y);
+		EXPECT_EQ(arr.z()[n], aos[n].z);
+	}
+
+	// growing keeps the old values and zeroes the new ones
+	arr.resize(2 * NUM_VECS);
+	EXPECT_TRUE(arr.get(NUM_VECS - 1) == aos[NUM_VECS - 1]);
+	EXPECT_TRUE(arr.get(2 * NUM_VECS - 1) == laml::Vec3(0.0f));
+
+	// round trip through a zero-copy view of a plain array
+	laml::soa::Vec3Array copy(arr);
+	copy.resize(NUM_VECS);
+	std::vector<laml::Vec3> back(NUM_VECS);
+	laml::soa::copy(copy, laml::soa::view(back.data(), back.size()));
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		EXPECT_TRUE(back[n] == aos[n]);
+	}
+}
+
+TEST(Kernels, Vec3Array) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-1000.0, 1000.0);
+
+	std::vector<laml::Vec3> a(NUM_VECS), b(NUM_VECS);
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		a[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		b[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	a[0] = laml::Vec3(0.0f); // normalize() special case
+
+	laml::soa::Vec3Array sa(a.data(), NUM_VECS), sb(b.data(), NUM_VECS), out(NUM_VECS);
+	std::vector<float> scalars(NUM_VECS);
+
+	laml::soa::add(sa, sb, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == a[n] + b[n]);
+	laml::soa::sub(sa, sb, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == a[n] - b[n]);
+	laml::soa::scale(sa, 0.25f, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == a[n] * 0.25f);
+
+	laml::soa::cross(sa, sb, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == laml::cross(a[n], b[n]));
+	laml::soa::lerp(sa, sb, 0.3f, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == laml::lerp(a[n], b[n], 0.3f));
+	laml::soa::clamp(sa, -10.0f, 10.0f, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == laml::clamp(a[n], -10.0f, 10.0f));
+
+	laml::soa::normalize(sa, out);
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		laml::Vec3 ref = laml::normalize(a[n]);
+		for (size_t k = 0; k < 3; k++) EXPECT_FLOAT_EQ(out.get(n)[k], ref[k]);
+	}
+
+	laml::soa::dot(sa, sb, scalars.data());
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_FLOAT_EQ(scalars[n], laml::dot(a[n], b[n]));
+	laml::soa::length(sa, scalars.data());
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_FLOAT_EQ(scalars[n], laml::length(a[n]));
+	laml::soa::min(sa, scalars.data());
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_EQ(scalars[n], laml::min(a[n]));
+	laml::soa::max(sa, scalars.data());
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_EQ(scalars[n], laml::max(a[n]));
+
+	// the same kernels run directly on AoS data through a view
+	std::vector<laml::Vec3> aos_out(NUM_VECS);
+	laml::soa::cross(laml::soa::view(a.data(), NUM_VECS), sb, laml::soa::view(aos_out.data(), NUM_VECS));
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(aos_out[n] == laml::cross(a[n], b[n]));
+
+	// const data can only be viewed read-only, and then only passed as an input
+	const std::vector<laml::Vec3>& const_a = a;
+	static_assert(std::is_same<decltype(laml::soa::view(const_a.data(), NUM_VECS)), laml::soa::Vec3ConstView>::value, "read-only view of const data");
+	laml::soa::sub(laml::soa::view(const_a.data(), NUM_VECS), sb, laml::soa::view(aos_out.data(), NUM_VECS));
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(aos_out[n] == a[n] - b[n]);
+}
+
+TEST(Kernels, Vec4Array_highp) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<double> dis(-1000.0, 1000.0);
+
+	std::vector<laml::Vec4_highp> a(NUM_VECS), b(NUM_VECS);
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		a[n] = laml::Vec4_highp(dis(gen), dis(gen), dis(gen), dis(gen));
+		b[n] = laml::Vec4_highp(dis(gen), dis(gen), dis(gen), dis(gen));
+	}
+
+	laml::soa::Vec4Array_highp sa(a.data(), NUM_VECS), sb(b.data(), NUM_VECS), out(NUM_VECS);
+	std::vector<double> scalars(NUM_VECS);
+
+	laml::soa::add(sa, sb, out);
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_TRUE(out.get(n) == a[n] + b[n]);
+	laml::soa::dot(sa, sb, scalars.data());
+	for (size_t n = 0; n < NUM_VECS; n++) EXPECT_DOUBLE_EQ(scalars[n], laml::dot(a[n], b[n]));
+	laml::soa::normalize(sa, out);
+	for (size_t n = 0; n < NUM_VECS; n++) {
+		laml::Vec4_highp ref = laml::normalize(a[n]);
+		for (size_t k = 0; k < 4; k++) EXPECT_DOUBLE_EQ(out.get(n)[k], ref[k]);
+	}
+}
@@ -0,0 +1,14 @@
+#ifndef __TEST_RANDOM_H
+#define __TEST_RANDOM_H
+
+#include <laml/laml.hpp>
+#include <random>
+
+// random rotation: a normalized random 4-vector
+template<typename T = float>
+static laml::Quaternion<T> random_unit_quat(std::mt19937& gen) {
+	std::uniform_real_distribution<T> dis(-1.0, 1.0);
+	return laml::normalize(laml::Quaternion<T>(dis(gen), dis(gen), dis(gen), dis(gen)));
+}
+
+#endif
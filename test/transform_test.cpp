@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <laml/laml.hpp>
+#include <laml/Parallel.hpp>
+#include <random>
+#include <vector>
+
+#include "test_config.h"
+
+TEST(Batch, transform_points) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+
+	laml::Mat4 mat;
+	for (size_t n = 0; n < 16; n++) {
+		mat._data[n] = dis(gen);
+	}
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<laml::Vec3> points(count), aos_out(count);
+	for (size_t n = 0; n < count; n++) {
+		points[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+	}
+	laml::soa::Vec3Array soa_in(points.data(), count), soa_out(count);
+
+	laml::transform::transform_points(mat, points.data(), aos_out.data(), count, 1.0f);
+	laml::transform::transform_points(mat, soa_in, soa_out, 1.0f);
+	laml::soa::Vec3Array mixed_out(count); // AoS in, SoA out through a strided view
+	laml::transform::transform_points(mat, laml::soa::view(points.data(), count), mixed_out, 1.0f);
+	for (size_t n = 0; n < count; n++) {
+		laml::Vec3 ref = laml::transform::transform_point(mat, points[n], 1.0f);
+		EXPECT_TRUE(aos_out[n] == ref);
+		EXPECT_TRUE(soa_out.get(n) == ref);
+		EXPECT_TRUE(mixed_out.get(n) == ref);
+	}
+
+	// directions (w = 0) and the fused perspective divide
+	laml::transform::transform_points(mat, points.data(), aos_out.data(), count, 0.0f);
+	laml::transform::transform_points(mat, soa_in, soa_out, 1.0f, true);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(aos_out[n] == laml::transform::transform_point(mat, points[n], 0.0f));
+
+		laml::Vec4 clip = laml::transform::transform_point(mat, laml::Vec4(points[n], 1.0f));
+		for (size_t k = 0; k < 3; k++) {
+			EXPECT_NEAR(soa_out.get(n)[k], clip[k] / clip.w, 1e-4f * (1.0f + laml::abs(clip[k] / clip.w)));
+		}
+	}
+
+	// threaded version, with a small chunk size to force the split
+	std::vector<laml::Vec3> threaded_out(count);
+	laml::parallel::transform_points(mat, points.data(), threaded_out.data(), count, 1.0f, false, 64);
+	laml::transform::transform_points(mat, points.data(), aos_out.data(), count, 1.0f);
+	for (size_t n = 0; n < count; n++) {
+		EXPECT_TRUE(threaded_out[n] == aos_out[n]);
+	}
+}
+
+
+static void expect_equal(const laml::Mat4& mat, const laml::Mat4& ref) {
+	for (size_t k = 0; k < 16; k++) {
+		EXPECT_EQ(mat._data[k], ref._data[k]);
+	}
+}
+
+TEST(Transform, create_transform_TRS) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> dis(-100.0, 100.0);
+	std::uniform_real_distribution<float> unit(-1.0, 1.0);
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<laml::Quat> rots(count);
+	std::vector<laml::Vec3> trans(count), scales(count);
+	std::vector<laml::Mat4> refs(count);
+	for (size_t n = 0; n < count; n++) {
+		rots[n] = laml::normalize(laml::Quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+		trans[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+		scales[n] = laml::Vec3(dis(gen), dis(gen), dis(gen));
+
+		// the direct composition must give exactly what the matrix products give
+		laml::Mat4 rot_mat, trans_mat, scale_mat;
+		laml::transform::create_transform_rotation(rot_mat, rots[n]);
+		laml::transform::create_transform_translate(trans_mat, trans[n]);
+		laml::transform::create_transform_scale(scale_mat, scales[n]);
+		laml::transform::create_transform(refs[n], rot_mat, trans_mat, scale_mat);
+
+		laml::Mat4 mat;
+		laml::transform::create_transform(mat, rots[n], trans[n], scales[n]);
+		expect_equal(mat, refs[n]);
+
+		laml::Mat4 ref_rt;
+		laml::transform::create_transform(ref_rt, rot_mat, trans_mat);
+		laml::transform::create_transform(mat, rots[n], trans[n]);
+		expect_equal(mat, ref_rt);
+
+		laml::Mat3 rot_mat3;
+		laml::transform::create_transform_rotation(rot_mat3, rots[n]);
+		laml::transform::create_transform(mat, rot_mat3, trans[n], scales[n]);
+		expect_equal(mat, refs[n]);
+
+		const float yaw = dis(gen), pitch = dis(gen), roll = dis(gen);
+		laml::transform::create_transform_rotation(rot_mat, yaw, pitch, roll);
+		laml::transform::create_transform(ref_rt, rot_mat, trans_mat, scale_mat);
+		laml::transform::create_transform(mat, yaw, pitch, roll, trans[n], scales[n]);
+		expect_equal(mat, ref_rt);
+	}
+
+	// batched
+	std::vector<laml::Mat4> mats(count);
+	laml::transform::create_transforms(mats.data(), rots.data(), trans.data(), scales.data(), count);
+	for (size_t n = 0; n < count; n++) {
+		expect_equal(mats[n], refs[n]);
+	}
+}
+
+TEST(Transform, rotations_from_ypr) {
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> deg(-360.0, 360.0);
+
+	const size_t count = NUM_LOOPS + 3; // not a whole number of packets
+	std::vector<float> yaws(count), pitches(count), rolls(count);
+	for (size_t n = 0; n < count; n++) {
+		yaws[n] = deg(gen);
+		pitches[n] = deg(gen);
+		rolls[n] = deg(gen);
+	}
+
+	std::vector<laml::Mat3> mat3s(count), mat3s_fast(count);
+	std::vector<laml::Mat4> mat4s(count), mat4s_fast(count);
+	std::vector<laml::Quat> quats(count), quats_fast(count);
+	laml::transform::create_transform_rotations(mat3s.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::precise());
+	laml::transform::create_transform_rotations(mat3s_fast.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::fast());
+	laml::transform::create_transform_rotations(mat4s.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::precise());
+	laml::transform::create_transform_rotations(mat4s_fast.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::fast());
+	laml::transform::quats_from_ypr(quats.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::precise());
+	laml::transform::quats_from_ypr(quats_fast.data(), yaws.data(), pitches.data(), rolls.data(), count, laml::math::fast());
+
+	for (size_t n = 0; n < count; n++) {
+		// precise is the single-entity builder
+		laml::Mat4 ref;
+		laml::transform::create_transform_rotation(ref, yaws[n], pitches[n], rolls[n], laml::math::precise());
+		expect_equal(mat4s[n], ref);
+		const laml::Quat q = laml::transform::quat_from_ypr(yaws[n], pitches[n], rolls[n], laml::math::precise());
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_EQ(quats[n][k], q[k]);
+		}
+
+		// the half-angle quaternion is the same rotation as the matrix
+		laml::Mat3 from_quat;
+		laml::transform::create_transform_rotation(from_quat, q);
+		for (size_t k = 0; k < 9; k++) {
+			EXPECT_EQ(mat3s[n]._data[k], mat4s[n][k / 3][k % 3]);
+			EXPECT_NEAR(from_quat._data[k], mat3s[n]._data[k], 2e-6f);
+			EXPECT_NEAR(mat3s_fast[n]._data[k], mat3s[n]._data[k], 1e-6f);
+		}
+		for (size_t k = 0; k < 16; k++) {
+			if (k % 4 == 3 || k >= 12) {
+				EXPECT_EQ(mat4s_fast[n]._data[k], ref._data[k]);
+			} else {
+				EXPECT_NEAR(mat4s_fast[n]._data[k], ref._data[k], 1e-6f);
+			}
+		}
+		for (size_t k = 0; k < 4; k++) {
+			EXPECT_NEAR(quats_fast[n][k], quats[n][k], 1e-6f);
+		}
+		EXPECT_NEAR(laml::length(q), 1.0f, 1e-6f);
+	}
+}
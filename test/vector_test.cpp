@@ -4,8 +4,6 @@
 #include <random>
 
 TEST(Specializations, Vector) {
-	using namespace rh;
-
 	std::random_device rd;  // Will be used to obtain a seed for the random number engine
 	std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
 	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
@@ -47,8 +45,6 @@ TEST(Specializations, Vector) {
 }
 
 TEST(Acessors, Vector) {
-	using namespace rh;
-
 	std::random_device rd;  // Will be used to obtain a seed for the random number engine
 	std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
 	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
@@ -91,8 +87,6 @@ TEST(Acessors, Vector) {
 
 // Test the constructors are working as intended
 TEST(ConstructorTest, Vector2) {
-	using namespace rh;
-
 	std::random_device rd;  // Will be used to obtain a seed for the random number engine
 	std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
 	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
@@ -128,8 +122,6 @@ TEST(ConstructorTest, Vector2) {
 	}
 }
 TEST(ConstructorTest, Vector3) {
-	using namespace rh;
-
 	std::random_device rd;  // Will be used to obtain a seed for the random number engine
 	std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
 	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);
@@ -174,8 +166,6 @@ TEST(ConstructorTest, Vector3) {
 }
 
 TEST(ConstructorTest, Vector4) {
-	using namespace rh;
-
 	std::random_device rd;  // Will be used to obtain a seed for the random number engine
 	std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
 	std::uniform_real_distribution<float> dis(-100000.0, 100000.0);